@@ -11,6 +11,7 @@
 #include "yaml_parser.h"
 #include "ssz_merkle.h"
 #include "ssz_utils.h"
+#include "ssz_generator.h"
 
 #define YAML_FILE_PATH "./bench/data/Attestation/ssz_random/case_0/attestation.yaml"
 #define MAX_VALIDATORS_PER_COMMITTEE 2048
@@ -45,53 +46,6 @@ typedef struct
     uint8_t signature[96];
 } Attestation;
 
-typedef struct
-{
-    uint8_t *data;
-    size_t size;
-    size_t capacity;
-} DynamicBuffer;
-
-static void db_init(DynamicBuffer *db)
-{
-    db->data = NULL;
-    db->size = 0;
-    db->capacity = 0;
-}
-
-static void db_free(DynamicBuffer *db)
-{
-    free(db->data);
-    db->data = NULL;
-    db->size = 0;
-    db->capacity = 0;
-}
-
-static ssz_error_t db_ensure_capacity(DynamicBuffer *db, size_t needed)
-{
-    if (db->size + needed <= db->capacity)
-        return SSZ_SUCCESS;
-    size_t new_capacity = db->capacity == 0 ? 128 : db->capacity;
-    while (new_capacity < db->size + needed)
-        new_capacity *= 2;
-    uint8_t *temp = realloc(db->data, new_capacity);
-    if (!temp)
-        return SSZ_ERROR_DESERIALIZATION;
-    db->data = temp;
-    db->capacity = new_capacity;
-    return SSZ_SUCCESS;
-}
-
-static ssz_error_t db_append(DynamicBuffer *db, const uint8_t *bytes, size_t len)
-{
-    ssz_error_t err = db_ensure_capacity(db, len);
-    if (err != SSZ_SUCCESS)
-        return err;
-    memcpy(db->data + db->size, bytes, len);
-    db->size += len;
-    return SSZ_SUCCESS;
-}
-
 static void print_hex(const uint8_t *data, size_t length)
 {
     for (size_t i = 0; i < length; i++)
@@ -127,160 +81,49 @@ static void print_attestation(const Attestation *f)
     print_hex(f->signature, 96);
 }
 
-static ssz_error_t ssz_serialize_attestation_data_db(const AttestationData *ad, DynamicBuffer *db)
-{
-    ssz_error_t err;
-    uint8_t tmp[64];
-    size_t tmp_size = sizeof(tmp);
-    err = ssz_serialize_uint64(&ad->slot, tmp, &tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = db_append(db, tmp, tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    tmp_size = sizeof(tmp);
-    err = ssz_serialize_uint64(&ad->index, tmp, &tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = db_append(db, tmp, tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    {
-        uint8_t vec_buf[64];
-        size_t vec_size = sizeof(vec_buf);
-        size_t element_count = 32;
-        size_t sizes[32];
-        for (size_t i = 0; i < element_count; i++)
-            sizes[i] = 1;
-        err = ssz_serialize_vector_uint8(ad->beacon_block_root, element_count, vec_buf, &vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-        err = db_append(db, vec_buf, vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-    }
-    tmp_size = sizeof(tmp);
-    err = ssz_serialize_uint64(&ad->source.epoch, tmp, &tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = db_append(db, tmp, tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    {
-        uint8_t vec_buf[64];
-        size_t vec_size = sizeof(vec_buf);
-        size_t element_count = 32;
-        size_t sizes[32];
-        for (size_t i = 0; i < element_count; i++)
-            sizes[i] = 1;
-        err = ssz_serialize_vector_uint8(ad->source.root, element_count, vec_buf, &vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-        err = db_append(db, vec_buf, vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-    }
-    tmp_size = sizeof(tmp);
-    err = ssz_serialize_uint64(&ad->target.epoch, tmp, &tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = db_append(db, tmp, tmp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    {
-        uint8_t vec_buf[64];
-        size_t vec_size = sizeof(vec_buf);
-        size_t element_count = 32;
-        size_t sizes[32];
-        for (size_t i = 0; i < element_count; i++)
-            sizes[i] = 1;
-        err = ssz_serialize_vector_uint8(ad->target.root, element_count, vec_buf, &vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-        err = db_append(db, vec_buf, vec_size);
-        if (err != SSZ_SUCCESS)
-            return err;
-    }
-    return SSZ_SUCCESS;
-}
-
-static ssz_error_t ssz_serialize_signature(const uint8_t *signature, DynamicBuffer *db)
-{
-    ssz_error_t err;
-    uint8_t vec_buf[128];
-    size_t vec_size = sizeof(vec_buf);
-    size_t element_count = 96;
-    size_t sizes[96];
-    for (size_t i = 0; i < element_count; i++)
-        sizes[i] = 1;
-    err = ssz_serialize_vector_uint8(signature, element_count, vec_buf, &vec_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = db_append(db, vec_buf, vec_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    return SSZ_SUCCESS;
-}
-
-static ssz_error_t ssz_serialize_aggregation_bits(const AggregationBits *bits, DynamicBuffer *db)
-{
-    ssz_error_t err;
-    uint8_t temp[256];
-    size_t temp_size = sizeof(temp);
-    err = ssz_serialize_bitlist(bits->data, bits->length, temp, &temp_size);
-    if (err != SSZ_SUCCESS)
-        return err;
-    return db_append(db, temp, temp_size);
-}
+#define SIZE_CHECKPOINT (SSZ_BYTE_SIZE_OF_UINT64 + 32)
+#define SIZE_ATTESTATION_DATA (2 * SSZ_BYTE_SIZE_OF_UINT64 + 32 + 2 * SIZE_CHECKPOINT)
+#define SIZE_ATTESTATION_FIXED (SSZ_BYTES_PER_LENGTH_OFFSET + SIZE_ATTESTATION_DATA + 96)
+
+#define SERIALIZE_CHECKPOINT_FIELDS                                                           \
+    SERIALIZE_BASIC_FIELD(obj, offset, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    SERIALIZE_VECTOR_FIELD(obj, offset, root, 32, ssz_serialize_vector_uint8);
+static DEFINE_SERIALIZE_CONTAINER(Checkpoint, SERIALIZE_CHECKPOINT_FIELDS)
+
+#define SERIALIZE_ATTESTATION_DATA_FIELDS                                                          \
+    SERIALIZE_BASIC_FIELD(obj, offset, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);       \
+    SERIALIZE_BASIC_FIELD(obj, offset, index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);      \
+    SERIALIZE_VECTOR_FIELD(obj, offset, beacon_block_root, 32, ssz_serialize_vector_uint8);        \
+    SERIALIZE_CONTAINER_FIELD(obj, offset, source, serialize_Checkpoint, SIZE_CHECKPOINT);         \
+    SERIALIZE_CONTAINER_FIELD(obj, offset, target, serialize_Checkpoint, SIZE_CHECKPOINT);
+static DEFINE_SERIALIZE_CONTAINER(AttestationData, SERIALIZE_ATTESTATION_DATA_FIELDS)
+
+#define SERIALIZE_ATTESTATION_FIELDS                                                                         \
+    uint32_t variable_offset = SIZE_ATTESTATION_FIXED;                                                       \
+    uint32_t agg_bits_offset;                                                                                \
+    SERIALIZE_OFFSET_FIELD(agg_bits_offset, variable_offset, offset, obj->aggregation_bits.length / 8 + 1);   \
+    SERIALIZE_CONTAINER_FIELD(obj, offset, data, serialize_AttestationData, SIZE_ATTESTATION_DATA);          \
+    SERIALIZE_VECTOR_FIELD(obj, offset, signature, 96, ssz_serialize_vector_uint8);                          \
+    SERIALIZE_BITLIST_FIELD(obj, offset, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);
+static DEFINE_SERIALIZE_CONTAINER(Attestation, SERIALIZE_ATTESTATION_FIELDS)
+
+#define SIZE_ATTESTATION_FIELDS                     \
+    SIZE_BITLIST_FIELD(obj, size, aggregation_bits); \
+    SIZE_FIXED_FIELD(size, SIZE_ATTESTATION_DATA);   \
+    SIZE_FIXED_FIELD(size, 96);
+static DEFINE_SIZE_CONTAINER(Attestation, SIZE_ATTESTATION_FIELDS)
+
+#define VALIDATE_ATTESTATION_FIELDS \
+    VIEW_BITLIST_FIELD(0, SSZ_VIEW_END, MAX_VALIDATORS_PER_COMMITTEE);
+static DEFINE_VALIDATE_CONTAINER(Attestation, SIZE_ATTESTATION_FIXED, VALIDATE_ATTESTATION_FIELDS)
 
 static ssz_error_t serialize_attestation(const Attestation *attestation_data, uint8_t *out_buffer, size_t out_buffer_size, size_t *out_actual_size)
 {
-    DynamicBuffer db_fixed;
-    DynamicBuffer db_var;
-    DynamicBuffer db_final;
-    db_init(&db_fixed);
-    db_init(&db_var);
-    db_init(&db_final);
-    ssz_error_t err = SSZ_SUCCESS;
-    err = ssz_serialize_attestation_data_db(&attestation_data->data, &db_fixed);
-    if (err != SSZ_SUCCESS)
-        goto fin;
-    err = ssz_serialize_signature(attestation_data->signature, &db_fixed);
-    if (err != SSZ_SUCCESS)
-        goto fin;
-    err = ssz_serialize_aggregation_bits(&attestation_data->aggregation_bits, &db_var);
-    if (err != SSZ_SUCCESS)
-        goto fin;
-    uint32_t offset_agg_bits = 4 + (uint32_t)db_fixed.size;
-    {
-        uint8_t tmp[4];
-        size_t tmp_size = sizeof(tmp);
-        uint32_t val = offset_agg_bits;
-        err = ssz_serialize_uint32(&val, tmp, &tmp_size);
-        if (err != SSZ_SUCCESS)
-            goto fin;
-        err = db_append(&db_final, tmp, tmp_size);
-        if (err != SSZ_SUCCESS)
-            goto fin;
-    }
-    err = db_append(&db_final, db_fixed.data, db_fixed.size);
-    if (err != SSZ_SUCCESS)
-        goto fin;
-    err = db_append(&db_final, db_var.data, db_var.size);
-    if (err != SSZ_SUCCESS)
-        goto fin;
-    if (db_final.size > out_buffer_size)
+    if (ssz_size_Attestation(attestation_data) > out_buffer_size)
     {
-        err = SSZ_ERROR_SERIALIZATION;
-        goto fin;
+        return SSZ_ERROR_SERIALIZATION;
     }
-    memcpy(out_buffer, db_final.data, db_final.size);
-    *out_actual_size = db_final.size;
-fin:
-    db_free(&db_fixed);
-    db_free(&db_var);
-    db_free(&db_final);
-    return err;
+    return serialize_Attestation(attestation_data, out_buffer, out_actual_size);
 }
 
 static ssz_error_t deserialize_attestation(const uint8_t *buffer, size_t buffer_size, Attestation *out_attestation)
@@ -474,170 +317,75 @@ static void attestation_bench_func_name_deserialize(void *user_data)
     }
 }
 
-static ssz_error_t hash_tree_root_uint64(uint64_t value, uint8_t *out_root)
-{
-    uint8_t buf[8];
-    for (int i = 0; i < 8; i++)
-        buf[i] = (uint8_t)((value >> (8 * i)) & 0xFF);
-    uint8_t packed[SSZ_BYTES_PER_CHUNK];
-    size_t chunk_count;
-    ssz_error_t err = ssz_pack(buf, 1, 8, packed, &chunk_count);
-    if (err != SSZ_SUCCESS)
-        return err;
-    return ssz_merkleize(packed, chunk_count, 0, out_root);
-}
+static uint8_t g_malformed[2048];
 
-static ssz_error_t hash_tree_root_bytes(const uint8_t *bytes, size_t length, uint8_t *out_root)
+static void attestation_bench_func_name_validate(void *user_data)
 {
-    size_t chunk_count;
-    size_t alloc_size = ((length + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK) * SSZ_BYTES_PER_CHUNK;
-    uint8_t *packed = malloc(alloc_size);
-    if (!packed)
-        return SSZ_ERROR_SERIALIZATION;
-    ssz_error_t err = ssz_pack(bytes, 1, length, packed, &chunk_count);
-    if (err != SSZ_SUCCESS)
+    (void)user_data;
+    if (ssz_validate_Attestation(g_serialized, g_serialized_size) != SSZ_SUCCESS)
     {
-        free(packed);
-        return err;
+        printf("Failed to validate\n");
     }
-    err = ssz_merkleize(packed, chunk_count, 0, out_root);
-    free(packed);
-    return err;
 }
 
-static ssz_error_t hash_tree_root_checkpoint(const Checkpoint *cp, uint8_t *out_root)
+static void attestation_bench_func_name_validate_reject(void *user_data)
 {
-    uint8_t root_epoch[32], root_root[32];
-    ssz_error_t err = hash_tree_root_uint64(cp->epoch, root_epoch);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_bytes(cp->root, 32, root_root);
-    if (err != SSZ_SUCCESS)
-        return err;
-    uint8_t nodes[2][32];
-    memcpy(nodes[0], root_epoch, 32);
-    memcpy(nodes[1], root_root, 32);
-    return ssz_merkleize((uint8_t *)nodes, 2, 0, out_root);
-}
-
-static ssz_error_t hash_tree_root_attestation_data(const AttestationData *data, uint8_t *out_root)
-{
-    uint8_t root_slot[32], root_index[32], root_beacon[32], root_source[32], root_target[32];
-    ssz_error_t err = hash_tree_root_uint64(data->slot, root_slot);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_uint64(data->index, root_index);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_bytes(data->beacon_block_root, 32, root_beacon);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_checkpoint(&data->source, root_source);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_checkpoint(&data->target, root_target);
-    if (err != SSZ_SUCCESS)
-        return err;
-    uint8_t nodes[5][32];
-    memcpy(nodes[0], root_slot, 32);
-    memcpy(nodes[1], root_index, 32);
-    memcpy(nodes[2], root_beacon, 32);
-    memcpy(nodes[3], root_source, 32);
-    memcpy(nodes[4], root_target, 32);
-    return ssz_merkleize((uint8_t *)nodes, 5, 0, out_root);
-}
-
-static ssz_error_t hash_tree_root_aggregation_bits(const AggregationBits *bits, uint8_t *out_root)
-{
-    size_t chunk_count;
-    size_t limit = (MAX_VALIDATORS_PER_COMMITTEE + 255) / 256;
-    size_t alloc_size = limit * SSZ_BYTES_PER_CHUNK;
-    uint8_t *packed = malloc(alloc_size);
-    if (!packed)
-        return SSZ_ERROR_SERIALIZATION;
-    memset(packed, 0, alloc_size);
-    ssz_error_t err = ssz_pack_bits(bits->data, bits->length, packed, &chunk_count);
-    if (err != SSZ_SUCCESS)
+    (void)user_data;
+    if (ssz_validate_Attestation(g_malformed, g_serialized_size) == SSZ_SUCCESS)
     {
-        free(packed);
-        return err;
+        printf("Malformed attestation was accepted\n");
     }
-    err = ssz_merkleize(packed, chunk_count, limit, out_root);
-    free(packed);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = ssz_mix_in_length(out_root, bits->length, out_root);
-    if (err != SSZ_SUCCESS)
-        return err;
-    return SSZ_SUCCESS;
 }
 
-static ssz_error_t hash_tree_root_signature(const uint8_t *signature, uint8_t *out_root)
+#define HTR_CHECKPOINT_FIELDS                                                                 \
+    HTR_BASIC_FIELD(obj, chunk_index, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_VECTOR_FIELD(obj, chunk_index, root);
+static DEFINE_HASH_TREE_ROOT_CONTAINER(Checkpoint, 2, HTR_CHECKPOINT_FIELDS)
+
+#define HTR_ATTESTATION_DATA_FIELDS                                                            \
+    HTR_BASIC_FIELD(obj, chunk_index, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);   \
+    HTR_BASIC_FIELD(obj, chunk_index, index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);  \
+    HTR_VECTOR_FIELD(obj, chunk_index, beacon_block_root);                                     \
+    HTR_CONTAINER_FIELD(obj, chunk_index, source, hash_tree_root_Checkpoint);                  \
+    HTR_CONTAINER_FIELD(obj, chunk_index, target, hash_tree_root_Checkpoint);
+static DEFINE_HASH_TREE_ROOT_CONTAINER(AttestationData, 5, HTR_ATTESTATION_DATA_FIELDS)
+
+#define HTR_ATTESTATION_FIELDS                                                               \
+    HTR_BITLIST_FIELD(obj, chunk_index, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);    \
+    HTR_CONTAINER_FIELD(obj, chunk_index, data, hash_tree_root_AttestationData);            \
+    HTR_VECTOR_FIELD(obj, chunk_index, signature);
+static DEFINE_HASH_TREE_ROOT_CONTAINER(Attestation, 3, HTR_ATTESTATION_FIELDS)
+
+static ssz_error_t attestation_field_roots(const Attestation *obj, uint8_t field_roots[][SSZ_BYTES_PER_CHUNK])
 {
-    size_t chunk_count;
-    size_t alloc_size = ((96 + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK) * SSZ_BYTES_PER_CHUNK;
-    uint8_t *packed = malloc(alloc_size);
-    if (!packed)
-        return SSZ_ERROR_SERIALIZATION;
-    ssz_error_t err = ssz_pack(signature, 1, 96, packed, &chunk_count);
-    if (err != SSZ_SUCCESS)
-    {
-        free(packed);
-        return err;
-    }
-    err = ssz_merkleize(packed, chunk_count, 0, out_root);
-    free(packed);
-    return err;
+    size_t chunk_index = 0;
+    HTR_ATTESTATION_FIELDS
+    return SSZ_SUCCESS;
 }
 
-static ssz_error_t hash_tree_root_attestation(const Attestation *att, uint8_t *out_root)
+static void attestation_bench_func_name_hash_tree_root(void *user_data)
 {
-    uint8_t root_agg[32], root_data[32], root_signature[32];
-    ssz_error_t err = hash_tree_root_aggregation_bits(&att->aggregation_bits, root_agg);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_attestation_data(&att->data, root_data);
-    if (err != SSZ_SUCCESS)
-        return err;
-    err = hash_tree_root_signature(att->signature, root_signature);
-    if (err != SSZ_SUCCESS)
-        return err;
-    uint8_t nodes[3][32];
-    memcpy(nodes[0], root_agg, 32);
-    memcpy(nodes[1], root_data, 32);
-    memcpy(nodes[2], root_signature, 32);
-    return ssz_merkleize((uint8_t *)nodes, 3, 0, out_root);
+    (void)user_data;
+    uint8_t root[SSZ_BYTES_PER_CHUNK];
+    hash_tree_root_Attestation(&g_original, root);
 }
 
 static void print_attestation_tree(const Attestation *att)
 {
-    uint8_t root_agg[32], root_data[32], root_signature[32], final_root[32];
-    if (hash_tree_root_aggregation_bits(&att->aggregation_bits, root_agg) != SSZ_SUCCESS)
-    {
-        printf("Error computing aggregation_bits root\n");
-        return;
-    }
-    if (hash_tree_root_attestation_data(&att->data, root_data) != SSZ_SUCCESS)
-    {
-        printf("Error computing data root\n");
-        return;
-    }
-    if (hash_tree_root_signature(att->signature, root_signature) != SSZ_SUCCESS)
+    uint8_t nodes[4][32];
+    uint8_t final_root[32];
+    if (attestation_field_roots(att, nodes) != SSZ_SUCCESS)
     {
-        printf("Error computing signature root\n");
+        printf("Error computing field roots\n");
         return;
     }
     printf("Leaves:\n");
     printf("  aggregation_bits: 0x");
-    print_hex(root_agg, 32);
+    print_hex(nodes[0], 32);
     printf("  data: 0x");
-    print_hex(root_data, 32);
+    print_hex(nodes[1], 32);
     printf("  signature: 0x");
-    print_hex(root_signature, 32);
-    uint8_t nodes[4][32];
-    memcpy(nodes[0], root_agg, 32);
-    memcpy(nodes[1], root_data, 32);
-    memcpy(nodes[2], root_signature, 32);
+    print_hex(nodes[2], 32);
     memset(nodes[3], 0, 32);
     printf("Level 1:\n");
     uint8_t parent[2][32];
@@ -664,9 +412,14 @@ int main(void)
     init_attestation_data_from_yaml();
     bench_stats_t stats_serialize = bench_run_benchmark(attestation_bench_func_name_serialize, NULL, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
     bench_stats_t stats_deserialize = bench_run_benchmark(attestation_bench_func_name_deserialize, NULL, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
+    memcpy(g_malformed, g_serialized, g_serialized_size);
+    g_malformed[g_serialized_size - 1] = 0;
+    bench_stats_t stats_validate = bench_run_benchmark(attestation_bench_func_name_validate, NULL, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
+    bench_stats_t stats_validate_reject = bench_run_benchmark(attestation_bench_func_name_validate_reject, NULL, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
+    bench_stats_t stats_hash_tree_root = bench_run_benchmark(attestation_bench_func_name_hash_tree_root, NULL, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
     print_attestation(&g_original);
     uint8_t merkle_root[32];
-    if (hash_tree_root_attestation(&g_original, merkle_root) == SSZ_SUCCESS)
+    if (hash_tree_root_Attestation(&g_original, merkle_root) == SSZ_SUCCESS)
     {
         printf("\nDetailed Merkle Tree:\n");
         print_attestation_tree(&g_original);
@@ -679,5 +432,8 @@ int main(void)
     print_hex(g_serialized, g_serialized_size);
     bench_print_stats("SSZ Attestation serialization", &stats_serialize);
     bench_print_stats("SSZ Attestation deserialization", &stats_deserialize);
+    bench_print_stats("SSZ Attestation validate", &stats_validate);
+    bench_print_stats("SSZ Attestation validate (malformed)", &stats_validate_reject);
+    bench_print_stats("SSZ Attestation hash_tree_root", &stats_hash_tree_root);
     return 0;
 }
\ No newline at end of file
@@ -11,11 +11,13 @@
 #include "yaml_parser.h"
 #include "ssz_merkle.h"
 #include "ssz_utils.h"
+#include "ssz_generator.h"
 
 #define YAML_FILE_PATH "./bench/data/IndexedAttestation/ssz_random/case_0/indexed_attestation.yaml"
 #define MAX_VALIDATORS_PER_COMMITTEE 2048
 #define BENCH_ITER_WARMUP 500
 #define BENCH_ITER_MEASURED 1000
+#define SIZE_INDEXED_ATTESTATION_FIXED (SSZ_BYTES_PER_LENGTH_OFFSET + 128 + 96)
 
 typedef struct
 {
@@ -545,6 +547,30 @@ static void attestation_bench_func_name_deserialize(void *user_data)
     }
 }
 
+#define VALIDATE_INDEXED_ATTESTATION_FIELDS \
+    VIEW_LIST_FIELD(0, SSZ_VIEW_END, SSZ_BYTE_SIZE_OF_UINT64, MAX_VALIDATORS_PER_COMMITTEE);
+static DEFINE_VALIDATE_CONTAINER(IndexedAttestation, SIZE_INDEXED_ATTESTATION_FIXED, VALIDATE_INDEXED_ATTESTATION_FIELDS)
+
+static uint8_t g_malformed[2000];
+
+static void attestation_bench_func_name_validate(void *user_data)
+{
+    (void)user_data;
+    if (ssz_validate_IndexedAttestation(g_serialized, g_serialized_size) != SSZ_SUCCESS)
+    {
+        printf("Failed to validate\n");
+    }
+}
+
+static void attestation_bench_func_name_validate_reject(void *user_data)
+{
+    (void)user_data;
+    if (ssz_validate_IndexedAttestation(g_malformed, g_serialized_size - 1) == SSZ_SUCCESS)
+    {
+        printf("Malformed indexed attestation was accepted\n");
+    }
+}
+
 static ssz_error_t hash_tree_root_uint64(uint64_t value, uint8_t *out_root)
 {
     uint8_t buf[8];
@@ -622,25 +648,7 @@ static ssz_error_t hash_tree_root_attestation_data(const AttestationData *data,
 
 static ssz_error_t hash_tree_root_attesting_indices(const AttestingIndices *indices, uint8_t *out_root)
 {
-    size_t total_bytes = indices->length * 8;
-    size_t chunk_count;
-    size_t alloc_size = ((total_bytes + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK) * SSZ_BYTES_PER_CHUNK;
-    uint8_t *packed = malloc(alloc_size);
-    if (!packed)
-        return SSZ_ERROR_SERIALIZATION;
-    ssz_error_t err = ssz_pack((uint8_t *)indices->data, 8, indices->length, packed, &chunk_count);
-    if (err != SSZ_SUCCESS)
-    {
-        free(packed);
-        return err;
-    }
-    size_t limit = (MAX_VALIDATORS_PER_COMMITTEE * 8 + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
-    uint8_t merkleized[32];
-    err = ssz_merkleize(packed, chunk_count, limit, merkleized);
-    free(packed);
-    if (err != SSZ_SUCCESS)
-        return err;
-    return ssz_mix_in_length(merkleized, indices->length, out_root);
+    return ssz_hash_tree_root_basic_list(indices->data, 8, indices->length, MAX_VALIDATORS_PER_COMMITTEE, out_root);
 }
 
 static ssz_error_t hash_tree_root_signature(const uint8_t *signature, uint8_t *out_root)
@@ -743,6 +751,17 @@ int main(void)
         NULL,
         BENCH_ITER_WARMUP,
         BENCH_ITER_MEASURED);
+    memcpy(g_malformed, g_serialized, g_serialized_size);
+    bench_stats_t stats_validate = bench_run_benchmark(
+        attestation_bench_func_name_validate,
+        NULL,
+        BENCH_ITER_WARMUP,
+        BENCH_ITER_MEASURED);
+    bench_stats_t stats_validate_reject = bench_run_benchmark(
+        attestation_bench_func_name_validate_reject,
+        NULL,
+        BENCH_ITER_WARMUP,
+        BENCH_ITER_MEASURED);
     print_attestation(&g_original);
     uint8_t merkle_root[32];
     if (hash_tree_root_indexed_attestation(&g_original, merkle_root) == SSZ_SUCCESS)
@@ -758,5 +777,7 @@ int main(void)
     print_hex(g_serialized, g_serialized_size);
     bench_print_stats("SSZ Indexed Attestation serialization", &stats_serialize);
     bench_print_stats("SSZ Indexed Attestation deserialization", &stats_deserialize);
+    bench_print_stats("SSZ Indexed Attestation validate", &stats_validate);
+    bench_print_stats("SSZ Indexed Attestation validate (malformed)", &stats_validate_reject);
     return 0;
 }
\ No newline at end of file
@@ -1,10 +1,14 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "bench.h"
 #include "ssz_constants.h"
 #include "ssz_merkle.h"
+#include "ssz_pool.h"
+#include "ssz_proof.h"
+#include "ssz_tree.h"
 
 #define BENCH_ITER_WARMUP_MERKLEIZE 5000
 #define BENCH_ITER_MEASURED_MERKLEIZE 10000
@@ -16,6 +20,26 @@
 #define BENCH_ITER_MEASURED_MIX_LENGTH 10000
 #define BENCH_ITER_WARMUP_MIX_SELECTOR 5000
 #define BENCH_ITER_MEASURED_MIX_SELECTOR 10000
+#define BENCH_ITER_WARMUP_HASH_PAIRS 50
+#define BENCH_ITER_MEASURED_HASH_PAIRS 200
+#define BENCH_ITER_WARMUP_MERKLEIZE_WIDE 5
+#define BENCH_ITER_MEASURED_MERKLEIZE_WIDE 20
+#define BENCH_HASH_PAIRS_COUNT 4096
+#define BENCH_MERKLEIZE_WIDE_CHUNKS 65536
+#define BENCH_MERKLEIZER_PUSH_CHUNKS 1024
+#define BENCH_ITER_WARMUP_MERKLEIZE_PARALLEL 2
+#define BENCH_ITER_MEASURED_MERKLEIZE_PARALLEL 10
+#define BENCH_MERKLEIZE_PARALLEL_CHUNKS (1 << 20)
+#define BENCH_ITER_WARMUP_TREE_ROOT 50
+#define BENCH_ITER_MEASURED_TREE_ROOT 500
+#define BENCH_TREE_UPDATES 16
+#define BENCH_ITER_WARMUP_VERIFY_BRANCHES 5
+#define BENCH_ITER_MEASURED_VERIFY_BRANCHES 50
+#define BENCH_VERIFY_BRANCHES_PROOFS 1024
+#define BENCH_ITER_WARMUP_BASIC_LIST 2
+#define BENCH_ITER_MEASURED_BASIC_LIST 10
+#define BENCH_BASIC_LIST_ELEMENTS (1 << 20)
+#define BENCH_BASIC_LIST_LIMIT ((size_t)1 << 40)
 
 typedef struct {
     uint8_t chunks[64 * SSZ_BYTES_PER_CHUNK];
@@ -23,6 +47,39 @@ typedef struct {
     size_t limit;
 } ssz_merkleize_test_t;
 
+typedef struct {
+    uint8_t *in;
+    uint8_t *out;
+    size_t n_pairs;
+} ssz_hash_pairs_test_t;
+
+typedef struct {
+    uint8_t *chunks;
+    size_t chunk_count;
+    size_t limit;
+} ssz_merkleize_wide_test_t;
+
+typedef struct {
+    ssz_tree_t tree;
+    uint8_t chunk[SSZ_BYTES_PER_CHUNK];
+    uint32_t seed;
+} ssz_tree_root_test_t;
+
+typedef struct {
+    uint8_t *leaves;
+    uint8_t *branch_data;
+    const uint8_t **branches;
+    uint64_t *gindices;
+    bool *valid;
+    size_t count;
+    uint8_t root[SSZ_BYTES_PER_CHUNK];
+} ssz_verify_branches_test_t;
+
+typedef struct {
+    uint64_t *balances;
+    size_t count;
+} ssz_basic_list_test_t;
+
 typedef struct {
     uint8_t values[1024];
     size_t value_size;
@@ -50,6 +107,90 @@ static void test_merkleize(void *user_data) {
     ssz_merkleize(test->chunks, test->chunk_count, test->limit, out_root);
 }
 
+static void test_hash_pairs(void *user_data) {
+    ssz_hash_pairs_test_t *test = (ssz_hash_pairs_test_t *)user_data;
+    ssz_hash_pairs(test->in, test->n_pairs, test->out);
+}
+
+static void test_merkleize_wide(void *user_data) {
+    ssz_merkleize_wide_test_t *test = (ssz_merkleize_wide_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    ssz_merkleize(test->chunks, test->chunk_count, test->limit, out_root);
+}
+
+static void test_merkleize_parallel(void *user_data) {
+    ssz_merkleize_wide_test_t *test = (ssz_merkleize_wide_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    ssz_merkleize_parallel(test->chunks, test->chunk_count, test->limit, out_root);
+}
+
+static void test_tree_root(void *user_data) {
+    ssz_tree_root_test_t *test = (ssz_tree_root_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    for (size_t i = 0; i < BENCH_TREE_UPDATES; i++) {
+        test->seed = test->seed * 1103515245u + 12345u;
+        test->chunk[0] = (uint8_t)test->seed;
+        ssz_tree_set_chunk(&test->tree, test->seed % test->tree.chunk_count, test->chunk);
+    }
+    ssz_tree_root(&test->tree, out_root);
+}
+
+static void test_verify_branches(void *user_data) {
+    ssz_verify_branches_test_t *test = (ssz_verify_branches_test_t *)user_data;
+    ssz_verify_branches(test->leaves, test->branches, test->gindices, test->count, test->root, test->valid);
+}
+
+static void test_verify_branches_sequential(void *user_data) {
+    ssz_verify_branches_test_t *test = (ssz_verify_branches_test_t *)user_data;
+    for (size_t i = 0; i < test->count; i++) {
+        uint8_t buf[2 * SSZ_BYTES_PER_CHUNK];
+        memcpy(buf, test->leaves + i * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+        size_t level = 0;
+        for (uint64_t g = test->gindices[i]; g > 1; g >>= 1, level++) {
+            const uint8_t *sibling = test->branches[i] + level * SSZ_BYTES_PER_CHUNK;
+            if (g & 1) {
+                memmove(buf + SSZ_BYTES_PER_CHUNK, buf, SSZ_BYTES_PER_CHUNK);
+                memcpy(buf, sibling, SSZ_BYTES_PER_CHUNK);
+            } else {
+                memcpy(buf + SSZ_BYTES_PER_CHUNK, sibling, SSZ_BYTES_PER_CHUNK);
+            }
+            ssz_hash_pairs(buf, 1, buf);
+        }
+        test->valid[i] = memcmp(buf, test->root, SSZ_BYTES_PER_CHUNK) == 0;
+    }
+}
+
+static void test_basic_list_fused(void *user_data) {
+    ssz_basic_list_test_t *test = (ssz_basic_list_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    ssz_hash_tree_root_basic_list(test->balances, sizeof(uint64_t), test->count, BENCH_BASIC_LIST_LIMIT, out_root);
+}
+
+static void test_basic_list_pack(void *user_data) {
+    ssz_basic_list_test_t *test = (ssz_basic_list_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    size_t chunk_count = 0;
+    uint8_t *chunks = malloc(test->count * sizeof(uint64_t) + SSZ_BYTES_PER_CHUNK);
+    if (!chunks) {
+        return;
+    }
+    ssz_pack((const uint8_t *)test->balances, sizeof(uint64_t), test->count, chunks, &chunk_count);
+    ssz_merkleize(chunks, chunk_count, BENCH_BASIC_LIST_LIMIT * sizeof(uint64_t) / SSZ_BYTES_PER_CHUNK, out_root);
+    ssz_mix_in_length(out_root, test->count, out_root);
+    free(chunks);
+}
+
+static void test_merkleizer_stream(void *user_data) {
+    ssz_merkleize_wide_test_t *test = (ssz_merkleize_wide_test_t *)user_data;
+    uint8_t out_root[SSZ_BYTES_PER_CHUNK];
+    ssz_merkleizer_t m;
+    ssz_merkleizer_init(&m, test->limit);
+    for (size_t pos = 0; pos < test->chunk_count; pos += BENCH_MERKLEIZER_PUSH_CHUNKS) {
+        ssz_merkleizer_push_chunks(&m, test->chunks + pos * SSZ_BYTES_PER_CHUNK, BENCH_MERKLEIZER_PUSH_CHUNKS);
+    }
+    ssz_merkleizer_finalize(&m, out_root);
+}
+
 static void test_pack(void *user_data) {
     ssz_pack_test_t *test = (ssz_pack_test_t *)user_data;
     uint8_t out_chunks[2048];
@@ -85,6 +226,132 @@ static void run_merkleize_benchmarks(void) {
     bench_print_stats("Benchmark ssz_merkleize", &stats);
 }
 
+static void run_hash_pairs_benchmarks(void) {
+    ssz_hash_pairs_test_t test_data;
+    test_data.n_pairs = BENCH_HASH_PAIRS_COUNT;
+    test_data.in = malloc(test_data.n_pairs * 2 * SSZ_BYTES_PER_CHUNK);
+    test_data.out = malloc(test_data.n_pairs * SSZ_BYTES_PER_CHUNK);
+    if (!test_data.in || !test_data.out) {
+        free(test_data.in);
+        free(test_data.out);
+        return;
+    }
+    memset(test_data.in, 0xAB, test_data.n_pairs * 2 * SSZ_BYTES_PER_CHUNK);
+    bench_stats_t stats = bench_run_benchmark(test_hash_pairs, &test_data, BENCH_ITER_WARMUP_HASH_PAIRS, BENCH_ITER_MEASURED_HASH_PAIRS);
+    bench_print_stats("Benchmark ssz_hash_pairs (4096 pairs)", &stats);
+    free(test_data.in);
+    free(test_data.out);
+}
+
+static void run_merkleize_wide_benchmarks(void) {
+    ssz_merkleize_wide_test_t test_data;
+    test_data.chunk_count = BENCH_MERKLEIZE_WIDE_CHUNKS;
+    test_data.limit = BENCH_MERKLEIZE_WIDE_CHUNKS;
+    test_data.chunks = malloc(test_data.chunk_count * SSZ_BYTES_PER_CHUNK);
+    if (!test_data.chunks) {
+        return;
+    }
+    memset(test_data.chunks, 0x5A, test_data.chunk_count * SSZ_BYTES_PER_CHUNK);
+    bench_stats_t stats = bench_run_benchmark(test_merkleize_wide, &test_data, BENCH_ITER_WARMUP_MERKLEIZE_WIDE, BENCH_ITER_MEASURED_MERKLEIZE_WIDE);
+    bench_print_stats("Benchmark ssz_merkleize (65536 chunks)", &stats);
+    stats = bench_run_benchmark(test_merkleizer_stream, &test_data, BENCH_ITER_WARMUP_MERKLEIZE_WIDE, BENCH_ITER_MEASURED_MERKLEIZE_WIDE);
+    bench_print_stats("Benchmark ssz_merkleizer (65536 chunks, 1024 per push)", &stats);
+    free(test_data.chunks);
+}
+
+static void run_merkleize_parallel_benchmarks(void) {
+    static const size_t thread_counts[] = {1, 2, 4, 8, 16, 32};
+    ssz_merkleize_wide_test_t test_data;
+    test_data.chunk_count = BENCH_MERKLEIZE_PARALLEL_CHUNKS;
+    test_data.limit = (size_t)1 << 40;
+    test_data.chunks = malloc(test_data.chunk_count * SSZ_BYTES_PER_CHUNK);
+    if (!test_data.chunks) {
+        return;
+    }
+    memset(test_data.chunks, 0x3C, test_data.chunk_count * SSZ_BYTES_PER_CHUNK);
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++) {
+        char label[96];
+        ssz_pool_set_threads(thread_counts[i]);
+        snprintf(label, sizeof(label), "Benchmark ssz_merkleize_parallel (2^20 chunks, %zu threads)", thread_counts[i]);
+        bench_stats_t stats = bench_run_benchmark(test_merkleize_parallel, &test_data, BENCH_ITER_WARMUP_MERKLEIZE_PARALLEL, BENCH_ITER_MEASURED_MERKLEIZE_PARALLEL);
+        bench_print_stats(label, &stats);
+    }
+    ssz_pool_set_threads(0);
+    free(test_data.chunks);
+}
+
+static void run_tree_root_benchmarks(void) {
+    ssz_tree_root_test_t test_data;
+    size_t chunk_count = BENCH_MERKLEIZE_PARALLEL_CHUNKS;
+    uint8_t *chunks = malloc(chunk_count * SSZ_BYTES_PER_CHUNK);
+    if (!chunks) {
+        return;
+    }
+    memset(chunks, 0x3C, chunk_count * SSZ_BYTES_PER_CHUNK);
+    memset(test_data.chunk, 0x11, sizeof(test_data.chunk));
+    test_data.seed = 1;
+    if (ssz_tree_init(&test_data.tree, chunks, chunk_count, (size_t)1 << 40) == SSZ_SUCCESS) {
+        bench_stats_t stats = bench_run_benchmark(test_tree_root, &test_data, BENCH_ITER_WARMUP_TREE_ROOT, BENCH_ITER_MEASURED_TREE_ROOT);
+        bench_print_stats("Benchmark ssz_tree_root (2^20 chunks, 16 dirty leaves)", &stats);
+        ssz_tree_free(&test_data.tree);
+    }
+    free(chunks);
+}
+
+static void run_verify_branches_benchmarks(void) {
+    ssz_verify_branches_test_t test_data;
+    size_t count = BENCH_VERIFY_BRANCHES_PROOFS;
+    size_t branch_size = 64 * SSZ_BYTES_PER_CHUNK;
+    ssz_tree_t tree;
+    test_data.count = count;
+    test_data.leaves = malloc(count * SSZ_BYTES_PER_CHUNK);
+    test_data.branch_data = malloc(count * branch_size);
+    test_data.branches = malloc(count * sizeof(const uint8_t *));
+    test_data.gindices = malloc(count * sizeof(uint64_t));
+    test_data.valid = malloc(count * sizeof(bool));
+    if (test_data.leaves && test_data.branch_data && test_data.branches && test_data.gindices && test_data.valid) {
+        for (size_t i = 0; i < count * SSZ_BYTES_PER_CHUNK; i++) {
+            test_data.leaves[i] = (uint8_t)(i * 31 + 7);
+        }
+        if (ssz_tree_init(&tree, test_data.leaves, count, (size_t)1 << 32) == SSZ_SUCCESS) {
+            ssz_tree_root(&tree, test_data.root);
+            for (size_t i = 0; i < count; i++) {
+                size_t depth = 0;
+                test_data.gindices[i] = ((uint64_t)1 << 32) + i;
+                test_data.branches[i] = test_data.branch_data + i * branch_size;
+                ssz_tree_proof(&tree, test_data.gindices[i], test_data.branch_data + i * branch_size, &depth);
+            }
+            ssz_tree_free(&tree);
+            bench_stats_t stats = bench_run_benchmark(test_verify_branches, &test_data, BENCH_ITER_WARMUP_VERIFY_BRANCHES, BENCH_ITER_MEASURED_VERIFY_BRANCHES);
+            bench_print_stats("Benchmark ssz_verify_branches (1024 deposit proofs, depth 32)", &stats);
+            stats = bench_run_benchmark(test_verify_branches_sequential, &test_data, BENCH_ITER_WARMUP_VERIFY_BRANCHES, BENCH_ITER_MEASURED_VERIFY_BRANCHES);
+            bench_print_stats("Benchmark sequential branch checks (1024 deposit proofs, depth 32)", &stats);
+        }
+    }
+    free(test_data.leaves);
+    free(test_data.branch_data);
+    free(test_data.branches);
+    free(test_data.gindices);
+    free(test_data.valid);
+}
+
+static void run_basic_list_benchmarks(void) {
+    ssz_basic_list_test_t test_data;
+    test_data.count = BENCH_BASIC_LIST_ELEMENTS;
+    test_data.balances = malloc(test_data.count * sizeof(uint64_t));
+    if (!test_data.balances) {
+        return;
+    }
+    for (size_t i = 0; i < test_data.count; i++) {
+        test_data.balances[i] = 32000000000ULL + i;
+    }
+    bench_stats_t stats = bench_run_benchmark(test_basic_list_fused, &test_data, BENCH_ITER_WARMUP_BASIC_LIST, BENCH_ITER_MEASURED_BASIC_LIST);
+    bench_print_stats("Benchmark ssz_hash_tree_root_basic_list (2^20 uint64)", &stats);
+    stats = bench_run_benchmark(test_basic_list_pack, &test_data, BENCH_ITER_WARMUP_BASIC_LIST, BENCH_ITER_MEASURED_BASIC_LIST);
+    bench_print_stats("Benchmark ssz_pack + ssz_merkleize (2^20 uint64)", &stats);
+    free(test_data.balances);
+}
+
 static void run_pack_benchmarks(void) {
     ssz_pack_test_t test_data;
     memset(test_data.values, 0x55, sizeof(test_data.values));
@@ -122,6 +389,12 @@ static void run_mix_in_selector_benchmarks(void) {
 
 static void run_all_benchmarks(void) {
     run_merkleize_benchmarks();
+    run_hash_pairs_benchmarks();
+    run_merkleize_wide_benchmarks();
+    run_merkleize_parallel_benchmarks();
+    run_tree_root_benchmarks();
+    run_verify_branches_benchmarks();
+    run_basic_list_benchmarks();
     run_pack_benchmarks();
     run_pack_bits_benchmarks();
     run_mix_in_length_benchmarks();
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "bench.h"
+#include "ssz_deserialize.h"
+#include "ssz_constants.h"
+#include "ssz_pool.h"
+#include "ssz_arena.h"
+#include "ssz_generator.h"
+
+#define BENCH_VALIDATOR_COUNT (1 << 20)
+#define BENCH_ITER_WARMUP 1
+#define BENCH_ITER_MEASURED 5
+#define SIZE_VALIDATOR (48 + 32 + 8 + 1 + 8 + 8 + 8 + 8)
+
+typedef struct
+{
+    uint8_t pubkey[48];
+    uint8_t withdrawal_credentials[32];
+    uint64_t effective_balance;
+    bool slashed;
+    uint64_t activation_eligibility_epoch;
+    uint64_t activation_epoch;
+    uint64_t exit_epoch;
+    uint64_t withdrawable_epoch;
+} Validator;
+
+typedef struct
+{
+    uint64_t length;
+    Validator *data;
+} Validators;
+
+#define DESERIALIZE_VALIDATOR_FIELDS                                                             \
+    DESERIALIZE_VECTOR_FIELD(obj, offset, pubkey, ssz_deserialize_vector_uint8);                 \
+    DESERIALIZE_VECTOR_FIELD(obj, offset, withdrawal_credentials, ssz_deserialize_vector_uint8); \
+    DESERIALIZE_BASIC_FIELD(obj, offset, effective_balance, ssz_deserialize_uint64);             \
+    DESERIALIZE_BASIC_FIELD(obj, offset, slashed, ssz_deserialize_boolean);                      \
+    DESERIALIZE_BASIC_FIELD(obj, offset, activation_eligibility_epoch, ssz_deserialize_uint64);  \
+    DESERIALIZE_BASIC_FIELD(obj, offset, activation_epoch, ssz_deserialize_uint64);              \
+    DESERIALIZE_BASIC_FIELD(obj, offset, exit_epoch, ssz_deserialize_uint64);                    \
+    DESERIALIZE_BASIC_FIELD(obj, offset, withdrawable_epoch, ssz_deserialize_uint64);
+static DEFINE_DESERIALIZE_CONTAINER(Validator, DESERIALIZE_VALIDATOR_FIELDS)
+static DEFINE_DESERIALIZE_LIST(Validators, Validator, SIZE_VALIDATOR, deserialize_Validator)
+static DEFINE_DESERIALIZE_LIST_PARALLEL(Validators, Validator, SIZE_VALIDATOR, deserialize_Validator)
+
+typedef struct
+{
+    uint8_t *serialized;
+    size_t serialized_size;
+    ssz_arena_t arena;
+    Validators validators;
+} validators_bench_t;
+
+static void validators_bench_deserialize(void *user_data)
+{
+    validators_bench_t *bench = (validators_bench_t *)user_data;
+    ssz_arena_reset(&bench->arena);
+    if (deserialize_Validators_arena(bench->serialized, bench->serialized_size, &bench->validators,
+                                     &bench->arena) != SSZ_SUCCESS)
+    {
+        printf("Failed to deserialize\n");
+    }
+}
+
+static void validators_bench_deserialize_parallel(void *user_data)
+{
+    validators_bench_t *bench = (validators_bench_t *)user_data;
+    size_t error_index = 0;
+    ssz_arena_reset(&bench->arena);
+    if (deserialize_Validators_parallel(bench->serialized, bench->serialized_size, &bench->validators,
+                                        &bench->arena, &error_index) != SSZ_SUCCESS)
+    {
+        printf("Failed to deserialize validator %zu\n", error_index);
+    }
+}
+
+int main(void)
+{
+    static const size_t thread_counts[] = {1, 2, 4, 8, 16, 32};
+    validators_bench_t bench;
+    bench.serialized_size = (size_t)BENCH_VALIDATOR_COUNT * SIZE_VALIDATOR;
+    bench.serialized = malloc(bench.serialized_size);
+    if (!bench.serialized)
+    {
+        fprintf(stderr, "Failed to allocate %zu bytes\n", bench.serialized_size);
+        return 1;
+    }
+    for (size_t i = 0; i < bench.serialized_size; i++)
+    {
+        bench.serialized[i] = (uint8_t)(i * 31 + 7);
+    }
+    for (size_t i = 0; i < BENCH_VALIDATOR_COUNT; i++)
+    {
+        bench.serialized[i * SIZE_VALIDATOR + 48 + 32 + 8] = (uint8_t)(i & 1);
+    }
+    ssz_arena_init(&bench.arena, (size_t)BENCH_VALIDATOR_COUNT * sizeof(Validator));
+
+    bench_stats_t stats = bench_run_benchmark(validators_bench_deserialize, &bench, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
+    bench_print_stats("SSZ Validators deserialization (2^20 validators)", &stats);
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++)
+    {
+        char label[96];
+        ssz_pool_set_threads(thread_counts[i]);
+        snprintf(label, sizeof(label), "SSZ Validators parallel deserialization (2^20 validators, %zu threads)",
+                 thread_counts[i]);
+        stats = bench_run_benchmark(validators_bench_deserialize_parallel, &bench, BENCH_ITER_WARMUP, BENCH_ITER_MEASURED);
+        bench_print_stats(label, &stats);
+    }
+    ssz_pool_set_threads(0);
+
+    ssz_arena_free(&bench.arena);
+    free(bench.serialized);
+    return 0;
+}
@@ -0,0 +1,96 @@
+#ifndef SSZ_ARENA_H
+#define SSZ_ARENA_H
+
+#include <stddef.h>
+#include "ssz_types.h"
+
+/**
+ * One block of memory owned by an arena. Blocks form a singly linked list.
+ */
+typedef struct ssz_arena_block
+{
+    struct ssz_arena_block *next; /**< Next block in the chain, or NULL. */
+    size_t size;                  /**< Usable bytes in this block. */
+} ssz_arena_block_t;
+
+/**
+ * A bump allocator for deserialized data.
+ *
+ * Allocations are carved from a chain of blocks and are never freed individually; the whole
+ * arena is recycled with ssz_arena_reset, which keeps the blocks for reuse, or released with
+ * ssz_arena_free. Passing an arena to the generated deserialize_<Type>_arena functions puts
+ * every nested list of a decoded object into it.
+ */
+typedef struct
+{
+    ssz_arena_block_t *head;    /**< First block, or NULL before the first allocation. */
+    ssz_arena_block_t *current; /**< Block that allocations are currently taken from. */
+    size_t used;                /**< Bytes used in the current block. */
+    size_t block_size;          /**< Minimum size of newly allocated blocks. */
+} ssz_arena_t;
+
+/**
+ * Initializes an empty arena. No memory is allocated until the first ssz_arena_alloc.
+ *
+ * @param arena Pointer to the arena to initialize.
+ * @param block_size Minimum size of each block in bytes; 0 selects a default of 64 KiB.
+ */
+void ssz_arena_init(
+    ssz_arena_t *arena,
+    size_t block_size);
+
+/**
+ * Allocates size bytes aligned for any basic type.
+ *
+ * When arena is NULL the memory comes from malloc instead, so that the generated
+ * deserializers can share one code path for both allocation strategies.
+ *
+ * @param arena Pointer to the arena, or NULL to use malloc.
+ * @param size Number of bytes.
+ * @return Pointer to the memory, or NULL if no memory is available.
+ */
+void *ssz_arena_alloc(
+    ssz_arena_t *arena,
+    size_t size);
+
+/**
+ * Releases memory obtained from ssz_arena_alloc.
+ *
+ * This is a no-op for arena memory, which is only reclaimed by ssz_arena_reset or
+ * ssz_arena_free, and calls free when arena is NULL.
+ *
+ * @param arena Pointer to the arena the memory came from, or NULL.
+ * @param ptr Pointer returned by ssz_arena_alloc, or NULL.
+ */
+void ssz_arena_release(
+    ssz_arena_t *arena,
+    void *ptr);
+
+/**
+ * Makes all memory of the arena available again in O(1), keeping its blocks.
+ *
+ * Every pointer previously returned by the arena becomes invalid.
+ *
+ * @param arena Pointer to the arena.
+ */
+void ssz_arena_reset(
+    ssz_arena_t *arena);
+
+/**
+ * Frees every block of the arena and leaves it empty but usable.
+ *
+ * @param arena Pointer to the arena.
+ */
+void ssz_arena_free(
+    ssz_arena_t *arena);
+
+/**
+ * Returns the total number of bytes held in the arena's blocks.
+ *
+ * @param arena Pointer to the arena.
+ * @return The capacity in bytes.
+ */
+size_t ssz_arena_capacity(
+    const ssz_arena_t *arena);
+
+#endif /* SSZ_ARENA_H */
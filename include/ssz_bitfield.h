@@ -0,0 +1,206 @@
+#ifndef SSZ_BITFIELD_H
+#define SSZ_BITFIELD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssz_types.h"
+
+/**
+ * Number of 64-bit words needed to hold the given number of bits.
+ */
+#define SSZ_BITFIELD_WORDS(bits) (((bits) + 63) / 64)
+
+/**
+ * A bitvector stored as packed 64-bit words.
+ *
+ * Bit i lives in words[i / 64] at position i % 64, so on little-endian hosts the words have
+ * exactly the byte layout of the serialized bitvector. All bits at or above length in the
+ * last word must be zero; every function in this module preserves that.
+ */
+typedef struct
+{
+    uint64_t *words; /**< Packed bits, SSZ_BITFIELD_WORDS(length) words. */
+    size_t length;   /**< Number of bits. */
+} ssz_bitvector_t;
+
+/**
+ * A bitlist stored as packed 64-bit words, without the delimiter bit.
+ *
+ * The layout and zero-padding rule are the same as for ssz_bitvector_t.
+ */
+typedef struct
+{
+    uint64_t *words; /**< Packed bits, at least SSZ_BITFIELD_WORDS(length) words. */
+    size_t length;   /**< Number of bits in the list. */
+} ssz_bitlist_t;
+
+/**
+ * Returns bit index of a packed bitfield.
+ *
+ * @param words Pointer to the packed words.
+ * @param index Index of the bit.
+ * @return The value of the bit.
+ */
+static inline bool ssz_bitfield_get(const uint64_t *words, size_t index)
+{
+    return (words[index >> 6] >> (index & 63)) & 1;
+}
+
+/**
+ * Sets or clears bit index of a packed bitfield.
+ *
+ * @param words Pointer to the packed words.
+ * @param index Index of the bit.
+ * @param value New value of the bit.
+ */
+static inline void ssz_bitfield_set(uint64_t *words, size_t index, bool value)
+{
+    uint64_t mask = (uint64_t)1 << (index & 63);
+    words[index >> 6] = value ? (words[index >> 6] | mask) : (words[index >> 6] & ~mask);
+}
+
+/**
+ * Packs an array of booleans into little-endian bit order.
+ *
+ * Bit i of the output is set when bits[i] is non-zero. (bit_count + 7) / 8 bytes are written
+ * and the unused high bits of the last byte are cleared. On x86 the conversion uses SSE2 or
+ * AVX2 byte-mask instructions when the CPU supports them, and a scalar loop otherwise.
+ *
+ * @param bits Pointer to bit_count booleans.
+ * @param bit_count Number of bits to pack.
+ * @param out_bytes Output buffer for (bit_count + 7) / 8 bytes.
+ */
+void ssz_bits_pack(
+    const bool *bits,
+    size_t bit_count,
+    uint8_t *out_bytes);
+
+/**
+ * Unpacks little-endian bits into an array of booleans.
+ *
+ * The inverse of ssz_bits_pack, dispatched the same way. Bits of the last byte at or above
+ * bit_count are ignored.
+ *
+ * @param bytes Pointer to (bit_count + 7) / 8 input bytes.
+ * @param bit_count Number of bits to unpack.
+ * @param out_bits Output array of bit_count booleans.
+ */
+void ssz_bits_unpack(
+    const uint8_t *bytes,
+    size_t bit_count,
+    bool *out_bits);
+
+/**
+ * Returns the name of the bool/bit conversion backend selected for this process.
+ *
+ * @return A static string such as "avx2", "sse2" or "scalar".
+ */
+const char *ssz_bits_backend(void);
+
+/**
+ * Allocates zeroed storage for a bitlist of up to max_bits bits and sets its length to 0.
+ *
+ * @param list Pointer to the bitlist to initialize.
+ * @param max_bits Maximum number of bits the list will hold.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_init(
+    ssz_bitlist_t *list,
+    size_t max_bits);
+
+/**
+ * Releases the storage of a bitlist allocated by ssz_bitlist_init or DESERIALIZE_PACKED_BITLIST_FIELD.
+ *
+ * @param list Pointer to the bitlist. Its words are set to NULL and its length to 0.
+ */
+void ssz_bitlist_free(
+    ssz_bitlist_t *list);
+
+/**
+ * Serializes a packed bitvector.
+ *
+ * The packed words are copied to the output as-is; no per-bit work is done.
+ *
+ * @param vec Pointer to the bitvector (length at least 1).
+ * @param out_buf Pointer to the output buffer to write the serialized data.
+ * @param out_size Pointer to the size of the output buffer. Updated with the number of bytes written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_serialize(
+    const ssz_bitvector_t *vec,
+    uint8_t *out_buf,
+    size_t *out_size);
+
+/**
+ * Deserializes a packed bitvector.
+ *
+ * The bytes are copied into the words in one pass, after checking that the unused high bits
+ * of the last byte are zero.
+ *
+ * @param buffer Pointer to the input buffer containing the serialized data.
+ * @param buffer_size The size of the input buffer in bytes. Must equal (vec->length + 7) / 8.
+ * @param vec Pointer to a bitvector whose length and words are set by the caller.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_deserialize(
+    const uint8_t *buffer,
+    size_t buffer_size,
+    ssz_bitvector_t *vec);
+
+/**
+ * Computes the hash tree root of a packed bitvector directly from its words.
+ *
+ * @param vec Pointer to the bitvector.
+ * @param out_root Output buffer to write the hash tree root (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_hash_tree_root(
+    const ssz_bitvector_t *vec,
+    uint8_t *out_root);
+
+/**
+ * Serializes a packed bitlist, appending the delimiter bit.
+ *
+ * @param list Pointer to the bitlist.
+ * @param out_buf Pointer to the output buffer to write the serialized data.
+ * @param out_size Pointer to the size of the output buffer. Updated with the number of bytes written (list->length / 8 + 1).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_serialize(
+    const ssz_bitlist_t *list,
+    uint8_t *out_buf,
+    size_t *out_size);
+
+/**
+ * Deserializes a packed bitlist, stripping the delimiter bit.
+ *
+ * The last byte must be non-zero; its highest set bit is the delimiter and gives the length,
+ * which must not exceed max_bits. The data bytes are copied into the words in one pass.
+ *
+ * @param buffer Pointer to the input buffer containing the serialized data.
+ * @param buffer_size The size of the input buffer in bytes.
+ * @param max_bits The maximum number of bits in the bitlist.
+ * @param list Pointer to a bitlist whose words hold at least SSZ_BITFIELD_WORDS(min(max_bits, 8 * buffer_size)) words.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_deserialize(
+    const uint8_t *buffer,
+    size_t buffer_size,
+    size_t max_bits,
+    ssz_bitlist_t *list);
+
+/**
+ * Computes the hash tree root of a packed bitlist directly from its words.
+ *
+ * @param list Pointer to the bitlist.
+ * @param max_bits The maximum number of bits in the bitlist.
+ * @param out_root Output buffer to write the hash tree root (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_hash_tree_root(
+    const ssz_bitlist_t *list,
+    size_t max_bits,
+    uint8_t *out_root);
+
+#endif /* SSZ_BITFIELD_H */
@@ -14,6 +14,11 @@
 #define SSZ_BYTE_SIZE_OF_UINT256    32
 #define SSZ_BYTE_SIZE_OF_BOOL       1
 #define SSZ_SMALL_BUFFER_SIZE       256
+#define SSZ_MAX_MERKLE_DEPTH        64
+#define SSZ_PARALLEL_MERKLEIZE_MIN_CHUNKS 16384
+#define SSZ_PARALLEL_MIN_SUBTREE_CHUNKS   1024
+#define SSZ_PARALLEL_DESERIALIZE_MIN_ELEMENTS 4096
+#define SSZ_PARALLEL_DESERIALIZE_MIN_RANGE    1024
 
 /**
  * Provides a lookup table to find the highest set bit for each byte value (0-255).
@@ -21,4 +26,10 @@
  */
 extern const int8_t highest_bit_table[256];
 
+/**
+ * Provides the roots of all-zero Merkle subtrees for depths 0 through SSZ_MAX_MERKLE_DEPTH.
+ * Entry d is the root of a subtree of 2^d zero chunks.
+ */
+extern const uint8_t zero_hashes[SSZ_MAX_MERKLE_DEPTH + 1][SSZ_BYTES_PER_CHUNK];
+
 #endif /* SSZ_CONSTANTS_H */
\ No newline at end of file
@@ -366,4 +366,46 @@ ssz_error_t ssz_deserialize_list_bool(
     size_t *out_actual_count
 );
 
+/**
+ * Defines the function type that deserializes one fixed-size list element.
+ *
+ * @param buffer Pointer to the serialized element.
+ * @param buffer_size The size of the serialized element in bytes.
+ * @param out_element Pointer to the element to fill.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+typedef ssz_error_t (*ssz_element_deserialize_fn)(
+    const uint8_t *buffer,
+    size_t buffer_size,
+    void *out_element
+);
+
+/**
+ * Deserializes the elements of a list of fixed-size elements using the built-in worker pool.
+ *
+ * The elements are split into contiguous ranges that are decoded concurrently. On failure
+ * the index of the first element that failed to deserialize is reported, which is the same
+ * for every run and thread count. Lists shorter than SSZ_PARALLEL_DESERIALIZE_MIN_ELEMENTS,
+ * or a pool with a single thread, are decoded serially on the calling thread. Element
+ * functions are called concurrently and must not share mutable state.
+ *
+ * @param buffer Pointer to the serialized elements.
+ * @param element_size The size of one serialized element in bytes.
+ * @param count Number of elements.
+ * @param out_elements Pointer to the array of decoded elements.
+ * @param element_stride Distance in bytes between consecutive decoded elements.
+ * @param deserialize_fn Function that deserializes one element.
+ * @param out_error_index Receives the index of the first failing element on error; may be NULL.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION if an element failed.
+ */
+ssz_error_t ssz_deserialize_fixed_list_parallel(
+    const uint8_t *buffer,
+    size_t element_size,
+    size_t count,
+    void *out_elements,
+    size_t element_stride,
+    ssz_element_deserialize_fn deserialize_fn,
+    size_t *out_error_index
+);
+
 #endif /* SSZ_DESERIALIZE_H */
\ No newline at end of file
@@ -7,6 +7,14 @@
 #include <string.h>
 #include <stdbool.h>
 #include "ssz_types.h"
+#include "ssz_deserialize.h"
+#include "ssz_merkle.h"
+#include "ssz_bitfield.h"
+#include "ssz_writer.h"
+#include "ssz_view.h"
+#include "ssz_arena.h"
+#include "ssz_reader.h"
+#include "ssz_utils.h"
 
 /*
  * Note: To improve portability for extremely large serializations, we use a 64-bit
@@ -165,6 +173,35 @@ typedef uint64_t ssz_offset_t;
         (offset) += tmp_size;                                                   \
     } while (0)
 
+#define SERIALIZE_PACKED_BITVECTOR_FIELD(obj, offset, field, bits)                                  \
+    do                                                                                             \
+    {                                                                                              \
+        size_t tmp_size = ((bits) + 7) / SSZ_BITS_PER_BYTE;                                        \
+        const ssz_bitvector_t _vec = {(uint64_t *)(obj)->field, (bits)};                           \
+        ssz_error_t err_local = ssz_bitvector_serialize(&_vec, out_buf + (size_t)(offset), &tmp_size); \
+        if (err_local != SSZ_SUCCESS)                                                              \
+        {                                                                                          \
+            return SSZ_ERROR_SERIALIZATION;                                                        \
+        }                                                                                          \
+        (offset) += tmp_size;                                                                      \
+    } while (0)
+
+#define SERIALIZE_PACKED_BITLIST_FIELD(obj, offset, field, max_bits)                                           \
+    do                                                                                                        \
+    {                                                                                                         \
+        if ((obj)->field.length > (max_bits))                                                                 \
+        {                                                                                                     \
+            return SSZ_ERROR_SERIALIZATION;                                                                   \
+        }                                                                                                     \
+        size_t tmp_size = ((obj)->field.length / SSZ_BITS_PER_BYTE) + 1;                                      \
+        ssz_error_t err_local = ssz_bitlist_serialize(&(obj)->field, out_buf + (size_t)(offset), &tmp_size);  \
+        if (err_local != SSZ_SUCCESS)                                                                         \
+        {                                                                                                     \
+            return SSZ_ERROR_SERIALIZATION;                                                                   \
+        }                                                                                                     \
+        (offset) += tmp_size;                                                                                 \
+    } while (0)
+
 #define SERIALIZE_OFFSET_FIELD(var, base, offset, field_size)                              \
     do                                                                                     \
     {                                                                                      \
@@ -330,18 +367,362 @@ typedef uint64_t ssz_offset_t;
         (var_offset) = _cur_offset;                                                                                 \
     } while (0)
 
+/*
+ * Single-pass serialization of a variable-size field whose length is not known up front.
+ * SERIALIZE_OFFSET_PLACEHOLDER reserves the field's offset in the fixed part and remembers
+ * where it is; SERIALIZE_VARIABLE_LIST_CONTAINER_FIELD later writes that offset, reserves the
+ * element offset table, serializes each element once directly into out_buf, and fills in
+ * the element's table entry. Nothing is allocated and no element is measured separately.
+ */
+#define SERIALIZE_OFFSET_PLACEHOLDER(slot, offset)                                                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        (slot) = (size_t)(offset);                                                                                     \
+        (offset) += SSZ_BYTES_PER_LENGTH_OFFSET;                                                                       \
+    } while (0)
+
+#define SERIALIZE_VARIABLE_LIST_CONTAINER_FIELD(obj, slot, offset, field, max_length, container_ser_func)              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        size_t _num_elements = (size_t)(obj)->field.length;                                                            \
+        size_t _table_start = (size_t)(offset);                                                                        \
+        if (_num_elements > (size_t)(max_length) || _table_start > UINT32_MAX)                                         \
+        {                                                                                                              \
+            return SSZ_ERROR_SERIALIZATION;                                                                            \
+        }                                                                                                              \
+        uint32_t _field_offset = (uint32_t)_table_start;                                                               \
+        size_t _tmp_size = SSZ_BYTE_SIZE_OF_UINT32;                                                                    \
+        if (ssz_serialize_uint32(&_field_offset, out_buf + (slot), &_tmp_size) != SSZ_SUCCESS)                         \
+        {                                                                                                              \
+            return SSZ_ERROR_SERIALIZATION;                                                                            \
+        }                                                                                                              \
+        size_t _cursor = _table_start + _num_elements * SSZ_BYTES_PER_LENGTH_OFFSET;                                   \
+        for (size_t _i = 0; _i < _num_elements; _i++)                                                                  \
+        {                                                                                                              \
+            if (_cursor - _table_start > UINT32_MAX)                                                                   \
+            {                                                                                                          \
+                return SSZ_ERROR_SERIALIZATION;                                                                        \
+            }                                                                                                          \
+            uint32_t _elem_offset = (uint32_t)(_cursor - _table_start);                                                \
+            _tmp_size = SSZ_BYTE_SIZE_OF_UINT32;                                                                       \
+            if (ssz_serialize_uint32(&_elem_offset, out_buf + _table_start + _i * SSZ_BYTES_PER_LENGTH_OFFSET,         \
+                                     &_tmp_size) != SSZ_SUCCESS)                                                       \
+            {                                                                                                          \
+                return SSZ_ERROR_SERIALIZATION;                                                                        \
+            }                                                                                                          \
+            size_t _elem_size = 0;                                                                                     \
+            if (container_ser_func(&(obj)->field.data[_i], out_buf + _cursor, &_elem_size) != SSZ_SUCCESS)             \
+            {                                                                                                          \
+                return SSZ_ERROR_SERIALIZATION;                                                                        \
+            }                                                                                                          \
+            _cursor += _elem_size;                                                                                     \
+        }                                                                                                              \
+        (offset) = _cursor;                                                                                            \
+    } while (0)
+
+/*
+ * Exact serialized size of a container, computed from a field list that mirrors the
+ * container's serialize field list. Fixed-size fields add constants, so a container made
+ * only of fixed-size fields folds to a compile-time constant. Variable-size fields add
+ * their 4-byte offset plus the size of their data, so only the variable parts are walked.
+ */
+#define DEFINE_SIZE_CONTAINER(ContainerType, CONTAINER_FIELDS)                                                 \
+    size_t ssz_size_##ContainerType(const ContainerType *obj)                                                  \
+    {                                                                                                          \
+        (void)obj;                                                                                             \
+        size_t size = 0;                                                                                       \
+        CONTAINER_FIELDS                                                                                       \
+        return size;                                                                                           \
+    }
+
+#define SIZE_FIXED_FIELD(size, field_size)                                                                     \
+    do                                                                                                         \
+    {                                                                                                          \
+        (size) += (field_size);                                                                                \
+    } while (0)
+
+#define SIZE_LIST_FIELD(obj, size, field, element_size)                                                        \
+    do                                                                                                         \
+    {                                                                                                          \
+        (size) += SSZ_BYTES_PER_LENGTH_OFFSET + (size_t)(obj)->field.length * (element_size);                  \
+    } while (0)
+
+#define SIZE_BITLIST_FIELD(obj, size, field)                                                                   \
+    do                                                                                                         \
+    {                                                                                                          \
+        (size) += SSZ_BYTES_PER_LENGTH_OFFSET + (size_t)(obj)->field.length / SSZ_BITS_PER_BYTE + 1;           \
+    } while (0)
+
+#define SIZE_VARIABLE_CONTAINER_FIELD(obj, size, field, container_size_func)                                   \
+    do                                                                                                         \
+    {                                                                                                          \
+        (size) += SSZ_BYTES_PER_LENGTH_OFFSET + container_size_func(&(obj)->field);                            \
+    } while (0)
+
+#define SIZE_VARIABLE_LIST_CONTAINER_FIELD(obj, size, field, container_size_func)                              \
+    do                                                                                                         \
+    {                                                                                                          \
+        (size) += SSZ_BYTES_PER_LENGTH_OFFSET;                                                                 \
+        for (size_t _i = 0; _i < (size_t)(obj)->field.length; _i++)                                            \
+        {                                                                                                      \
+            (size) += SSZ_BYTES_PER_LENGTH_OFFSET + container_size_func(&(obj)->field.data[_i]);               \
+        }                                                                                                      \
+    } while (0)
+
+/*
+ * Streaming serialization through an ssz_writer_t. The generated stream_<Type> function runs
+ * its field list three times: SSZ_STREAM_MEASURE adds up the size of the fixed part,
+ * SSZ_STREAM_FIXED writes fixed fields and the offsets of variable fields in field order, and
+ * SSZ_STREAM_VARIABLE writes the variable parts. Offsets are computed from lengths or from
+ * ssz_size_<Type> functions, so nothing is buffered beyond the writer's staging buffer.
+ */
+#define SSZ_STREAM_MEASURE 0
+#define SSZ_STREAM_FIXED 1
+#define SSZ_STREAM_VARIABLE 2
+
+#define DEFINE_STREAM_CONTAINER(ContainerType, CONTAINER_FIELDS)                                                 \
+    ssz_error_t stream_##ContainerType(const ContainerType *obj, ssz_writer_t *writer)                           \
+    {                                                                                                            \
+        size_t fixed_size = 0;                                                                                   \
+        uint64_t variable_offset = 0;                                                                            \
+        for (int phase = SSZ_STREAM_MEASURE; phase <= SSZ_STREAM_VARIABLE; phase++)                              \
+        {                                                                                                        \
+            if (phase == SSZ_STREAM_FIXED)                                                                       \
+            {                                                                                                    \
+                variable_offset = fixed_size;                                                                    \
+            }                                                                                                    \
+            CONTAINER_FIELDS                                                                                     \
+        }                                                                                                        \
+        (void)variable_offset;                                                                                   \
+        return writer->error;                                                                                    \
+    }
+
+#define STREAM_BASIC_FIELD(obj, field, field_size, ser_func)                                                     \
+    do                                                                                                           \
+    {                                                                                                            \
+        if (phase == SSZ_STREAM_MEASURE)                                                                         \
+        {                                                                                                        \
+            fixed_size += (field_size);                                                                          \
+        }                                                                                                        \
+        else if (phase == SSZ_STREAM_FIXED)                                                                      \
+        {                                                                                                        \
+            size_t _tmp_size = (field_size);                                                                     \
+            uint8_t *_out = ssz_writer_reserve(writer, _tmp_size);                                               \
+            if (_out == NULL || ser_func(&(obj)->field, _out, &_tmp_size) != SSZ_SUCCESS)                        \
+            {                                                                                                    \
+                return SSZ_ERROR_SERIALIZATION;                                                                  \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+/* Writes the field's in-memory bytes: byte vectors, and uint vectors on little-endian hosts. */
+#define STREAM_BYTES_FIELD(obj, field, field_size)                                                               \
+    do                                                                                                           \
+    {                                                                                                            \
+        if (phase == SSZ_STREAM_MEASURE)                                                                         \
+        {                                                                                                        \
+            fixed_size += (field_size);                                                                          \
+        }                                                                                                        \
+        else if (phase == SSZ_STREAM_FIXED)                                                                      \
+        {                                                                                                        \
+            ssz_error_t _err = ssz_writer_write(writer, &(obj)->field, (field_size));                            \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_CONTAINER_FIELD(obj, field, container_stream_func, field_size)                                    \
+    do                                                                                                           \
+    {                                                                                                            \
+        if (phase == SSZ_STREAM_MEASURE)                                                                         \
+        {                                                                                                        \
+            fixed_size += (field_size);                                                                          \
+        }                                                                                                        \
+        else if (phase == SSZ_STREAM_FIXED)                                                                      \
+        {                                                                                                        \
+            ssz_error_t _err = container_stream_func(&(obj)->field, writer);                                     \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_PACKED_BITVECTOR_FIELD(obj, field, bits)                                                          \
+    do                                                                                                           \
+    {                                                                                                            \
+        if (phase == SSZ_STREAM_MEASURE)                                                                         \
+        {                                                                                                        \
+            fixed_size += ((bits) + 7) / SSZ_BITS_PER_BYTE;                                                      \
+        }                                                                                                        \
+        else if (phase == SSZ_STREAM_FIXED)                                                                      \
+        {                                                                                                        \
+            const uint8_t *_bytes = (const uint8_t *)(obj)->field;                                               \
+            ssz_error_t _err = ssz_writer_write(writer, _bytes, (bits) / SSZ_BITS_PER_BYTE);                     \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+            if ((bits) % SSZ_BITS_PER_BYTE)                                                                      \
+            {                                                                                                    \
+                uint8_t *_out = ssz_writer_reserve(writer, 1);                                                   \
+                if (_out == NULL)                                                                                \
+                {                                                                                                \
+                    return writer->error;                                                                        \
+                }                                                                                                \
+                unsigned _rem = (unsigned)((bits) % SSZ_BITS_PER_BYTE);                                          \
+                *_out = (uint8_t)(_bytes[(bits) / SSZ_BITS_PER_BYTE] & ((1U << _rem) - 1));                      \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_VARIABLE_OFFSET(data_size)                                                                        \
+    do                                                                                                           \
+    {                                                                                                            \
+        if (phase == SSZ_STREAM_MEASURE)                                                                         \
+        {                                                                                                        \
+            fixed_size += SSZ_BYTES_PER_LENGTH_OFFSET;                                                           \
+        }                                                                                                        \
+        else if (phase == SSZ_STREAM_FIXED)                                                                      \
+        {                                                                                                        \
+            ssz_error_t _err = ssz_writer_write_offset(writer, variable_offset);                                 \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+            variable_offset += (data_size);                                                                      \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_LIST_FIELD(obj, field, element_size)                                                              \
+    do                                                                                                           \
+    {                                                                                                            \
+        STREAM_VARIABLE_OFFSET((uint64_t)(obj)->field.length * (element_size));                                  \
+        if (phase == SSZ_STREAM_VARIABLE)                                                                        \
+        {                                                                                                        \
+            ssz_error_t _err = ssz_writer_write(writer, (obj)->field.data,                                       \
+                                                (size_t)(obj)->field.length * (element_size));                   \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_LIST_CONTAINER_FIELD(obj, field, container_stream_func, element_size)                             \
+    do                                                                                                           \
+    {                                                                                                            \
+        STREAM_VARIABLE_OFFSET((uint64_t)(obj)->field.length * (element_size));                                  \
+        for (size_t _i = 0; phase == SSZ_STREAM_VARIABLE && _i < (size_t)(obj)->field.length; _i++)              \
+        {                                                                                                        \
+            ssz_error_t _err = container_stream_func(&(obj)->field.data[_i], writer);                            \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_PACKED_BITLIST_FIELD(obj, field, max_bits)                                                        \
+    do                                                                                                           \
+    {                                                                                                            \
+        size_t _bits = (obj)->field.length;                                                                      \
+        STREAM_VARIABLE_OFFSET(_bits / SSZ_BITS_PER_BYTE + 1);                                                   \
+        if (phase == SSZ_STREAM_VARIABLE)                                                                        \
+        {                                                                                                        \
+            if (_bits > (max_bits))                                                                              \
+            {                                                                                                    \
+                return SSZ_ERROR_SERIALIZATION;                                                                  \
+            }                                                                                                    \
+            size_t _full = _bits / SSZ_BITS_PER_BYTE;                                                            \
+            unsigned _rem = (unsigned)(_bits % SSZ_BITS_PER_BYTE);                                               \
+            const uint8_t *_bytes = (const uint8_t *)(obj)->field.words;                                         \
+            uint8_t _last = (uint8_t)(1U << _rem);                                                               \
+            if (_rem)                                                                                            \
+            {                                                                                                    \
+                _last |= (uint8_t)(_bytes[_full] & ((1U << _rem) - 1));                                          \
+            }                                                                                                    \
+            ssz_error_t _err = ssz_writer_write(writer, _bytes, _full);                                          \
+            if (_err != SSZ_SUCCESS)                                                                             \
+            {                                                                                                    \
+                return _err;                                                                                     \
+            }                                                                                                    \
+            uint8_t *_out = ssz_writer_reserve(writer, 1);                                                       \
+            if (_out == NULL)                                                                                    \
+            {                                                                                                    \
+                return writer->error;                                                                            \
+            }                                                                                                    \
+            *_out = _last;                                                                                       \
+        }                                                                                                        \
+    } while (0)
+
+#define STREAM_VARIABLE_LIST_CONTAINER_FIELD(obj, field, container_stream_func, container_size_func)             \
+    do                                                                                                           \
+    {                                                                                                            \
+        size_t _n = (size_t)(obj)->field.length;                                                                 \
+        uint64_t _list_size = 0;                                                                                 \
+        if (phase == SSZ_STREAM_FIXED)                                                                           \
+        {                                                                                                        \
+            _list_size = (uint64_t)_n * SSZ_BYTES_PER_LENGTH_OFFSET;                                             \
+            for (size_t _i = 0; _i < _n; _i++)                                                                   \
+            {                                                                                                    \
+                _list_size += container_size_func(&(obj)->field.data[_i]);                                       \
+            }                                                                                                    \
+        }                                                                                                        \
+        STREAM_VARIABLE_OFFSET(_list_size);                                                                      \
+        if (phase == SSZ_STREAM_VARIABLE)                                                                        \
+        {                                                                                                        \
+            uint64_t _elem_offset = (uint64_t)_n * SSZ_BYTES_PER_LENGTH_OFFSET;                                  \
+            for (size_t _i = 0; _i < _n; _i++)                                                                   \
+            {                                                                                                    \
+                ssz_error_t _err = ssz_writer_write_offset(writer, _elem_offset);                                \
+                if (_err != SSZ_SUCCESS)                                                                         \
+                {                                                                                                \
+                    return _err;                                                                                 \
+                }                                                                                                \
+                _elem_offset += container_size_func(&(obj)->field.data[_i]);                                     \
+            }                                                                                                    \
+            for (size_t _i = 0; _i < _n; _i++)                                                                   \
+            {                                                                                                    \
+                ssz_error_t _err = container_stream_func(&(obj)->field.data[_i], writer);                        \
+                if (_err != SSZ_SUCCESS)                                                                         \
+                {                                                                                                \
+                    return _err;                                                                                 \
+                }                                                                                                \
+            }                                                                                                    \
+        }                                                                                                        \
+    } while (0)
+
+/*
+ * Deserialization. Every generated deserialize_<Type> function has a deserialize_<Type>_arena
+ * twin that takes an ssz_arena_t; all nested list, bitlist and element buffers of the decoded
+ * object are then carved from the arena instead of being malloc'ed one by one, and are
+ * reclaimed together by ssz_arena_reset or ssz_arena_free. The arena reaches the field list
+ * as the local arena, which is NULL (plain malloc) for deserialize_<Type>. The list and
+ * bitlist field macros keep allocating with malloc; their *_ARENA variants take the arena and,
+ * for nested containers, the element's deserialize_<Type>_arena function explicitly.
+ */
 #define DEFINE_DESERIALIZE_CONTAINER(ContainerType, CONTAINER_FIELDS)                    \
-    ssz_error_t deserialize_##ContainerType(const unsigned char *data, size_t data_size, \
-                                            ContainerType *obj)                          \
+    ssz_error_t deserialize_##ContainerType##_arena(const unsigned char *data, size_t data_size, \
+                                                    ContainerType *obj, ssz_arena_t *arena) \
     {                                                                                    \
         (void)data_size;                                                                 \
+        (void)arena;                                                                     \
         ssz_offset_t offset = 0;                                                         \
         CONTAINER_FIELDS                                                                 \
         return SSZ_SUCCESS;                                                              \
+    }                                                                                    \
+    ssz_error_t deserialize_##ContainerType(const unsigned char *data, size_t data_size, \
+                                            ContainerType *obj)                          \
+    {                                                                                    \
+        return deserialize_##ContainerType##_arena(data, data_size, obj, NULL);          \
     }
 
 #define DEFINE_DESERIALIZE_LIST(ListType, ElementType, ElementSize, deserialize_func)               \
-    ssz_error_t deserialize_##ListType(const unsigned char *data, size_t data_size, ListType *list) \
+    ssz_error_t deserialize_##ListType##_arena(const unsigned char *data, size_t data_size, ListType *list, \
+                                               ssz_arena_t *arena)                                  \
     {                                                                                               \
         if (data_size % (ElementSize) != 0)                                                         \
         {                                                                                           \
@@ -354,7 +735,7 @@ typedef uint64_t ssz_offset_t;
             list->data = NULL;                                                                      \
             return SSZ_SUCCESS;                                                                     \
         }                                                                                           \
-        list->data = malloc(num * sizeof(ElementType));                                             \
+        list->data = ssz_arena_alloc(arena, num * sizeof(ElementType));                             \
         if (!list->data)                                                                            \
         {                                                                                           \
             return SSZ_ERROR_DESERIALIZATION;                                                       \
@@ -372,7 +753,7 @@ typedef uint64_t ssz_offset_t;
             err = deserialize_func(p, (ElementSize), dest);                                         \
             if (err != SSZ_SUCCESS)                                                                 \
             {                                                                                       \
-                free(list->data);                                                                   \
+                ssz_arena_release(arena, list->data);                                               \
                 return SSZ_ERROR_DESERIALIZATION;                                                   \
             }                                                                                       \
             p += (ElementSize);                                                                     \
@@ -381,7 +762,7 @@ typedef uint64_t ssz_offset_t;
             err = deserialize_func(p, (ElementSize), dest);                                         \
             if (err != SSZ_SUCCESS)                                                                 \
             {                                                                                       \
-                free(list->data);                                                                   \
+                ssz_arena_release(arena, list->data);                                               \
                 return SSZ_ERROR_DESERIALIZATION;                                                   \
             }                                                                                       \
             p += (ElementSize);                                                                     \
@@ -390,7 +771,7 @@ typedef uint64_t ssz_offset_t;
             err = deserialize_func(p, (ElementSize), dest);                                         \
             if (err != SSZ_SUCCESS)                                                                 \
             {                                                                                       \
-                free(list->data);                                                                   \
+                ssz_arena_release(arena, list->data);                                               \
                 return SSZ_ERROR_DESERIALIZATION;                                                   \
             }                                                                                       \
             p += (ElementSize);                                                                     \
@@ -399,7 +780,7 @@ typedef uint64_t ssz_offset_t;
             err = deserialize_func(p, (ElementSize), dest);                                         \
             if (err != SSZ_SUCCESS)                                                                 \
             {                                                                                       \
-                free(list->data);                                                                   \
+                ssz_arena_release(arena, list->data);                                               \
                 return SSZ_ERROR_DESERIALIZATION;                                                   \
             }                                                                                       \
             p += (ElementSize);                                                                     \
@@ -411,7 +792,7 @@ typedef uint64_t ssz_offset_t;
             ssz_error_t err = deserialize_func(p, (ElementSize), dest);                             \
             if (err != SSZ_SUCCESS)                                                                 \
             {                                                                                       \
-                free(list->data);                                                                   \
+                ssz_arena_release(arena, list->data);                                               \
                 return SSZ_ERROR_DESERIALIZATION;                                                   \
             }                                                                                       \
             p += (ElementSize);                                                                     \
@@ -419,6 +800,60 @@ typedef uint64_t ssz_offset_t;
         }                                                                                           \
                                                                                                     \
         return SSZ_SUCCESS;                                                                         \
+    }                                                                                               \
+    ssz_error_t deserialize_##ListType(const unsigned char *data, size_t data_size, ListType *list) \
+    {                                                                                               \
+        return deserialize_##ListType##_arena(data, data_size, list, NULL);                         \
+    }
+
+/*
+ * Opt-in parallel variant of DEFINE_DESERIALIZE_LIST. The generated deserialize_<List>_parallel
+ * decodes the elements on the built-in worker pool through ssz_deserialize_fixed_list_parallel
+ * and, on failure, stores the index of the first element that did not decode in
+ * *out_error_index. Only the element array comes from the arena; element functions run
+ * concurrently and must therefore not allocate from it.
+ */
+#define DEFINE_DESERIALIZE_LIST_PARALLEL(ListType, ElementType, ElementSize, deserialize_func)           \
+    ssz_error_t deserialize_##ListType##_parallel(const unsigned char *data, size_t data_size,          \
+                                                  ListType *list, ssz_arena_t *arena,                   \
+                                                  size_t *out_error_index);                             \
+    static ssz_error_t deserialize_##ListType##_parallel_element(const uint8_t *buffer,                 \
+                                                                 size_t buffer_size, void *out_element) \
+    {                                                                                                   \
+        return deserialize_func(buffer, buffer_size, (ElementType *)out_element);                       \
+    }                                                                                                   \
+    ssz_error_t deserialize_##ListType##_parallel(const unsigned char *data, size_t data_size,          \
+                                                  ListType *list, ssz_arena_t *arena,                   \
+                                                  size_t *out_error_index)                              \
+    {                                                                                                   \
+        if (data_size % (ElementSize) != 0)                                                             \
+        {                                                                                               \
+            return SSZ_ERROR_DESERIALIZATION;                                                           \
+        }                                                                                               \
+        uint64_t num = data_size / (ElementSize);                                                       \
+        list->length = num;                                                                             \
+        if (num == 0)                                                                                   \
+        {                                                                                               \
+            list->data = NULL;                                                                          \
+            return SSZ_SUCCESS;                                                                         \
+        }                                                                                               \
+        list->data = ssz_arena_alloc(arena, num * sizeof(ElementType));                                 \
+        if (!list->data)                                                                                \
+        {                                                                                               \
+            return SSZ_ERROR_DESERIALIZATION;                                                           \
+        }                                                                                               \
+        ssz_error_t err = ssz_deserialize_fixed_list_parallel(data, (ElementSize), num, list->data,     \
+                                                              sizeof(ElementType),                      \
+                                                              deserialize_##ListType##_parallel_element, \
+                                                              out_error_index);                         \
+        if (err != SSZ_SUCCESS)                                                                         \
+        {                                                                                               \
+            ssz_arena_release(arena, list->data);                                                       \
+            list->data = NULL;                                                                          \
+            list->length = 0;                                                                           \
+            return SSZ_ERROR_DESERIALIZATION;                                                           \
+        }                                                                                               \
+        return SSZ_SUCCESS;                                                                             \
     }
 
 #define DESERIALIZE_BASIC_FIELD(obj, offset, field, deserialize_func)                                   \
@@ -490,6 +925,84 @@ typedef uint64_t ssz_offset_t;
         (offset_start) += (field_size);                                           \
     } while (0)
 
+#define DESERIALIZE_BITLIST_FIELD_ARENA(obj, offset_start, field_size, field, max_bits, arena) \
+    do                                                                                         \
+    {                                                                                          \
+        size_t actual_count = 0;                                                               \
+        (obj)->field.data = ssz_arena_alloc((arena), (max_bits) * sizeof(bool));               \
+        if (!(obj)->field.data)                                                                \
+        {                                                                                      \
+            return SSZ_ERROR_DESERIALIZATION;                                                  \
+        }                                                                                      \
+        ssz_error_t err_local = ssz_deserialize_bitlist(data + (size_t)(offset_start),         \
+                                                        (field_size),                          \
+                                                        (max_bits),                            \
+                                                        (obj)->field.data,                     \
+                                                        &actual_count);                        \
+        if (err_local != SSZ_SUCCESS)                                                          \
+        {                                                                                      \
+            ssz_arena_release((arena), (obj)->field.data);                                     \
+            return SSZ_ERROR_DESERIALIZATION;                                                  \
+        }                                                                                      \
+        (obj)->field.length = actual_count;                                                    \
+        (offset_start) += (field_size);                                                        \
+    } while (0)
+
+#define DESERIALIZE_PACKED_BITVECTOR_FIELD(obj, offset, field, bits)                                       \
+    do                                                                                                     \
+    {                                                                                                      \
+        size_t byte_size = ((bits) + 7) / SSZ_BITS_PER_BYTE;                                               \
+        ssz_bitvector_t _vec = {(obj)->field, (bits)};                                                     \
+        ssz_error_t err_local = ssz_bitvector_deserialize(data + (size_t)(offset), byte_size, &_vec);      \
+        if (err_local != SSZ_SUCCESS)                                                                      \
+        {                                                                                                  \
+            return SSZ_ERROR_DESERIALIZATION;                                                              \
+        }                                                                                                  \
+        (offset) += byte_size;                                                                             \
+    } while (0)
+
+#define DESERIALIZE_PACKED_BITLIST_FIELD(obj, offset_start, field_size, field, max_bits)                   \
+    do                                                                                                     \
+    {                                                                                                      \
+        size_t _data_bits = (field_size) * SSZ_BITS_PER_BYTE;                                              \
+        size_t _words = SSZ_BITFIELD_WORDS(_data_bits < (max_bits) ? _data_bits : (max_bits));            \
+        (obj)->field.words = malloc((_words != 0 ? _words : 1) * sizeof(uint64_t));                        \
+        if (!(obj)->field.words)                                                                           \
+        {                                                                                                  \
+            return SSZ_ERROR_DESERIALIZATION;                                                              \
+        }                                                                                                  \
+        ssz_error_t err_local = ssz_bitlist_deserialize(data + (size_t)(offset_start), (field_size),       \
+                                                        (max_bits), &(obj)->field);                        \
+        if (err_local != SSZ_SUCCESS)                                                                      \
+        {                                                                                                  \
+            ssz_bitlist_free(&(obj)->field);                                                               \
+            return SSZ_ERROR_DESERIALIZATION;                                                              \
+        }                                                                                                  \
+        (offset_start) += (field_size);                                                                    \
+    } while (0)
+
+#define DESERIALIZE_PACKED_BITLIST_FIELD_ARENA(obj, offset_start, field_size, field, max_bits, arena) \
+    do                                                                                                \
+    {                                                                                                 \
+        size_t _data_bits = (field_size) * SSZ_BITS_PER_BYTE;                                         \
+        size_t _words = SSZ_BITFIELD_WORDS(_data_bits < (max_bits) ? _data_bits : (max_bits));        \
+        (obj)->field.words = ssz_arena_alloc((arena), (_words != 0 ? _words : 1) * sizeof(uint64_t)); \
+        if (!(obj)->field.words)                                                                      \
+        {                                                                                             \
+            return SSZ_ERROR_DESERIALIZATION;                                                         \
+        }                                                                                             \
+        ssz_error_t err_local = ssz_bitlist_deserialize(data + (size_t)(offset_start), (field_size),  \
+                                                        (max_bits), &(obj)->field);                   \
+        if (err_local != SSZ_SUCCESS)                                                                 \
+        {                                                                                             \
+            ssz_arena_release((arena), (obj)->field.words);                                           \
+            (obj)->field.words = NULL;                                                                \
+            (obj)->field.length = 0;                                                                  \
+            return SSZ_ERROR_DESERIALIZATION;                                                         \
+        }                                                                                             \
+        (offset_start) += (field_size);                                                               \
+    } while (0)
+
 #define DESERIALIZE_LIST_FIELD(obj, offset_start, list_size, field, max_length, deserialize_func)                                     \
     do                                                                                                                                \
     {                                                                                                                                 \
@@ -508,6 +1021,24 @@ typedef uint64_t ssz_offset_t;
         (obj)->field.length = actual_count;                                                                                           \
     } while (0)
 
+#define DESERIALIZE_LIST_FIELD_ARENA(obj, offset_start, list_size, field, max_length, deserialize_func, arena)                                \
+    do                                                                                                                                        \
+    {                                                                                                                                         \
+        size_t actual_count = 0;                                                                                                              \
+        (obj)->field.data = ssz_arena_alloc((arena), (list_size));                                                                            \
+        if (!(obj)->field.data)                                                                                                               \
+        {                                                                                                                                     \
+            return SSZ_ERROR_DESERIALIZATION;                                                                                                 \
+        }                                                                                                                                     \
+        ssz_error_t err_local = deserialize_func(data + (size_t)(offset_start), (list_size), (max_length), (obj)->field.data, &actual_count); \
+        if (err_local != SSZ_SUCCESS)                                                                                                         \
+        {                                                                                                                                     \
+            ssz_arena_release((arena), (obj)->field.data);                                                                                    \
+            return SSZ_ERROR_DESERIALIZATION;                                                                                                 \
+        }                                                                                                                                     \
+        (obj)->field.length = actual_count;                                                                                                   \
+    } while (0)
+
 #define DESERIALIZE_OFFSET_FIELD(var, offset)                                                      \
     do                                                                                             \
     {                                                                                              \
@@ -540,11 +1071,27 @@ typedef uint64_t ssz_offset_t;
         }                                                                                       \
     } while (0)
 
+#define DESERIALIZE_LIST_CONTAINER_FIELD_ARENA(obj, offset_start, size, field, deserialize_arena_func, arena)          \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        ssz_error_t err_local = deserialize_arena_func(data + (size_t)(offset_start), (size), &(obj)->field, (arena)); \
+        if (err_local != SSZ_SUCCESS)                                                                                  \
+        {                                                                                                              \
+            return SSZ_ERROR_DESERIALIZATION;                                                                          \
+        }                                                                                                              \
+    } while (0)
+
 #define DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(obj, field_offset, field_size, field, max_length, deserialize_func) \
     do                                                                                                                \
     {                                                                                                                 \
         const unsigned char *const _base_ptr = data + (size_t)(field_offset);                                                 \
         const size_t _field_size = (field_size);                                                                      \
+        if (_field_size == 0)                                                                                         \
+        {                                                                                                             \
+            (obj)->field.length = 0;                                                                                  \
+            (obj)->field.data = NULL;                                                                                 \
+            break;                                                                                                    \
+        }                                                                                                             \
         const uint32_t *const _offsets = (const uint32_t *)_base_ptr;                                                 \
         const uint32_t _num_elements = _offsets[0] / SSZ_BYTES_PER_LENGTH_OFFSET;                                     \
         if (_num_elements > (max_length))                                                                             \
@@ -573,4 +1120,661 @@ typedef uint64_t ssz_offset_t;
         }                                                                                                             \
     } while (0)
 
+#define DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD_ARENA(obj, field_offset, field_size, field, max_length, deserialize_arena_func, arena) \
+    do                                                                                                                                   \
+    {                                                                                                                                    \
+        const unsigned char *const _base_ptr = data + (size_t)(field_offset);                                                            \
+        const size_t _field_size = (field_size);                                                                                         \
+        if (_field_size == 0)                                                                                                            \
+        {                                                                                                                                \
+            (obj)->field.length = 0;                                                                                                     \
+            (obj)->field.data = NULL;                                                                                                    \
+            break;                                                                                                                       \
+        }                                                                                                                                \
+        if (ssz_view_check_variable_list(&(ssz_view_t){_base_ptr, _field_size}, (max_length), NULL) != SSZ_SUCCESS)                      \
+        {                                                                                                                                \
+            return SSZ_ERROR_DESERIALIZATION;                                                                                            \
+        }                                                                                                                                \
+        uint32_t _offset = 0;                                                                                                            \
+        ssz_deserialize_uint32(_base_ptr, SSZ_BYTES_PER_LENGTH_OFFSET, &_offset);                                                        \
+        const uint32_t _num_elements = _offset / SSZ_BYTES_PER_LENGTH_OFFSET;                                                            \
+        size_t _elem_rel_offset = _offset;                                                                                               \
+        (obj)->field.length = _num_elements;                                                                                             \
+        (obj)->field.data = ssz_arena_alloc((arena), _num_elements * sizeof(*(obj)->field.data));                                        \
+        if (!(obj)->field.data)                                                                                                          \
+        {                                                                                                                                \
+            return SSZ_ERROR_DESERIALIZATION;                                                                                            \
+        }                                                                                                                                \
+        for (uint32_t _i = 0; _i < _num_elements; _i++)                                                                                  \
+        {                                                                                                                                \
+            size_t _next_rel_offset = _field_size;                                                                                       \
+            if (_i + 1 < _num_elements)                                                                                                  \
+            {                                                                                                                            \
+                ssz_deserialize_uint32(_base_ptr + (size_t)(_i + 1) * SSZ_BYTES_PER_LENGTH_OFFSET,                                       \
+                                       SSZ_BYTES_PER_LENGTH_OFFSET, &_offset);                                                           \
+                _next_rel_offset = _offset;                                                                                              \
+            }                                                                                                                            \
+            ssz_error_t _err = deserialize_arena_func(_base_ptr + _elem_rel_offset, _next_rel_offset - _elem_rel_offset,                 \
+                                                      &((obj)->field.data[_i]), (arena));                                                \
+            if (_err != SSZ_SUCCESS)                                                                                                     \
+            {                                                                                                                            \
+                ssz_arena_release((arena), (obj)->field.data);                                                                           \
+                return SSZ_ERROR_DESERIALIZATION;                                                                                        \
+            }                                                                                                                            \
+            _elem_rel_offset = _next_rel_offset;                                                                                         \
+        }                                                                                                                                \
+    } while (0)
+
+/*
+ * Partial deserialization by field mask. DEFINE_FIELD_ENUM(Type, FIELD_NAMES) declares the
+ * enum Type##_field_t with one Type##_FIELD_<name> index per field, where FIELD_NAMES(X, Type)
+ * expands X(Type, name) for every field in declaration order. SSZ_FIELD_BIT turns an index
+ * into a bit of an ssz_field_mask_t.
+ *
+ * DEFINE_DESERIALIZE_PARTIAL_CONTAINER generates deserialize_<Type>_partial, which takes such
+ * a mask in the local variable fields. Its field list wraps each entry in
+ * DESERIALIZE_SELECTED_FIELD, pairing the usual DESERIALIZE_* macro with a SKIP_* macro that
+ * only bounds-checks the field. Skipped fixed-size fields are left untouched; skipped lists
+ * keep their length but get no data, so nothing is copied or allocated for them.
+ */
+typedef uint64_t ssz_field_mask_t;
+
+#define SSZ_FIELDS_ALL (~(ssz_field_mask_t)0)
+#define SSZ_FIELD_BIT(ContainerType, name) ((ssz_field_mask_t)1 << ContainerType##_FIELD_##name)
+#define SSZ_FIELD_ENUM_ENTRY(ContainerType, name) ContainerType##_FIELD_##name,
+
+#define DEFINE_FIELD_ENUM(ContainerType, FIELD_NAMES)       \
+    typedef enum                                            \
+    {                                                       \
+        FIELD_NAMES(SSZ_FIELD_ENUM_ENTRY, ContainerType)    \
+        ContainerType##_FIELD_COUNT                         \
+    } ContainerType##_field_t
+
+#define DEFINE_DESERIALIZE_PARTIAL_CONTAINER(ContainerType, CONTAINER_FIELDS)                           \
+    ssz_error_t deserialize_##ContainerType##_partial(const unsigned char *data, size_t data_size,      \
+                                                      ContainerType *obj, ssz_arena_t *arena,           \
+                                                      ssz_field_mask_t fields)                          \
+    {                                                                                                   \
+        (void)data_size;                                                                                \
+        (void)arena;                                                                                    \
+        ssz_offset_t offset = 0;                                                                        \
+        CONTAINER_FIELDS                                                                                \
+        return SSZ_SUCCESS;                                                                             \
+    }
+
+#define DESERIALIZE_SELECTED_FIELD(ContainerType, name, DESERIALIZE, SKIP) \
+    do                                                                     \
+    {                                                                      \
+        if (fields & SSZ_FIELD_BIT(ContainerType, name))                   \
+        {                                                                  \
+            DESERIALIZE;                                                   \
+        }                                                                  \
+        else                                                               \
+        {                                                                  \
+            SKIP;                                                          \
+        }                                                                  \
+    } while (0)
+
+#define SKIP_FIXED_FIELD(offset, field_size)                              \
+    do                                                                    \
+    {                                                                     \
+        if ((offset) > data_size || data_size - (offset) < (field_size))  \
+        {                                                                 \
+            return SSZ_ERROR_DESERIALIZATION;                             \
+        }                                                                 \
+        (offset) += (field_size);                                         \
+    } while (0)
+
+#define SKIP_LIST_FIELD(obj, offset_start, list_size, field, element_size, max_length)      \
+    do                                                                                      \
+    {                                                                                       \
+        if ((offset_start) > data_size || data_size - (offset_start) < (list_size))         \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        ssz_view_t _list = {data + (size_t)(offset_start), (list_size)};                    \
+        if (ssz_view_check_list(&_list, (element_size), (max_length)) != SSZ_SUCCESS)       \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        (obj)->field.data = NULL;                                                           \
+        (obj)->field.length = ssz_view_list_length(&_list, (element_size));                 \
+    } while (0)
+
+#define SKIP_PACKED_BITLIST_FIELD(obj, offset_start, field_size, field, max_bits)           \
+    do                                                                                      \
+    {                                                                                       \
+        if ((offset_start) > data_size || data_size - (offset_start) < (field_size))        \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        ssz_view_t _bits = {data + (size_t)(offset_start), (field_size)};                   \
+        size_t _delimiter = 0;                                                              \
+        if (ssz_view_check_bitlist(&_bits, (max_bits)) != SSZ_SUCCESS)                      \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        find_last_set_bit(_bits.data + _bits.size - 1, 1, &_delimiter);                     \
+        (obj)->field.words = NULL;                                                          \
+        (obj)->field.length = (_bits.size - 1) * SSZ_BITS_PER_BYTE + _delimiter;            \
+    } while (0)
+
+#define SKIP_VARIABLE_LIST_FIELD(obj, offset_start, list_size, field, max_length)           \
+    do                                                                                      \
+    {                                                                                       \
+        if ((offset_start) > data_size || data_size - (offset_start) < (list_size))         \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        ssz_view_t _list = {data + (size_t)(offset_start), (list_size)};                    \
+        if (ssz_view_check_variable_list(&_list, (max_length), NULL) != SSZ_SUCCESS)        \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+        (obj)->field.data = NULL;                                                           \
+        (obj)->field.length = ssz_view_variable_list_length(&_list);                        \
+    } while (0)
+
+/*
+ * Resumable deserialization. DEFINE_READ_CONTAINER generates ssz_read_<Type>_step, an
+ * ssz_reader_step_fn that decodes one field entry at a time, and ssz_reader_init_<Type>.
+ * The field list names every field in serialization order:
+ *   READ_FIELD wraps the DESERIALIZE_* macro of a fixed-size field, which reads at the local
+ *     offset of a buffer holding just that field;
+ *   READ_BYTES_FIELD copies a byte vector in pieces that fit the staging buffer;
+ *   READ_OFFSET_FIELD stores the offset of a variable-size field;
+ *   READ_VARIABLE_FIELD wraps the DESERIALIZE_* macro of a variable-size field, which reads
+ *     data_size bytes at the local start;
+ *   READ_LIST_ELEMENTS_FIELD decodes a list of fixed-size elements a few elements at a time.
+ */
+#define DEFINE_READ_CONTAINER(ContainerType, CONTAINER_FIELDS)                             \
+    ssz_error_t ssz_read_##ContainerType##_step(ssz_reader_t *reader, const uint8_t *data, \
+                                                size_t data_size)                          \
+    {                                                                                      \
+        ContainerType *obj = (ContainerType *)reader->object;                              \
+        ssz_arena_t *arena = reader->arena;                                                \
+        size_t _stage = 0;                                                                 \
+        (void)obj;                                                                         \
+        (void)arena;                                                                       \
+        (void)data_size;                                                                   \
+        CONTAINER_FIELDS                                                                   \
+        return ssz_reader_end(reader);                                                     \
+    }                                                                                      \
+    ssz_error_t ssz_reader_init_##ContainerType(ssz_reader_t *reader, uint8_t *staging,    \
+                                                size_t staging_size, size_t total_size,    \
+                                                ContainerType *obj, ssz_arena_t *arena)    \
+    {                                                                                      \
+        return ssz_reader_init(reader, staging, staging_size, total_size,                  \
+                               ssz_read_##ContainerType##_step, obj, arena);               \
+    }
+
+#define READ_FIELD(field_size, DESERIALIZE)                     \
+    do                                                          \
+    {                                                           \
+        if (reader->stage == _stage++)                          \
+        {                                                       \
+            if (reader->expecting)                              \
+            {                                                   \
+                return ssz_reader_expect(reader, (field_size)); \
+            }                                                   \
+            ssz_offset_t offset = 0;                            \
+            DESERIALIZE;                                        \
+            (void)offset;                                       \
+            return ssz_reader_consumed(reader, data_size);      \
+        }                                                       \
+    } while (0)
+
+#define READ_BYTES_FIELD(obj, field)                                                   \
+    do                                                                                 \
+    {                                                                                  \
+        if (reader->stage == _stage++)                                                 \
+        {                                                                              \
+            if (reader->expecting)                                                     \
+            {                                                                          \
+                return ssz_reader_expect_bytes(reader, sizeof((obj)->field));          \
+            }                                                                          \
+            memcpy((uint8_t *)(obj)->field + reader->field_position, data, data_size); \
+            return ssz_reader_consumed(reader, data_size);                             \
+        }                                                                              \
+    } while (0)
+
+#define READ_OFFSET_FIELD()                                                    \
+    do                                                                         \
+    {                                                                          \
+        if (reader->stage == _stage++)                                         \
+        {                                                                      \
+            if (reader->expecting)                                             \
+            {                                                                  \
+                return ssz_reader_expect(reader, SSZ_BYTES_PER_LENGTH_OFFSET); \
+            }                                                                  \
+            return ssz_reader_read_offset(reader, data);                       \
+        }                                                                      \
+    } while (0)
+
+#define READ_VARIABLE_FIELD(DESERIALIZE)                   \
+    do                                                     \
+    {                                                      \
+        if (reader->stage == _stage++)                     \
+        {                                                  \
+            if (reader->expecting)                         \
+            {                                              \
+                return ssz_reader_expect_variable(reader); \
+            }                                              \
+            size_t start = 0;                              \
+            DESERIALIZE;                                   \
+            (void)start;                                   \
+            return ssz_reader_consumed(reader, data_size); \
+        }                                                  \
+    } while (0)
+
+#define READ_LIST_ELEMENTS_FIELD(obj, field, element_size, max_length, deserialize_func)             \
+    do                                                                                               \
+    {                                                                                                \
+        if (reader->stage == _stage++)                                                               \
+        {                                                                                            \
+            if (reader->expecting)                                                                   \
+            {                                                                                        \
+                bool _first = !reader->field_started;                                                \
+                ssz_error_t _err = ssz_reader_expect_elements(reader, (element_size), (max_length)); \
+                if (_err == SSZ_SUCCESS && _first)                                                   \
+                {                                                                                    \
+                    (obj)->field.length = reader->field_size / (element_size);                       \
+                    (obj)->field.data = NULL;                                                        \
+                    if ((obj)->field.length != 0)                                                    \
+                    {                                                                                \
+                        (obj)->field.data = ssz_arena_alloc(arena, (obj)->field.length *             \
+                                                                       sizeof(*(obj)->field.data));  \
+                        if (!(obj)->field.data)                                                      \
+                        {                                                                            \
+                            return SSZ_ERROR_DESERIALIZATION;                                        \
+                        }                                                                            \
+                    }                                                                                \
+                }                                                                                    \
+                return _err;                                                                         \
+            }                                                                                        \
+            size_t _first_index = reader->field_position / (element_size);                           \
+            for (size_t _i = 0; _i < data_size / (element_size); _i++)                               \
+            {                                                                                        \
+                if (deserialize_func(data + _i * (element_size), (element_size),                     \
+                                     &(obj)->field.data[_first_index + _i]) != SSZ_SUCCESS)          \
+                {                                                                                    \
+                    ssz_arena_release(arena, (obj)->field.data);                                     \
+                    (obj)->field.data = NULL;                                                        \
+                    (obj)->field.length = 0;                                                         \
+                    return SSZ_ERROR_DESERIALIZATION;                                                \
+                }                                                                                    \
+            }                                                                                        \
+            return ssz_reader_consumed(reader, data_size);                                           \
+        }                                                                                            \
+    } while (0)
+
+/*
+ * Zero-copy views over serialized containers. The generated ssz_view_<Type> function checks
+ * the size of the fixed part and, once, every offset and list shape named in its field list;
+ * the DEFINE_VIEW_*_FIELD accessors then read straight from the buffer without further checks.
+ * Positions are byte positions inside the fixed part, and next_position is the position of
+ * the following variable field's offset, or SSZ_VIEW_END for the last one.
+ *
+ * DEFINE_VALIDATE_CONTAINER runs the same field list as a validate-only ssz_validate_<Type>
+ * function, which rejects malformed input without allocating or copying anything.
+ */
+#define SSZ_VIEW_CHECK_CONTAINER(FixedSize, CONTAINER_FIELDS)                                     \
+    const size_t fixed_size = (FixedSize);                                                        \
+    size_t previous_offset = 0;                                                                   \
+    if (data == NULL || data_size < fixed_size)                                                   \
+    {                                                                                             \
+        return SSZ_ERROR_DESERIALIZATION;                                                         \
+    }                                                                                             \
+    view->data = data;                                                                            \
+    view->size = data_size;                                                                       \
+    CONTAINER_FIELDS                                                                              \
+    if (previous_offset == 0 && data_size != fixed_size)                                          \
+    {                                                                                             \
+        return SSZ_ERROR_DESERIALIZATION;                                                         \
+    }                                                                                             \
+    return SSZ_SUCCESS;
+
+#define DEFINE_VIEW_CONTAINER(ContainerType, FixedSize, CONTAINER_FIELDS)                         \
+    ssz_error_t ssz_view_##ContainerType(const uint8_t *data, size_t data_size, ssz_view_t *view) \
+    {                                                                                             \
+        SSZ_VIEW_CHECK_CONTAINER(FixedSize, CONTAINER_FIELDS)                                     \
+    }
+
+#define DEFINE_VALIDATE_CONTAINER(ContainerType, FixedSize, CONTAINER_FIELDS)                     \
+    ssz_error_t ssz_validate_##ContainerType(const uint8_t *data, size_t data_size)               \
+    {                                                                                             \
+        ssz_view_t _view;                                                                         \
+        ssz_view_t *const view = &_view;                                                          \
+        SSZ_VIEW_CHECK_CONTAINER(FixedSize, CONTAINER_FIELDS)                                     \
+    }
+
+#define VIEW_BOOLEAN_FIELD(position)                                                              \
+    do                                                                                            \
+    {                                                                                             \
+        if (ssz_view_uint8(view, (position)) > 1)                                                 \
+        {                                                                                         \
+            return SSZ_ERROR_DESERIALIZATION;                                                     \
+        }                                                                                         \
+    } while (0)
+
+#define VIEW_BOOLEAN_VECTOR_FIELD(position, count)                                                \
+    do                                                                                            \
+    {                                                                                             \
+        if (!is_boolean_bytes(view->data + (position), (count)))                                  \
+        {                                                                                         \
+            return SSZ_ERROR_DESERIALIZATION;                                                     \
+        }                                                                                         \
+    } while (0)
+
+#define VIEW_CONTAINER_FIELD(position, field_size, container_view_func)                             \
+    do                                                                                              \
+    {                                                                                               \
+        ssz_view_t _container;                                                                      \
+        if (container_view_func(view->data + (position), (field_size), &_container) != SSZ_SUCCESS) \
+        {                                                                                           \
+            return SSZ_ERROR_DESERIALIZATION;                                                       \
+        }                                                                                           \
+    } while (0)
+
+#define VIEW_LIST_CONTAINER_FIELD(position, next_position, element_size, max_length, element_view_func) \
+    do                                                                                                  \
+    {                                                                                                   \
+        ssz_view_t _field;                                                                              \
+        VIEW_OFFSET_FIELD(position);                                                                    \
+        if (ssz_view_variable(view, (position), (next_position), &_field) != SSZ_SUCCESS ||             \
+            ssz_view_check_container_list(&_field, (element_size), (max_length),                        \
+                                          element_view_func) != SSZ_SUCCESS)                            \
+        {                                                                                               \
+            return SSZ_ERROR_DESERIALIZATION;                                                           \
+        }                                                                                               \
+    } while (0)
+
+#define VIEW_OFFSET_FIELD(position)                                                       \
+    do                                                                                    \
+    {                                                                                     \
+        size_t _offset = ssz_view_uint32(view, (position));                               \
+        if ((previous_offset == 0 ? _offset != fixed_size : _offset < previous_offset) || \
+            _offset > data_size)                                                          \
+        {                                                                                 \
+            return SSZ_ERROR_DESERIALIZATION;                                             \
+        }                                                                                 \
+        previous_offset = _offset;                                                        \
+    } while (0)
+
+#define VIEW_LIST_FIELD(position, next_position, element_size, max_length)                  \
+    do                                                                                      \
+    {                                                                                       \
+        ssz_view_t _field;                                                                  \
+        VIEW_OFFSET_FIELD(position);                                                        \
+        if (ssz_view_variable(view, (position), (next_position), &_field) != SSZ_SUCCESS || \
+            ssz_view_check_list(&_field, (element_size), (max_length)) != SSZ_SUCCESS)      \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+    } while (0)
+
+#define VIEW_BITLIST_FIELD(position, next_position, max_bits)                               \
+    do                                                                                      \
+    {                                                                                       \
+        ssz_view_t _field;                                                                  \
+        VIEW_OFFSET_FIELD(position);                                                        \
+        if (ssz_view_variable(view, (position), (next_position), &_field) != SSZ_SUCCESS || \
+            ssz_view_check_bitlist(&_field, (max_bits)) != SSZ_SUCCESS)                     \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+    } while (0)
+
+#define VIEW_VARIABLE_LIST_FIELD(position, next_position, max_length, element_view_func)           \
+    do                                                                                             \
+    {                                                                                              \
+        ssz_view_t _field;                                                                         \
+        VIEW_OFFSET_FIELD(position);                                                               \
+        if (ssz_view_variable(view, (position), (next_position), &_field) != SSZ_SUCCESS ||        \
+            ssz_view_check_variable_list(&_field, (max_length), element_view_func) != SSZ_SUCCESS) \
+        {                                                                                          \
+            return SSZ_ERROR_DESERIALIZATION;                                                      \
+        }                                                                                          \
+    } while (0)
+
+#define VIEW_VARIABLE_CONTAINER_FIELD(position, next_position, container_view_func)         \
+    do                                                                                      \
+    {                                                                                       \
+        ssz_view_t _field, _container;                                                      \
+        VIEW_OFFSET_FIELD(position);                                                        \
+        if (ssz_view_variable(view, (position), (next_position), &_field) != SSZ_SUCCESS || \
+            container_view_func(_field.data, _field.size, &_container) != SSZ_SUCCESS)      \
+        {                                                                                   \
+            return SSZ_ERROR_DESERIALIZATION;                                               \
+        }                                                                                   \
+    } while (0)
+
+#define DEFINE_VIEW_UINT_FIELD(ContainerType, field, position, bits)          \
+    uint##bits##_t ssz_view_##ContainerType##_##field(const ssz_view_t *view) \
+    {                                                                         \
+        return ssz_view_uint##bits(view, (position));                         \
+    }
+
+#define DEFINE_VIEW_BOOLEAN_FIELD(ContainerType, field, position)   \
+    bool ssz_view_##ContainerType##_##field(const ssz_view_t *view) \
+    {                                                               \
+        return ssz_view_uint8(view, (position)) != 0;               \
+    }
+
+#define DEFINE_VIEW_BYTES_FIELD(ContainerType, field, position)               \
+    const uint8_t *ssz_view_##ContainerType##_##field(const ssz_view_t *view) \
+    {                                                                         \
+        return view->data + (position);                                       \
+    }
+
+#define DEFINE_VIEW_FIXED_FIELD(ContainerType, field, position, field_size) \
+    ssz_view_t ssz_view_##ContainerType##_##field(const ssz_view_t *view)   \
+    {                                                                       \
+        return ssz_view_fixed(view, (position), (field_size));              \
+    }
+
+#define DEFINE_VIEW_VARIABLE_FIELD(ContainerType, field, position, next_position) \
+    ssz_view_t ssz_view_##ContainerType##_##field(const ssz_view_t *view)         \
+    {                                                                             \
+        ssz_view_t _field = {NULL, 0};                                            \
+        ssz_view_variable(view, (position), (next_position), &_field);            \
+        return _field;                                                            \
+    }
+
+/*
+ * Depth of the Merkle tree over n field roots, evaluated at compile time. Containers are
+ * limited to 128 fields, which is enforced by DEFINE_HASH_TREE_ROOT_CONTAINER.
+ */
+#define SSZ_CHUNK_DEPTH(n) ((n) <= 1 ? 0 : (n) <= 2 ? 1 : (n) <= 4 ? 2 : (n) <= 8 ? 3 : \
+                            (n) <= 16 ? 4 : (n) <= 32 ? 5 : (n) <= 64 ? 6 : 7)
+
+#define DEFINE_HASH_TREE_ROOT_CONTAINER(ContainerType, FieldCount, CONTAINER_FIELDS)         \
+    ssz_error_t hash_tree_root_##ContainerType(const ContainerType *obj, uint8_t *out_root)  \
+    {                                                                                        \
+        _Static_assert((FieldCount) >= 1 && (FieldCount) <= 128, "unsupported field count"); \
+        uint8_t field_roots[(FieldCount) + 1][SSZ_BYTES_PER_CHUNK];                          \
+        size_t chunk_index = 0;                                                              \
+        CONTAINER_FIELDS                                                                     \
+        if (chunk_index != (FieldCount)) {                                                   \
+            return SSZ_ERROR_MERKLEIZATION;                                                  \
+        }                                                                                    \
+        size_t num = (FieldCount);                                                           \
+        for (int level = 0; level < SSZ_CHUNK_DEPTH(FieldCount); level++) {                  \
+            if (num & 1) {                                                                   \
+                memcpy(field_roots[num], zero_hashes[level], SSZ_BYTES_PER_CHUNK);           \
+                num++;                                                                       \
+            }                                                                                \
+            num >>= 1;                                                                       \
+            ssz_hash_pairs(field_roots[0], num, field_roots[0]);                             \
+        }                                                                                    \
+        memcpy(out_root, field_roots[0], SSZ_BYTES_PER_CHUNK);                               \
+        return SSZ_SUCCESS;                                                                  \
+    }
+
+#define HTR_BASIC_FIELD(obj, chunk, field, field_size, ser_func)                          \
+    do                                                                                    \
+    {                                                                                     \
+        size_t tmp_size = (field_size);                                                   \
+        memset(field_roots[(chunk)], 0, SSZ_BYTES_PER_CHUNK);                             \
+        ssz_error_t err_local = ser_func(&(obj)->field, field_roots[(chunk)], &tmp_size); \
+        if (err_local != SSZ_SUCCESS)                                                     \
+        {                                                                                 \
+            return SSZ_ERROR_MERKLEIZATION;                                               \
+        }                                                                                 \
+        (chunk)++;                                                                        \
+    } while (0)
+
+#define HTR_VECTOR_FIELD(obj, chunk, field)                                                                        \
+    do                                                                                                             \
+    {                                                                                                              \
+        size_t byte_count = sizeof((obj)->field);                                                                  \
+        ssz_error_t err_local = ssz_merkleize_packed((const uint8_t *)(obj)->field, byte_count,                    \
+                                                     (byte_count + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK, \
+                                                     field_roots[(chunk)]);                                        \
+        if (err_local != SSZ_SUCCESS)                                                                              \
+        {                                                                                                          \
+            return SSZ_ERROR_MERKLEIZATION;                                                                        \
+        }                                                                                                          \
+        (chunk)++;                                                                                                 \
+    } while (0)
+
+#define HTR_VECTOR_ARRAY_FIELD(obj, chunk, field, element_size, count)                                              \
+    do                                                                                                              \
+    {                                                                                                               \
+        ssz_error_t err_local = SSZ_SUCCESS;                                                                        \
+        if ((element_size) == SSZ_BYTES_PER_CHUNK)                                                                  \
+        {                                                                                                           \
+            err_local = ssz_merkleize_packed(&((obj)->field[0][0]), (element_size) * (count), (count),              \
+                                             field_roots[(chunk)]);                                                 \
+        }                                                                                                           \
+        else                                                                                                        \
+        {                                                                                                           \
+            ssz_merkleizer_t _m;                                                                                    \
+            uint8_t _element_root[SSZ_BYTES_PER_CHUNK];                                                             \
+            size_t _element_chunks = ((element_size) + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;              \
+            err_local = ssz_merkleizer_init(&_m, (count));                                                          \
+            for (size_t _i = 0; _i < (count) && err_local == SSZ_SUCCESS; _i++)                                     \
+            {                                                                                                       \
+                err_local = ssz_merkleize_packed((obj)->field[_i], (element_size), _element_chunks, _element_root); \
+                if (err_local == SSZ_SUCCESS)                                                                       \
+                {                                                                                                   \
+                    err_local = ssz_merkleizer_push_chunks(&_m, _element_root, 1);                                  \
+                }                                                                                                   \
+            }                                                                                                       \
+            if (err_local == SSZ_SUCCESS)                                                                           \
+            {                                                                                                       \
+                err_local = ssz_merkleizer_finalize(&_m, field_roots[(chunk)]);                                     \
+            }                                                                                                       \
+        }                                                                                                           \
+        if (err_local != SSZ_SUCCESS)                                                                               \
+        {                                                                                                           \
+            return SSZ_ERROR_MERKLEIZATION;                                                                         \
+        }                                                                                                           \
+        (chunk)++;                                                                                                  \
+    } while (0)
+
+#define HTR_BITVECTOR_FIELD(obj, chunk, field, bits)                                           \
+    do                                                                                         \
+    {                                                                                          \
+        ssz_error_t err_local = ssz_merkleize_bits((obj)->field, (bits), ((bits) + 255) / 256, \
+                                                   field_roots[(chunk)]);                      \
+        if (err_local != SSZ_SUCCESS)                                                          \
+        {                                                                                      \
+            return SSZ_ERROR_MERKLEIZATION;                                                    \
+        }                                                                                      \
+        (chunk)++;                                                                             \
+    } while (0)
+
+#define HTR_BITLIST_FIELD(obj, chunk, field, max_bits)                                                      \
+    do                                                                                                      \
+    {                                                                                                       \
+        ssz_error_t err_local = ssz_merkleize_bits((obj)->field.data, (obj)->field.length,                  \
+                                                   ((max_bits) + 255) / 256, field_roots[(chunk)]);         \
+        if (err_local == SSZ_SUCCESS)                                                                       \
+        {                                                                                                   \
+            err_local = ssz_mix_in_length(field_roots[(chunk)], (obj)->field.length, field_roots[(chunk)]); \
+        }                                                                                                   \
+        if (err_local != SSZ_SUCCESS)                                                                       \
+        {                                                                                                   \
+            return SSZ_ERROR_MERKLEIZATION;                                                                 \
+        }                                                                                                   \
+        (chunk)++;                                                                                          \
+    } while (0)
+
+#define HTR_PACKED_BITVECTOR_FIELD(obj, chunk, field, bits)                                  \
+    do                                                                                       \
+    {                                                                                        \
+        const ssz_bitvector_t _vec = {(uint64_t *)(obj)->field, (bits)};                     \
+        ssz_error_t err_local = ssz_bitvector_hash_tree_root(&_vec, field_roots[(chunk)]);   \
+        if (err_local != SSZ_SUCCESS)                                                        \
+        {                                                                                    \
+            return SSZ_ERROR_MERKLEIZATION;                                                  \
+        }                                                                                    \
+        (chunk)++;                                                                           \
+    } while (0)
+
+#define HTR_PACKED_BITLIST_FIELD(obj, chunk, field, max_bits)                                                  \
+    do                                                                                                         \
+    {                                                                                                          \
+        ssz_error_t err_local = ssz_bitlist_hash_tree_root(&(obj)->field, (max_bits), field_roots[(chunk)]);   \
+        if (err_local != SSZ_SUCCESS)                                                                          \
+        {                                                                                                      \
+            return SSZ_ERROR_MERKLEIZATION;                                                                    \
+        }                                                                                                      \
+        (chunk)++;                                                                                             \
+    } while (0)
+
+#define HTR_CONTAINER_FIELD(obj, chunk, field, container_htr_func)                       \
+    do                                                                                   \
+    {                                                                                    \
+        ssz_error_t err_local = container_htr_func(&(obj)->field, field_roots[(chunk)]); \
+        if (err_local != SSZ_SUCCESS)                                                    \
+        {                                                                                \
+            return SSZ_ERROR_MERKLEIZATION;                                              \
+        }                                                                                \
+        (chunk)++;                                                                       \
+    } while (0)
+
+#define HTR_LIST_FIELD(obj, chunk, field, element_size, max_length)                                       \
+    do                                                                                                    \
+    {                                                                                                     \
+        ssz_error_t err_local = ssz_hash_tree_root_basic_list((obj)->field.data, (element_size),          \
+                                                              (obj)->field.length, (max_length),          \
+                                                              field_roots[(chunk)]);                      \
+        if (err_local != SSZ_SUCCESS)                                                                     \
+        {                                                                                                 \
+            return SSZ_ERROR_MERKLEIZATION;                                                               \
+        }                                                                                                 \
+        (chunk)++;                                                                                        \
+    } while (0)
+
+#define HTR_LIST_CONTAINER_FIELD(obj, chunk, field, max_length, container_htr_func)                         \
+    do                                                                                                      \
+    {                                                                                                       \
+        ssz_merkleizer_t _m;                                                                                \
+        uint8_t _element_root[SSZ_BYTES_PER_CHUNK];                                                         \
+        ssz_error_t err_local = ssz_merkleizer_init(&_m, (max_length));                                     \
+        for (uint64_t _i = 0; _i < (obj)->field.length && err_local == SSZ_SUCCESS; _i++)                   \
+        {                                                                                                   \
+            err_local = container_htr_func(&(obj)->field.data[_i], _element_root);                          \
+            if (err_local == SSZ_SUCCESS)                                                                   \
+            {                                                                                               \
+                err_local = ssz_merkleizer_push_chunks(&_m, _element_root, 1);                              \
+            }                                                                                               \
+        }                                                                                                   \
+        if (err_local == SSZ_SUCCESS)                                                                       \
+        {                                                                                                   \
+            err_local = ssz_merkleizer_finalize(&_m, field_roots[(chunk)]);                                 \
+        }                                                                                                   \
+        if (err_local == SSZ_SUCCESS)                                                                       \
+        {                                                                                                   \
+            err_local = ssz_mix_in_length(field_roots[(chunk)], (obj)->field.length, field_roots[(chunk)]); \
+        }                                                                                                   \
+        if (err_local != SSZ_SUCCESS)                                                                       \
+        {                                                                                                   \
+            return SSZ_ERROR_MERKLEIZATION;                                                                 \
+        }                                                                                                   \
+        (chunk)++;                                                                                          \
+    } while (0)
+
 #endif /* SSZ_GENERATOR_H */
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef SSZ_HASH_H
+#define SSZ_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * Computes the SHA-256 digest of a byte array.
+ *
+ * The transform is selected once, at startup, from the capabilities of the running CPU.
+ * On x86 processors that implement the SHA extensions a hardware-accelerated backend is
+ * used; everywhere else the portable mincrypt implementation is used. Both backends
+ * produce identical digests.
+ *
+ * @param data Pointer to the input bytes.
+ * @param len Number of input bytes.
+ * @param out_digest Output buffer to write the digest (32 bytes).
+ */
+void ssz_sha256(const uint8_t *data, size_t len, uint8_t *out_digest);
+
+/**
+ * Computes the SHA-256 digest of exactly 64 bytes.
+ *
+ * Every Merkle tree node is the hash of two 32-byte chunks, so the second compression block
+ * is always the same padding block. This primitive skips the streaming context and the
+ * buffered padding of the general hash, and runs that block from a precomputed message
+ * schedule. The digest equals ssz_sha256(in, 64, out_digest).
+ *
+ * @param in Pointer to the 64 input bytes.
+ * @param out_digest Output buffer to write the digest (32 bytes). May be the same pointer as in.
+ */
+void ssz_sha256_64(const uint8_t *in, uint8_t *out_digest);
+
+/**
+ * Computes the SHA-256 digests of count consecutive 64-byte messages.
+ *
+ * Messages are hashed several at a time with a multi-buffer AVX2 or AVX-512 kernel when the
+ * CPU supports one, and one at a time otherwise. Digests are identical to calling
+ * ssz_sha256 on each message.
+ *
+ * @param in Pointer to count * 64 input bytes.
+ * @param count Number of messages.
+ * @param out Output buffer for count * 32 digest bytes. May be the same pointer as in.
+ */
+void ssz_sha256_64_batch(const uint8_t *in, size_t count, uint8_t *out);
+
+/**
+ * Returns the name of the SHA-256 backend selected for this process.
+ *
+ * @return A static string such as "sha-ni" or "generic".
+ */
+const char *ssz_sha256_backend(void);
+
+/**
+ * Returns the name of the multi-buffer backend used by ssz_sha256_64_batch.
+ *
+ * @return A static string such as "avx512", "avx2" or "scalar".
+ */
+const char *ssz_sha256_batch_backend(void);
+
+/**
+ * Instruction set extensions of the running CPU that the library dispatches on.
+ */
+typedef struct
+{
+    bool sse2;   /**< SSE2. */
+    bool shani;  /**< SHA extensions, with SSSE3 and SSE4.1. */
+    bool avx2;   /**< AVX2, with YMM state enabled by the OS. */
+    bool avx512; /**< AVX-512F and AVX-512BW, with ZMM state enabled by the OS. */
+    bool lzcnt;  /**< LZCNT. */
+} ssz_cpu_features_t;
+
+/**
+ * Detects the instruction set extensions of the running CPU.
+ *
+ * This is the single detection path behind every runtime-dispatched kernel in the library.
+ * AVX2 and AVX-512 are only reported when the OS has enabled the matching register state.
+ *
+ * @param features Output structure; every field is false on non-x86 builds.
+ */
+void ssz_cpu_detect(ssz_cpu_features_t *features);
+
+#endif /* SSZ_HASH_H */
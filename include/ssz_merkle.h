@@ -5,13 +5,28 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "ssz_types.h"
+#include "ssz_constants.h"
+
+/**
+ * Holds the state of an incremental Merkle root computation.
+ * Chunks are folded into their parents as soon as a sibling is available, so only one
+ * pending node per tree level is kept and memory stays constant regardless of input size.
+ */
+typedef struct
+{
+    uint8_t pending[SSZ_MAX_MERKLE_DEPTH][SSZ_BYTES_PER_CHUNK]; /**< Left sibling waiting at each level, valid where the bit of count is set. */
+    size_t count;                                              /**< Number of chunks pushed so far. */
+    size_t limit;                                              /**< Maximum number of chunks, or 0 for no limit. */
+} ssz_merkleizer_t;
 
 /**
  * Computes the Merkle root from an array of chunks.
  *
- * This function constructs a Merkle tree by first copying the provided chunks
- * into leaf nodes, padding with zeros if necessary, and then iteratively hashing
- * pairs of nodes until a single root is obtained.
+ * This function hashes the provided chunks pairwise, level by level, until a single root
+ * is obtained. The tree is virtually padded with zero chunks up to the next power of two of
+ * the limit (or of chunk_count when limit is zero), but padding subtrees are taken from a
+ * precomputed table of zero-subtree roots instead of being hashed, so memory and time are
+ * proportional to chunk_count. Limits as large as 2^64 chunks are therefore supported.
  *
  * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
  * @param chunk_count Number of chunks provided.
@@ -25,6 +40,224 @@ ssz_error_t ssz_merkleize(
     size_t limit,
     uint8_t *out_root);
 
+/**
+ * Returns the size of the scratch buffer that ssz_merkleize_ex needs.
+ *
+ * @param chunk_count Number of chunks to merkleize.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return The required scratch size in bytes (chunk_count * SSZ_BYTES_PER_CHUNK, or 0 when no hashing is needed).
+ */
+size_t ssz_merkleize_scratch_size(
+    size_t chunk_count,
+    size_t limit);
+
+/**
+ * Computes the Merkle root from an array of chunks without allocating memory.
+ *
+ * Behaves like ssz_merkleize, but the working nodes live in a caller-provided scratch buffer
+ * of at least ssz_merkleize_scratch_size(chunk_count, limit) bytes, which a hot loop can
+ * reuse across calls. Passing the chunk buffer itself as scratch selects the in-place mode:
+ * the tree is hashed directly into the chunks, which are overwritten, and nothing is copied.
+ *
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed; if non-zero, chunk_count must not exceed this limit.
+ * @param scratch Writable working buffer, or chunks itself for in-place hashing. May be NULL if the scratch size is 0.
+ * @param scratch_size Size of scratch in bytes.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_OUT_OF_RANGE if the scratch buffer is too small, or another error code on failure.
+ */
+ssz_error_t ssz_merkleize_ex(
+    const uint8_t *chunks,
+    size_t chunk_count,
+    size_t limit,
+    uint8_t *scratch,
+    size_t scratch_size,
+    uint8_t *out_root);
+
+/**
+ * Computes the Merkle root from an array of chunks using the built-in worker pool.
+ *
+ * The leaves are split into power-of-two subtrees whose roots are computed concurrently, and
+ * the subtree roots are combined on the calling thread. The result is bit-identical to
+ * ssz_merkleize. Inputs below SSZ_PARALLEL_MERKLEIZE_MIN_CHUNKS chunks are merkleized serially.
+ * The number of threads is configured with ssz_pool_set_threads.
+ *
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed; if non-zero, chunk_count must not exceed this limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_parallel(
+    const uint8_t *chunks,
+    size_t chunk_count,
+    size_t limit,
+    uint8_t *out_root);
+
+/**
+ * Initializes a streaming merkleizer.
+ *
+ * The resulting root is the same as ssz_merkleize over all chunks pushed before finalization
+ * with the same limit. A limit of 0 sizes the tree from the number of chunks pushed.
+ *
+ * @param m Pointer to the merkleizer to initialize.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleizer_init(
+    ssz_merkleizer_t *m,
+    size_t limit);
+
+/**
+ * Appends chunks to a streaming merkleizer.
+ *
+ * Completed subtrees are hashed immediately, a level at a time, so chunks may be discarded
+ * by the caller as soon as this function returns.
+ *
+ * @param m Pointer to an initialized merkleizer.
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION if the limit would be exceeded.
+ */
+ssz_error_t ssz_merkleizer_push_chunks(
+    ssz_merkleizer_t *m,
+    const uint8_t *chunks,
+    size_t chunk_count);
+
+/**
+ * Computes the Merkle root of all chunks pushed so far.
+ *
+ * The merkleizer is not modified, so more chunks may be pushed afterwards.
+ *
+ * @param m Pointer to an initialized merkleizer.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleizer_finalize(
+    const ssz_merkleizer_t *m,
+    uint8_t *out_root);
+
+/**
+ * Computes the Merkle root of a byte string packed into chunks.
+ *
+ * The bytes are split into SSZ_BYTES_PER_CHUNK-byte chunks, the last one zero-padded, and
+ * merkleized with the given limit. The result equals ssz_pack followed by ssz_merkleize, but
+ * the input is streamed rather than copied into a chunk buffer.
+ *
+ * @param bytes Pointer to the input bytes. May be NULL if byte_count is 0.
+ * @param byte_count Number of input bytes.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_packed(
+    const uint8_t *bytes,
+    size_t byte_count,
+    size_t limit,
+    uint8_t *out_root);
+
+/**
+ * Computes the hash tree root of a vector of basic values.
+ *
+ * The elements are merkleized straight from the caller's array, which must hold them in SSZ
+ * (little-endian) byte order, as a native uint8_t..uint64_t array does on little-endian
+ * hosts. Only the final partial chunk is copied, into a zero-padded stack buffer. The result
+ * equals ssz_pack followed by ssz_merkleize with the vector's chunk count as the limit.
+ *
+ * @param elements Pointer to the element array. May be NULL if element_count is 0.
+ * @param element_size Size of each element in bytes (1, 2, 4, 8, 16 or 32).
+ * @param element_count Number of elements in the vector.
+ * @param out_root Output buffer to write the hash tree root (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_hash_tree_root_basic_vector(
+    const void *elements,
+    size_t element_size,
+    size_t element_count,
+    uint8_t *out_root);
+
+/**
+ * Computes the hash tree root of a list of basic values.
+ *
+ * Like ssz_hash_tree_root_basic_vector, but the chunk limit is derived from max_length and
+ * the element count is mixed into the root.
+ *
+ * @param elements Pointer to the element array. May be NULL if element_count is 0.
+ * @param element_size Size of each element in bytes (1, 2, 4, 8, 16 or 32).
+ * @param element_count Number of elements in the list.
+ * @param max_length Maximum number of elements of the list type.
+ * @param out_root Output buffer to write the hash tree root (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_SERIALIZATION if element_count exceeds max_length, or another error code on failure.
+ */
+ssz_error_t ssz_hash_tree_root_basic_list(
+    const void *elements,
+    size_t element_size,
+    size_t element_count,
+    size_t max_length,
+    uint8_t *out_root);
+
+/**
+ * Computes the Merkle root of an array of boolean values packed as a bitfield.
+ *
+ * This is the root of a bitvector, or of a bitlist before its length is mixed in. Unlike
+ * ssz_pack_bits, an empty array yields the root of zero chunks.
+ *
+ * @param bits Pointer to the array of boolean values. May be NULL if bit_count is 0.
+ * @param bit_count Number of boolean values.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_bits(
+    const bool *bits,
+    size_t bit_count,
+    size_t limit,
+    uint8_t *out_root);
+
+/**
+ * Hashes adjacent pairs of chunks into their parent nodes.
+ *
+ * For each i in [0, n_pairs) this computes SHA256(in[64 * i .. 64 * i + 63]) and writes it to
+ * out[32 * i .. 32 * i + 31], i.e. one level of a Merkle tree. Independent pairs are hashed
+ * in parallel lanes when the CPU supports a multi-buffer SHA-256 kernel.
+ *
+ * @param in Pointer to n_pairs * 2 chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param n_pairs Number of chunk pairs to hash.
+ * @param out Output buffer for n_pairs chunks. May be the same pointer as in, which hashes a level in place.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_hash_pairs(
+    const uint8_t *in,
+    size_t n_pairs,
+    uint8_t *out);
+
+/**
+ * Verifies many Merkle branches against the same root in one pass.
+ *
+ * Proof i claims that leaves[i] is the node at generalized index gindices[i] of the tree
+ * whose root is root. Its branch holds floor(log2(gindices[i])) sibling nodes, ordered from
+ * the bottom up as in the consensus specs' is_valid_merkle_branch. The proofs are folded level
+ * by level in lockstep, so the parent hashes of one level are computed in a single batch.
+ * Proofs that reach the same node through the same upper branch are merged and their
+ * shared path is hashed only once.
+ *
+ * @param leaves Pointer to gindex_count leaves (each leaf is SSZ_BYTES_PER_CHUNK bytes).
+ * @param branches Pointer to gindex_count branch pointers.
+ * @param gindices Pointer to the generalized indices of the leaves (each at least 1).
+ * @param gindex_count Number of proofs.
+ * @param root Pointer to the expected root (SSZ_BYTES_PER_CHUNK bytes).
+ * @param out_valid Output array of gindex_count flags, set to whether each proof is valid.
+ * @return SSZ_SUCCESS if every proof was checked, SSZ_ERROR_OUT_OF_RANGE if an index is 0, or another error code on failure.
+ */
+ssz_error_t ssz_verify_branches(
+    const uint8_t *leaves,
+    const uint8_t *const *branches,
+    const uint64_t *gindices,
+    size_t gindex_count,
+    const uint8_t *root,
+    bool *out_valid);
+
 /**
  * Packs a contiguous byte array into fixed-size chunks.
  *
@@ -0,0 +1,50 @@
+#ifndef SSZ_POOL_H
+#define SSZ_POOL_H
+
+#include <stddef.h>
+#include "ssz_types.h"
+
+/**
+ * Defines the function type executed for each task of a parallel job.
+ *
+ * @param ctx Pointer to the job context passed to ssz_pool_run.
+ * @param index Index of the task, in [0, n_tasks).
+ */
+typedef void (*ssz_pool_task_fn)(void *ctx, size_t index);
+
+/**
+ * Sets the number of threads used by the built-in worker pool.
+ *
+ * The calling thread always takes part in a job, so n_threads - 1 workers are started.
+ * A value of 1 disables parallelism and a value of 0 selects the number of online CPUs,
+ * which is also the default when this function is never called. Must not be called while
+ * a job is running.
+ *
+ * @param n_threads Number of threads, or 0 for the number of online CPUs.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if the workers cannot be started.
+ */
+ssz_error_t ssz_pool_set_threads(size_t n_threads);
+
+/**
+ * Returns the number of threads used by the built-in worker pool.
+ *
+ * Inside a task this is 1, since a nested job runs serially on the calling thread.
+ *
+ * @return The configured thread count, including the calling thread.
+ */
+size_t ssz_pool_threads(void);
+
+/**
+ * Runs fn(ctx, i) for every i in [0, n_tasks) on the built-in worker pool.
+ *
+ * Tasks are handed out dynamically to the workers and the calling thread, and the call
+ * returns once all of them have completed. Jobs submitted from several threads are run one
+ * after another, and a job submitted from inside a task runs serially on that thread.
+ *
+ * @param fn Function to execute for each task.
+ * @param ctx Context pointer passed to every task.
+ * @param n_tasks Number of tasks.
+ */
+void ssz_pool_run(ssz_pool_task_fn fn, void *ctx, size_t n_tasks);
+
+#endif /* SSZ_POOL_H */
@@ -0,0 +1,102 @@
+#ifndef SSZ_PROOF_H
+#define SSZ_PROOF_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ssz_types.h"
+#include "ssz_tree.h"
+
+/**
+ * Computes the generalized indices of the helper nodes of a multiproof.
+ *
+ * The helpers are the siblings of every node on the paths from the requested nodes to the
+ * root, minus the nodes on those paths themselves, since a verifier can compute those.
+ * They are returned in descending order, so for a single index they form its branch from
+ * the bottom up. Duplicate requested indices are allowed.
+ *
+ * @param gindices Pointer to the requested generalized indices (each at least 1).
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param capacity Capacity of out_indices. 64 * gindex_count entries always suffice.
+ * @param out_count Pointer to store the number of helper indices.
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_OUT_OF_RANGE if an index is 0 or the capacity is too small, or another error code on failure.
+ */
+ssz_error_t ssz_multiproof_indices(
+    const uint64_t *gindices,
+    size_t gindex_count,
+    uint64_t *out_indices,
+    size_t capacity,
+    size_t *out_count);
+
+/**
+ * Builds the Merkle branch of a single node of a cached hash tree.
+ *
+ * The branch lists the sibling of the node, then the sibling of its parent, and so on up to
+ * the children of the root. Its length is the depth of gindex, floor(log2(gindex)). All nodes
+ * are read from the tree's cache; no subtree is rehashed.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindex Generalized index of the proven node.
+ * @param out_branch Output buffer for the branch (floor(log2(gindex)) * SSZ_BYTES_PER_CHUNK bytes).
+ * @param out_depth Pointer to store the number of branch nodes written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_proof(
+    ssz_tree_t *tree,
+    uint64_t gindex,
+    uint8_t *out_branch,
+    size_t *out_depth);
+
+/**
+ * Builds a deduplicated multiproof for several nodes of a cached hash tree.
+ *
+ * The helper indices are those of ssz_multiproof_indices, and out_nodes receives the node at
+ * each helper index in the same order. All nodes are read from the tree's cache.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindices Pointer to the requested generalized indices.
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param out_nodes Output buffer for the helper nodes (capacity * SSZ_BYTES_PER_CHUNK bytes).
+ * @param capacity Capacity of out_indices and out_nodes, in entries.
+ * @param out_count Pointer to store the number of helpers written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_multiproof(
+    ssz_tree_t *tree,
+    const uint64_t *gindices,
+    size_t gindex_count,
+    uint64_t *out_indices,
+    uint8_t *out_nodes,
+    size_t capacity,
+    size_t *out_count);
+
+/**
+ * Builds a deduplicated multiproof directly from an array of chunks.
+ *
+ * A temporary cached tree is built over the chunks, as by ssz_tree_init, so every internal
+ * node is hashed exactly once no matter how many nodes are proven.
+ *
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param gindices Pointer to the requested generalized indices.
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param out_nodes Output buffer for the helper nodes (capacity * SSZ_BYTES_PER_CHUNK bytes).
+ * @param capacity Capacity of out_indices and out_nodes, in entries.
+ * @param out_count Pointer to store the number of helpers written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkle_multiproof(
+    const uint8_t *chunks,
+    size_t chunk_count,
+    size_t limit,
+    const uint64_t *gindices,
+    size_t gindex_count,
+    uint64_t *out_indices,
+    uint8_t *out_nodes,
+    size_t capacity,
+    size_t *out_count);
+
+#endif /* SSZ_PROOF_H */
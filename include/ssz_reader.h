@@ -0,0 +1,211 @@
+#ifndef SSZ_READER_H
+#define SSZ_READER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssz_types.h"
+#include "ssz_arena.h"
+
+#define SSZ_READER_MAX_OFFSETS 16
+
+typedef struct ssz_reader ssz_reader_t;
+
+/**
+ * Defines the function type that decodes an object one field at a time for a reader.
+ *
+ * The reader calls it in two phases. While reader->expecting is set the function announces
+ * how many bytes the current field needs with one of the ssz_reader_expect* functions, or
+ * calls ssz_reader_end once every field is done. Otherwise it decodes exactly that many bytes
+ * from data and reports them with ssz_reader_consumed. DEFINE_READ_CONTAINER generates such
+ * functions from a field list.
+ *
+ * @param reader Pointer to the reader.
+ * @param data Pointer to the bytes of the current field, or NULL while expecting.
+ * @param data_size Number of bytes, as announced in the expecting phase.
+ * @return SSZ_SUCCESS on success, or an error code that aborts the reader.
+ */
+typedef ssz_error_t (*ssz_reader_step_fn)(ssz_reader_t *reader, const uint8_t *data, size_t data_size);
+
+/**
+ * A resumable push parser that decodes a serialized object from arbitrary-sized chunks.
+ *
+ * Bytes are fed with ssz_reader_push as they arrive. Each field is decoded as soon as all of
+ * its bytes are available, either straight from the pushed chunk or, when it straddles
+ * chunks, from a caller-supplied staging buffer. The staging buffer caps the memory held for
+ * incomplete input: byte vectors and fixed-size element lists are decoded in pieces that fit
+ * it, and only other fields must fit it whole.
+ */
+struct ssz_reader
+{
+    ssz_reader_step_fn step;                  /**< Field-by-field decoder of the object. */
+    void *object;                             /**< Object being decoded. */
+    ssz_arena_t *arena;                       /**< Arena for nested lists, or NULL for malloc. */
+    uint8_t *buf;                             /**< Staging buffer for fields split across chunks. */
+    size_t capacity;                          /**< Size of the staging buffer in bytes. */
+    size_t buffered;                          /**< Bytes of the current field staged so far. */
+    size_t need;                              /**< Bytes the current field waits for. */
+    size_t position;                          /**< Bytes of the object decoded so far. */
+    size_t total_size;                        /**< Serialized size of the object. */
+    size_t stage;                             /**< Index of the current field entry. */
+    size_t field_size;                        /**< Size of the current multi-step field. */
+    size_t field_position;                    /**< Bytes of the current multi-step field done. */
+    bool field_started;                       /**< Whether a multi-step field is in progress. */
+    bool field_variable;                      /**< Whether that field is a variable-size one. */
+    uint32_t offsets[SSZ_READER_MAX_OFFSETS]; /**< Offsets read from the fixed part. */
+    size_t offset_count;                      /**< Number of offsets read. */
+    size_t variable_index;                    /**< Index of the next variable-size field. */
+    bool expecting;                           /**< Whether the step function is asked for a size. */
+    bool complete;                            /**< Whether the whole object has been decoded. */
+    ssz_error_t error;                        /**< First error seen; once set every call fails with it. */
+};
+
+/**
+ * Initializes a reader for an object of known serialized size.
+ *
+ * The size comes from the transport, such as the length prefix of a req/resp chunk.
+ *
+ * @param reader Pointer to the reader to initialize.
+ * @param staging Staging buffer owned by the caller; it must outlive the reader.
+ * @param staging_size Size of the staging buffer in bytes.
+ * @param total_size Serialized size of the object.
+ * @param step Field-by-field decoder of the object.
+ * @param object Object to decode into.
+ * @param arena Arena for nested lists, or NULL to use malloc.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION on invalid arguments or if the
+ *         first field does not fit the object or the staging buffer.
+ */
+ssz_error_t ssz_reader_init(
+    ssz_reader_t *reader,
+    uint8_t *staging,
+    size_t staging_size,
+    size_t total_size,
+    ssz_reader_step_fn step,
+    void *object,
+    ssz_arena_t *arena);
+
+/**
+ * Feeds the next chunk of serialized input to the reader.
+ *
+ * Every complete field in the chunk is decoded before the call returns, and the remainder is
+ * staged. Bytes past the end of the object are an error.
+ *
+ * @param reader Pointer to the reader.
+ * @param data Pointer to the chunk.
+ * @param len Number of bytes in the chunk.
+ * @return SSZ_SUCCESS on success, or the first error of the reader.
+ */
+ssz_error_t ssz_reader_push(
+    ssz_reader_t *reader,
+    const uint8_t *data,
+    size_t len);
+
+/**
+ * Returns how many more bytes the reader needs before it can decode its next field.
+ *
+ * @param reader Pointer to the reader.
+ * @return The number of bytes, or 0 once the object is complete or the reader has failed.
+ */
+size_t ssz_reader_needed(
+    const ssz_reader_t *reader);
+
+/**
+ * Returns whether the whole object has been decoded.
+ *
+ * @param reader Pointer to the reader.
+ * @return true once every byte of the object has been decoded without error.
+ */
+bool ssz_reader_complete(
+    const ssz_reader_t *reader);
+
+/**
+ * Announces that the current field needs size more bytes, decoded in one step.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Number of bytes.
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_DESERIALIZATION if size runs past the object, or
+ *         SSZ_ERROR_OUT_OF_RANGE if size does not fit the staging buffer.
+ */
+ssz_error_t ssz_reader_expect(
+    ssz_reader_t *reader,
+    size_t size);
+
+/**
+ * Announces a byte vector of size bytes that may be decoded in several steps.
+ *
+ * Each step receives as many bytes as fit the staging buffer, and field_position holds the
+ * number of bytes of the vector already decoded.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Size of the vector in bytes.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION if size runs past the object.
+ */
+ssz_error_t ssz_reader_expect_bytes(
+    ssz_reader_t *reader,
+    size_t size);
+
+/**
+ * Announces the next variable-size field, decoded in one step.
+ *
+ * Its size follows from the offsets of the fixed part, which are checked when the first
+ * variable-size field is announced.
+ *
+ * @param reader Pointer to the reader.
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_DESERIALIZATION on invalid offsets, or
+ *         SSZ_ERROR_OUT_OF_RANGE if the field does not fit the staging buffer.
+ */
+ssz_error_t ssz_reader_expect_variable(
+    ssz_reader_t *reader);
+
+/**
+ * Announces the next variable-size field as a list of fixed-size elements, decoded in steps
+ * of whole elements.
+ *
+ * On the first call for the field, field_size holds the size of the whole list and
+ * field_position is 0; on later calls field_position holds the bytes already decoded.
+ *
+ * @param reader Pointer to the reader.
+ * @param element_size Size of one element in bytes.
+ * @param max_length Maximum number of elements.
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_DESERIALIZATION on invalid offsets or list size,
+ *         or SSZ_ERROR_OUT_OF_RANGE if one element does not fit the staging buffer.
+ */
+ssz_error_t ssz_reader_expect_elements(
+    ssz_reader_t *reader,
+    size_t element_size,
+    size_t max_length);
+
+/**
+ * Stores an offset of the fixed part and moves on to the next field.
+ *
+ * @param reader Pointer to the reader.
+ * @param data Pointer to the 4 offset bytes.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if there are more than
+ *         SSZ_READER_MAX_OFFSETS offsets.
+ */
+ssz_error_t ssz_reader_read_offset(
+    ssz_reader_t *reader,
+    const uint8_t *data);
+
+/**
+ * Reports that the current step decoded size bytes, moving on to the next field once the
+ * current one is finished.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Number of bytes decoded.
+ * @return SSZ_SUCCESS.
+ */
+ssz_error_t ssz_reader_consumed(
+    ssz_reader_t *reader,
+    size_t size);
+
+/**
+ * Marks the object as complete once the step function has no field left.
+ *
+ * @param reader Pointer to the reader.
+ * @return SSZ_SUCCESS if the object ends at total_size, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_reader_end(
+    ssz_reader_t *reader);
+
+#endif /* SSZ_READER_H */
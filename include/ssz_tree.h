@@ -0,0 +1,110 @@
+#ifndef SSZ_TREE_H
+#define SSZ_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ssz_types.h"
+#include "ssz_constants.h"
+
+/**
+ * Represents a persistent Merkle tree over a list of chunks with cached internal nodes.
+ *
+ * Level 0 holds the leaves and level l holds ceil(chunk_count / 2^l) nodes, up to the level
+ * where a single node remains. Padding subtrees are never stored; they are taken from the
+ * zero_hashes table. Leaves changed with ssz_tree_set_chunk are recorded as dirty and only
+ * their ancestors are rehashed by ssz_tree_root.
+ */
+typedef struct
+{
+    uint8_t *levels[SSZ_MAX_MERKLE_DEPTH + 1];     /**< Node storage per level, SSZ_BYTES_PER_CHUNK bytes per node. */
+    size_t capacities[SSZ_MAX_MERKLE_DEPTH + 1];   /**< Allocated node capacity per level. */
+    size_t chunk_count;                            /**< Number of leaves currently in the tree. */
+    size_t limit;                                  /**< Maximum number of leaves, or 0 for no limit. */
+    size_t *dirty;                                 /**< Indices of leaves changed since the last root computation. */
+    size_t dirty_count;                            /**< Number of entries in dirty. */
+    size_t dirty_capacity;                         /**< Allocated capacity of dirty. */
+} ssz_tree_t;
+
+/**
+ * Builds a cached hash tree over an array of chunks.
+ *
+ * All internal nodes are computed once, level by level. The root of the new tree equals
+ * ssz_merkleize(chunks, chunk_count, limit, ...).
+ *
+ * @param tree Pointer to the tree to initialize.
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes). May be NULL if chunk_count is 0.
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_init(
+    ssz_tree_t *tree,
+    const uint8_t *chunks,
+    size_t chunk_count,
+    size_t limit);
+
+/**
+ * Releases all memory owned by a cached hash tree.
+ *
+ * @param tree Pointer to the tree to release.
+ */
+void ssz_tree_free(ssz_tree_t *tree);
+
+/**
+ * Replaces or appends a leaf of a cached hash tree.
+ *
+ * The leaf is written immediately and marked dirty; no hashing takes place until the next
+ * call to ssz_tree_root. An index equal to the current chunk count appends a leaf.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param index Index of the leaf, at most the current chunk count.
+ * @param chunk Pointer to the new leaf value (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_OUT_OF_RANGE if the index or limit is exceeded, or another error code on failure.
+ */
+ssz_error_t ssz_tree_set_chunk(
+    ssz_tree_t *tree,
+    size_t index,
+    const uint8_t *chunk);
+
+/**
+ * Computes the Merkle root of a cached hash tree.
+ *
+ * Only the ancestors of dirty leaves are rehashed. Dirty paths are processed one level at a
+ * time so that shared ancestors are hashed once and independent nodes of a level are hashed
+ * together with ssz_hash_pairs. The cost is O(k log n) for k dirty leaves out of n.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_root(
+    ssz_tree_t *tree,
+    uint8_t *out_root);
+
+/**
+ * Reads a node of a cached hash tree by generalized index.
+ *
+ * Generalized index 1 is the root, and the children of node g are 2g and 2g + 1, so the
+ * leaves of a tree of depth d are 2^d to 2^(d+1) - 1, where d is the depth implied by the limit.
+ * Stored nodes are returned directly; padding nodes come from the zero_hashes table.
+ * Pending leaf updates are hashed first.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindex Generalized index of the node.
+ * @param out_node Output buffer to write the node (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, SSZ_ERROR_OUT_OF_RANGE if the index lies outside the tree, or another error code on failure.
+ */
+ssz_error_t ssz_tree_get_node(
+    ssz_tree_t *tree,
+    uint64_t gindex,
+    uint8_t *out_node);
+
+/**
+ * Returns the depth of a cached hash tree, i.e. the generalized index depth of its leaves.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @return The depth implied by the limit, or by the chunk count when the limit is 0.
+ */
+uint32_t ssz_tree_depth(const ssz_tree_t *tree);
+
+#endif /* SSZ_TREE_H */
@@ -13,6 +13,29 @@
  */
 bool is_zero(const uint8_t *ptr, size_t len);
 
+/**
+ * Checks if every byte of the given memory region is 0x00 or 0x01, i.e. a valid SSZ boolean.
+ * @param ptr Pointer to the memory region.
+ * @param len The length of the memory region in bytes.
+ * @return true if all bytes are 0 or 1, otherwise false.
+ */
+bool is_boolean_bytes(const uint8_t *ptr, size_t len);
+
+/**
+ * Finds the highest set bit of a little-endian bit array, as used by SSZ bitlists.
+ * @param ptr Pointer to the memory region.
+ * @param len The length of the memory region in bytes.
+ * @param out_bit Set to the index of the highest set bit (byte * 8 + bit) when one exists.
+ * @return true if a set bit was found, false if the region is all zeros.
+ */
+bool find_last_set_bit(const uint8_t *ptr, size_t len, size_t *out_bit);
+
+/**
+ * Returns the name of the scanning backend used by is_zero, is_boolean_bytes and find_last_set_bit.
+ * @return A static string such as "avx2" or "word".
+ */
+const char *ssz_scan_backend(void);
+
 /**
  * Computes the next power of two for the given value.
  * If the input is already a power of two, the same value is returned.
@@ -23,6 +46,16 @@ bool is_zero(const uint8_t *ptr, size_t len);
  */
 uint64_t next_pow_of_two(uint64_t value);
 
+/**
+ * Computes the base-2 logarithm of the given value, rounded up.
+ * This is the depth of a Merkle tree with the given number of leaves once the
+ * leaf count is padded to a power of two. Zero and one both yield 0.
+ *
+ * @param value The input value.
+ * @return The smallest d such that 2^d >= value.
+ */
+uint32_t ceil_log2(uint64_t value);
+
 /**
  * Validates whether the provided offset is within the maximum allowed SSZ offset range.
  * This check is based on SSZ's fixed offset size of SSZ_BYTES_PER_LENGTH_OFFSET bytes.
@@ -0,0 +1,228 @@
+#ifndef SSZ_VIEW_H
+#define SSZ_VIEW_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ssz_types.h"
+#include "ssz_constants.h"
+
+/**
+ * Passed as next_position to mark a variable-size field as the last one, so that it extends
+ * to the end of the enclosing view.
+ */
+#define SSZ_VIEW_END SIZE_MAX
+
+/**
+ * A read-only window onto serialized SSZ bytes.
+ *
+ * Views never own or copy memory: the underlying buffer must outlive every view derived from
+ * it. Container views are created by the generated ssz_view_<Type> functions, which check all
+ * offsets once so that field accessors can read straight from the buffer afterwards.
+ */
+typedef struct
+{
+    const uint8_t *data; /**< First byte of the viewed value. */
+    size_t size;         /**< Number of bytes in the viewed value. */
+} ssz_view_t;
+
+/**
+ * Defines the function type that validates serialized bytes and creates a view over them.
+ *
+ * @param data Pointer to the serialized bytes.
+ * @param data_size Number of bytes.
+ * @param view Output view.
+ * @return SSZ_SUCCESS if the bytes are well-formed, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+typedef ssz_error_t (*ssz_view_fn)(const uint8_t *data, size_t data_size, ssz_view_t *view);
+
+/**
+ * Reads a little-endian uint8 at a position inside a view. The position is not checked.
+ *
+ * @param view Pointer to the view.
+ * @param position Byte position inside the view.
+ * @return The value.
+ */
+static inline uint8_t ssz_view_uint8(const ssz_view_t *view, size_t position)
+{
+    return view->data[position];
+}
+
+/**
+ * Reads a little-endian uint16 at a position inside a view. The position is not checked.
+ *
+ * @param view Pointer to the view.
+ * @param position Byte position inside the view.
+ * @return The value.
+ */
+static inline uint16_t ssz_view_uint16(const ssz_view_t *view, size_t position)
+{
+    uint16_t value;
+    memcpy(&value, view->data + position, sizeof(value));
+    return value;
+}
+
+/**
+ * Reads a little-endian uint32 at a position inside a view. The position is not checked.
+ *
+ * @param view Pointer to the view.
+ * @param position Byte position inside the view.
+ * @return The value.
+ */
+static inline uint32_t ssz_view_uint32(const ssz_view_t *view, size_t position)
+{
+    uint32_t value;
+    memcpy(&value, view->data + position, sizeof(value));
+    return value;
+}
+
+/**
+ * Reads a little-endian uint64 at a position inside a view. The position is not checked.
+ *
+ * @param view Pointer to the view.
+ * @param position Byte position inside the view.
+ * @return The value.
+ */
+static inline uint64_t ssz_view_uint64(const ssz_view_t *view, size_t position)
+{
+    uint64_t value;
+    memcpy(&value, view->data + position, sizeof(value));
+    return value;
+}
+
+/**
+ * Returns a sub-view of a fixed-size value at a position inside a view. Not checked.
+ *
+ * @param view Pointer to the view.
+ * @param position Byte position inside the view.
+ * @param size Size of the value in bytes.
+ * @return The sub-view.
+ */
+static inline ssz_view_t ssz_view_fixed(const ssz_view_t *view, size_t position, size_t size)
+{
+    ssz_view_t sub = {view->data + position, size};
+    return sub;
+}
+
+/**
+ * Returns the sub-view of a variable-size field from its offset and the next field's offset.
+ *
+ * @param view Pointer to the container view.
+ * @param position Byte position of the field's offset.
+ * @param next_position Byte position of the next variable field's offset, or SSZ_VIEW_END.
+ * @param out Output sub-view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION if the offsets are out of order
+ *         or out of bounds.
+ */
+ssz_error_t ssz_view_variable(
+    const ssz_view_t *view,
+    size_t position,
+    size_t next_position,
+    ssz_view_t *out);
+
+/**
+ * Checks that a view holds a list of fixed-size elements.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param max_length Maximum number of elements.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_list(
+    const ssz_view_t *list,
+    size_t element_size,
+    size_t max_length);
+
+/**
+ * Checks that a view holds a list of fixed-size containers and validates every element.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param max_length Maximum number of elements.
+ * @param element_view Function that validates one element.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_container_list(
+    const ssz_view_t *list,
+    size_t element_size,
+    size_t max_length,
+    ssz_view_fn element_view);
+
+/**
+ * Checks that a view holds a bitlist with a delimiter bit and at most max_bits bits.
+ *
+ * @param list Pointer to the bitlist view.
+ * @param max_bits Maximum number of bits.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_bitlist(
+    const ssz_view_t *list,
+    size_t max_bits);
+
+/**
+ * Checks the offset table of a list of variable-size elements and, if element_view is not
+ * NULL, validates every element with it.
+ *
+ * @param list Pointer to the list view.
+ * @param max_length Maximum number of elements.
+ * @param element_view Function that validates one element, or NULL.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_variable_list(
+    const ssz_view_t *list,
+    size_t max_length,
+    ssz_view_fn element_view);
+
+/**
+ * Returns the number of elements in a list of fixed-size elements.
+ *
+ * @param list Pointer to a list view checked with ssz_view_check_list.
+ * @param element_size Size of each element in bytes.
+ * @return The number of elements.
+ */
+static inline size_t ssz_view_list_length(const ssz_view_t *list, size_t element_size)
+{
+    return list->size / element_size;
+}
+
+/**
+ * Returns a view of one element of a list of fixed-size elements.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param index Index of the element.
+ * @param out Output element view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if index is past the end.
+ */
+ssz_error_t ssz_view_list_element(
+    const ssz_view_t *list,
+    size_t element_size,
+    size_t index,
+    ssz_view_t *out);
+
+/**
+ * Returns the number of elements in a list of variable-size elements.
+ *
+ * @param list Pointer to a list view checked with ssz_view_check_variable_list.
+ * @return The number of elements.
+ */
+static inline size_t ssz_view_variable_list_length(const ssz_view_t *list)
+{
+    return list->size == 0 ? 0 : ssz_view_uint32(list, 0) / SSZ_BYTES_PER_LENGTH_OFFSET;
+}
+
+/**
+ * Returns a view of one element of a list of variable-size elements.
+ *
+ * @param list Pointer to a list view checked with ssz_view_check_variable_list.
+ * @param index Index of the element.
+ * @param out Output element view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if index is past the end.
+ */
+ssz_error_t ssz_view_variable_list_element(
+    const ssz_view_t *list,
+    size_t index,
+    ssz_view_t *out);
+
+#endif /* SSZ_VIEW_H */
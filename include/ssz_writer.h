@@ -0,0 +1,193 @@
+#ifndef SSZ_WRITER_H
+#define SSZ_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ssz_types.h"
+
+/**
+ * One entry of an iovec batch: a pointer and a length.
+ *
+ * The layout matches POSIX struct iovec, so ssz_writev_fd_sink passes batches to writev
+ * unchanged, but the type does not depend on <sys/uio.h>.
+ */
+typedef struct
+{
+    void *base; /**< First byte of the entry. */
+    size_t len; /**< Number of bytes in the entry. */
+} ssz_iovec_t;
+
+/**
+ * Defines the function type that receives serialized bytes from a writer.
+ *
+ * @param ctx Context pointer passed to ssz_writer_init.
+ * @param data Pointer to the bytes to consume.
+ * @param len Number of bytes.
+ * @return SSZ_SUCCESS if all bytes were consumed, or an error code that aborts serialization.
+ */
+typedef ssz_error_t (*ssz_sink_fn)(void *ctx, const uint8_t *data, size_t len);
+
+/**
+ * Defines the function type that receives a batch of serialized output as an iovec list.
+ *
+ * Entries point either into the writer's scratch buffer or directly at caller memory; both
+ * are only guaranteed to stay valid until the sink returns.
+ *
+ * @param ctx Context pointer passed to ssz_writer_init_iov.
+ * @param iov Pointer to the iovec entries, in output order.
+ * @param iov_count Number of entries.
+ * @return SSZ_SUCCESS if all bytes were consumed, or an error code that aborts serialization.
+ */
+typedef ssz_error_t (*ssz_iov_sink_fn)(void *ctx, const ssz_iovec_t *iov, size_t iov_count);
+
+/**
+ * A serialization target that stages output in a caller-supplied buffer and hands it to a
+ * sink each time the buffer fills, so the full encoding never has to be in memory at once.
+ *
+ * In iovec mode (ssz_writer_init_iov) writes of at least zero_copy_min bytes are not copied:
+ * they are recorded as iovec entries pointing at the caller's memory, and only small encoded
+ * values and offsets go through the staging buffer.
+ */
+typedef struct
+{
+    ssz_sink_fn sink;         /**< Receives the staged bytes (staging mode). */
+    ssz_iov_sink_fn iov_sink; /**< Receives iovec batches (iovec mode). */
+    void *ctx;                /**< Context pointer passed to the sink. */
+    uint8_t *buf;             /**< Staging buffer. */
+    size_t capacity;          /**< Size of the staging buffer in bytes. */
+    size_t used;              /**< Bytes currently staged. */
+    ssz_iovec_t *iov;         /**< Pending iovec entries (iovec mode). */
+    size_t iov_capacity;      /**< Number of entries iov can hold. */
+    size_t iov_count;         /**< Entries currently pending. */
+    size_t segment_start;     /**< Start in buf of the staged bytes not yet in an entry. */
+    size_t zero_copy_min;     /**< Smallest write that is referenced instead of copied. */
+    uint64_t referenced;      /**< Bytes referenced in place since the last flush. */
+    uint64_t flushed;         /**< Bytes already handed to the sink. */
+    ssz_error_t error;        /**< First error seen; once set every call fails with it. */
+} ssz_writer_t;
+
+/**
+ * Initializes a writer over a staging buffer and a sink.
+ *
+ * @param writer Pointer to the writer to initialize.
+ * @param staging Staging buffer owned by the caller; it must outlive the writer.
+ * @param staging_size Size of the staging buffer in bytes (at least 64).
+ * @param sink Function that consumes staged bytes.
+ * @param ctx Context pointer passed to the sink.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION on invalid arguments.
+ */
+ssz_error_t ssz_writer_init(
+    ssz_writer_t *writer,
+    uint8_t *staging,
+    size_t staging_size,
+    ssz_sink_fn sink,
+    void *ctx);
+
+/**
+ * Initializes a writer in iovec mode.
+ *
+ * Output is handed to the sink as iovec batches whenever the scratch buffer or the iovec
+ * array fills, and on ssz_writer_flush. Memory passed to ssz_writer_write in pieces of at
+ * least zero_copy_min bytes is referenced rather than copied, so it must stay unchanged
+ * until the write has been flushed. Bytes the writer encodes itself, such as offsets, are
+ * always copied into the scratch buffer.
+ *
+ * @param writer Pointer to the writer to initialize.
+ * @param scratch Scratch buffer for small encoded values (at least 64 bytes).
+ * @param scratch_size Size of the scratch buffer in bytes.
+ * @param iov Array that collects the pending iovec entries.
+ * @param iov_capacity Number of entries in iov (at least 3).
+ * @param zero_copy_min Smallest write that is referenced in place (at least 1).
+ * @param sink Function that consumes iovec batches.
+ * @param ctx Context pointer passed to the sink.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION on invalid arguments.
+ */
+ssz_error_t ssz_writer_init_iov(
+    ssz_writer_t *writer,
+    uint8_t *scratch,
+    size_t scratch_size,
+    ssz_iovec_t *iov,
+    size_t iov_capacity,
+    size_t zero_copy_min,
+    ssz_iov_sink_fn sink,
+    void *ctx);
+
+#ifndef _WIN32
+/**
+ * An ssz_iov_sink_fn that writes each batch to a file descriptor with writev.
+ *
+ * Partial writes and batches longer than IOV_MAX are handled, and EINTR is retried. Not
+ * available on Windows.
+ *
+ * @param ctx Pointer to an int holding the file descriptor.
+ * @param iov Pointer to the iovec entries.
+ * @param iov_count Number of entries.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION if writev fails.
+ */
+ssz_error_t ssz_writev_fd_sink(
+    void *ctx,
+    const ssz_iovec_t *iov,
+    size_t iov_count);
+#endif
+
+/**
+ * Appends bytes to the output.
+ *
+ * Writes larger than the free staging space are passed through to the sink in
+ * staging-sized pieces, so len is not limited by the staging buffer. In iovec mode writes of
+ * at least zero_copy_min bytes are referenced in place instead.
+ *
+ * @param writer Pointer to the writer.
+ * @param data Pointer to the bytes to append.
+ * @param len Number of bytes.
+ * @return SSZ_SUCCESS on success, or the first error reported by the sink.
+ */
+ssz_error_t ssz_writer_write(
+    ssz_writer_t *writer,
+    const void *data,
+    size_t len);
+
+/**
+ * Reserves len contiguous bytes of staging space at the current position.
+ *
+ * The returned memory must be filled before the next call on the writer. This lets the
+ * existing ssz_serialize_* functions write straight into the staging buffer.
+ *
+ * @param writer Pointer to the writer.
+ * @param len Number of bytes to reserve; must not exceed the staging buffer size.
+ * @return Pointer to the reserved bytes, or NULL on error (recorded in writer->error).
+ */
+uint8_t *ssz_writer_reserve(
+    ssz_writer_t *writer,
+    size_t len);
+
+/**
+ * Appends a 4-byte little-endian offset.
+ *
+ * @param writer Pointer to the writer.
+ * @param offset Offset value; must fit in 32 bits.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_writer_write_offset(
+    ssz_writer_t *writer,
+    uint64_t offset);
+
+/**
+ * Hands all staged bytes to the sink.
+ *
+ * @param writer Pointer to the writer.
+ * @return SSZ_SUCCESS on success, or the first error reported by the sink.
+ */
+ssz_error_t ssz_writer_flush(
+    ssz_writer_t *writer);
+
+/**
+ * Returns the total number of bytes written so far, staged or flushed.
+ *
+ * @param writer Pointer to the writer.
+ * @return The current output position.
+ */
+uint64_t ssz_writer_position(
+    const ssz_writer_t *writer);
+
+#endif /* SSZ_WRITER_H */
@@ -0,0 +1,146 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "ssz_arena.h"
+
+#define SSZ_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+#define SSZ_ARENA_ALIGNMENT 16
+
+/* Block headers are padded so that the first allocation of every block is aligned. */
+#define SSZ_ARENA_HEADER_SIZE \
+    ((sizeof(ssz_arena_block_t) + SSZ_ARENA_ALIGNMENT - 1) & ~(size_t)(SSZ_ARENA_ALIGNMENT - 1))
+
+/**
+ * Returns the first usable byte of a block.
+ */
+static uint8_t *block_data(ssz_arena_block_t *block)
+{
+    return (uint8_t *)block + SSZ_ARENA_HEADER_SIZE;
+}
+
+/**
+ * Initializes an empty arena.
+ *
+ * @param arena Pointer to the arena to initialize.
+ * @param block_size Minimum size of each block in bytes; 0 selects the default.
+ */
+void ssz_arena_init(ssz_arena_t *arena, size_t block_size)
+{
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+    arena->block_size = block_size != 0 ? block_size : SSZ_ARENA_DEFAULT_BLOCK_SIZE;
+}
+
+/**
+ * Allocates size bytes from the arena, or from malloc when arena is NULL.
+ *
+ * @param arena Pointer to the arena, or NULL.
+ * @param size Number of bytes.
+ * @return Pointer to the memory, or NULL if no memory is available.
+ */
+void *ssz_arena_alloc(ssz_arena_t *arena, size_t size)
+{
+    if (arena == NULL)
+    {
+        return malloc(size);
+    }
+    if (size > SIZE_MAX - SSZ_ARENA_HEADER_SIZE - SSZ_ARENA_ALIGNMENT)
+    {
+        return NULL;
+    }
+    size_t need = (size + SSZ_ARENA_ALIGNMENT - 1) & ~(size_t)(SSZ_ARENA_ALIGNMENT - 1);
+    while (arena->current != NULL)
+    {
+        if (arena->current->size - arena->used >= need)
+        {
+            void *ptr = block_data(arena->current) + arena->used;
+            arena->used += need;
+            return ptr;
+        }
+        if (arena->current->next == NULL)
+        {
+            break;
+        }
+        arena->current = arena->current->next;
+        arena->used = 0;
+    }
+    size_t block_size = need > arena->block_size ? need : arena->block_size;
+    ssz_arena_block_t *block = malloc(SSZ_ARENA_HEADER_SIZE + block_size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->next = NULL;
+    block->size = block_size;
+    if (arena->current != NULL)
+    {
+        arena->current->next = block;
+    }
+    else
+    {
+        arena->head = block;
+    }
+    arena->current = block;
+    arena->used = need;
+    return block_data(block);
+}
+
+/**
+ * Releases memory obtained from ssz_arena_alloc; only malloc memory is actually freed.
+ *
+ * @param arena Pointer to the arena the memory came from, or NULL.
+ * @param ptr Pointer returned by ssz_arena_alloc, or NULL.
+ */
+void ssz_arena_release(ssz_arena_t *arena, void *ptr)
+{
+    if (arena == NULL)
+    {
+        free(ptr);
+    }
+}
+
+/**
+ * Makes all memory of the arena available again, keeping its blocks.
+ *
+ * @param arena Pointer to the arena.
+ */
+void ssz_arena_reset(ssz_arena_t *arena)
+{
+    arena->current = arena->head;
+    arena->used = 0;
+}
+
+/**
+ * Frees every block of the arena.
+ *
+ * @param arena Pointer to the arena.
+ */
+void ssz_arena_free(ssz_arena_t *arena)
+{
+    ssz_arena_block_t *block = arena->head;
+    while (block != NULL)
+    {
+        ssz_arena_block_t *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+}
+
+/**
+ * Returns the total number of bytes held in the arena's blocks.
+ *
+ * @param arena Pointer to the arena.
+ * @return The capacity in bytes.
+ */
+size_t ssz_arena_capacity(const ssz_arena_t *arena)
+{
+    size_t total = 0;
+    for (const ssz_arena_block_t *block = arena->head; block != NULL; block = block->next)
+    {
+        total += block->size;
+    }
+    return total;
+}
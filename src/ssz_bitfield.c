@@ -0,0 +1,439 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ssz_bitfield.h"
+#include "ssz_constants.h"
+#include "ssz_hash.h"
+#include "ssz_merkle.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SSZ_BITS_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*ssz_bits_pack_fn)(const bool *bits, size_t bit_count, uint8_t *out_bytes);
+typedef void (*ssz_bits_unpack_fn)(const uint8_t *bytes, size_t bit_count, bool *out_bits);
+
+/**
+ * Portable packer: one shift-and-OR per bit, eight bits per output byte.
+ */
+static void bits_pack_scalar(const bool *bits, size_t bit_count, uint8_t *out_bytes)
+{
+    size_t full_bytes = bit_count / SSZ_BITS_PER_BYTE;
+    for (size_t i = 0; i < full_bytes; i++)
+    {
+        const bool *b = bits + i * SSZ_BITS_PER_BYTE;
+        out_bytes[i] = (uint8_t)((b[0] != 0) | (b[1] != 0) << 1 | (b[2] != 0) << 2 | (b[3] != 0) << 3 |
+                                 (b[4] != 0) << 4 | (b[5] != 0) << 5 | (b[6] != 0) << 6 | (b[7] != 0) << 7);
+    }
+    if (bit_count & 7)
+    {
+        uint8_t byte = 0;
+        for (size_t j = 0; j < (bit_count & 7); j++)
+        {
+            byte |= (uint8_t)((bits[full_bytes * SSZ_BITS_PER_BYTE + j] != 0) << j);
+        }
+        out_bytes[full_bytes] = byte;
+    }
+}
+
+/**
+ * Portable unpacker: one mask test per bit.
+ */
+static void bits_unpack_scalar(const uint8_t *bytes, size_t bit_count, bool *out_bits)
+{
+    for (size_t i = 0; i < bit_count; i++)
+    {
+        out_bits[i] = (bytes[i >> 3] >> (i & 7)) & 1;
+    }
+}
+
+#ifdef SSZ_BITS_X86
+/**
+ * Packs 16 booleans per step: a compare against zero turns each bool into a full byte mask
+ * and pmovmskb gathers the 16 sign bits into two output bytes.
+ */
+__attribute__((target("sse2")))
+static void bits_pack_sse2(const bool *bits, size_t bit_count, uint8_t *out_bytes)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= bit_count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(bits + i));
+        uint16_t mask = (uint16_t)~_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero));
+        memcpy(out_bytes + i / SSZ_BITS_PER_BYTE, &mask, sizeof(mask));
+    }
+    bits_pack_scalar(bits + i, bit_count - i, out_bytes + i / SSZ_BITS_PER_BYTE);
+}
+
+/**
+ * Unpacks 16 bits per step: each input byte is replicated across eight lanes, masked with
+ * its lane's bit, and compared so that set bits become 1 and clear bits 0.
+ */
+__attribute__((target("sse2")))
+static void bits_unpack_sse2(const uint8_t *bytes, size_t bit_count, bool *out_bits)
+{
+    const __m128i select = _mm_set1_epi64x((long long)0x8040201008040201ULL);
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= bit_count; i += 16)
+    {
+        uint16_t word;
+        memcpy(&word, bytes + i / SSZ_BITS_PER_BYTE, sizeof(word));
+        __m128i v = _mm_cvtsi32_si128(word);
+        v = _mm_unpacklo_epi8(v, v);
+        v = _mm_unpacklo_epi16(v, v);
+        v = _mm_unpacklo_epi32(v, v);
+        v = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(v, select), select), one);
+        _mm_storeu_si128((__m128i *)(out_bits + i), v);
+    }
+    bits_unpack_scalar(bytes + i / SSZ_BITS_PER_BYTE, bit_count - i, out_bits + i);
+}
+
+/**
+ * Packs 32 booleans per step with vpmovmskb.
+ */
+__attribute__((target("avx2")))
+static void bits_pack_avx2(const bool *bits, size_t bit_count, uint8_t *out_bytes)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= bit_count; i += 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(bits + i));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        memcpy(out_bytes + i / SSZ_BITS_PER_BYTE, &mask, sizeof(mask));
+    }
+    bits_pack_sse2(bits + i, bit_count - i, out_bytes + i / SSZ_BITS_PER_BYTE);
+}
+
+/**
+ * Unpacks 32 bits per step: the four input bytes are broadcast, vpshufb spreads byte k over
+ * lanes 8k..8k+7, and a mask-and-compare extracts one bit per lane.
+ */
+__attribute__((target("avx2")))
+static void bits_unpack_avx2(const uint8_t *bytes, size_t bit_count, bool *out_bits)
+{
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_set1_epi64x((long long)0x8040201008040201ULL);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= bit_count; i += 32)
+    {
+        uint32_t word;
+        memcpy(&word, bytes + i / SSZ_BITS_PER_BYTE, sizeof(word));
+        __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32((int)word), spread);
+        v = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(v, select), select), one);
+        _mm256_storeu_si256((__m256i *)(out_bits + i), v);
+    }
+    bits_unpack_sse2(bytes + i / SSZ_BITS_PER_BYTE, bit_count - i, out_bits + i);
+}
+#endif
+
+static ssz_bits_pack_fn bits_pack_impl = bits_pack_scalar;
+static ssz_bits_unpack_fn bits_unpack_impl = bits_unpack_scalar;
+static const char *bits_impl_name = "scalar";
+
+#ifdef SSZ_BITS_X86
+/**
+ * Picks the widest available conversion kernels once, before main runs.
+ */
+__attribute__((constructor))
+static void bits_select(void)
+{
+    ssz_cpu_features_t features;
+    ssz_cpu_detect(&features);
+    if (features.avx2)
+    {
+        bits_pack_impl = bits_pack_avx2;
+        bits_unpack_impl = bits_unpack_avx2;
+        bits_impl_name = "avx2";
+    }
+    else if (features.sse2)
+    {
+        bits_pack_impl = bits_pack_sse2;
+        bits_unpack_impl = bits_unpack_sse2;
+        bits_impl_name = "sse2";
+    }
+}
+#endif
+
+/**
+ * Packs an array of booleans into little-endian bit order with the selected kernel.
+ *
+ * @param bits Pointer to bit_count booleans.
+ * @param bit_count Number of bits to pack.
+ * @param out_bytes Output buffer for (bit_count + 7) / 8 bytes.
+ */
+void ssz_bits_pack(const bool *bits, size_t bit_count, uint8_t *out_bytes)
+{
+    bits_pack_impl(bits, bit_count, out_bytes);
+}
+
+/**
+ * Unpacks little-endian bits into an array of booleans with the selected kernel.
+ *
+ * @param bytes Pointer to (bit_count + 7) / 8 input bytes.
+ * @param bit_count Number of bits to unpack.
+ * @param out_bits Output array of bit_count booleans.
+ */
+void ssz_bits_unpack(const uint8_t *bytes, size_t bit_count, bool *out_bits)
+{
+    bits_unpack_impl(bytes, bit_count, out_bits);
+}
+
+/**
+ * Returns the name of the selected bool/bit conversion backend.
+ *
+ * @return A static string.
+ */
+const char *ssz_bits_backend(void)
+{
+    return bits_impl_name;
+}
+
+/**
+ * Clears the bits at or above length in the last word of a bitfield.
+ */
+static void bitfield_clear_tail(uint64_t *words, size_t length)
+{
+    if (length & 63)
+    {
+        words[length >> 6] &= ((uint64_t)1 << (length & 63)) - 1;
+    }
+}
+
+/**
+ * Allocates zeroed storage for a bitlist of up to max_bits bits.
+ *
+ * @param list Pointer to the bitlist to initialize.
+ * @param max_bits Maximum number of bits the list will hold.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_init(ssz_bitlist_t *list, size_t max_bits)
+{
+    if (list == NULL)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    size_t n_words = SSZ_BITFIELD_WORDS(max_bits);
+    list->words = calloc(n_words != 0 ? n_words : 1, sizeof(uint64_t));
+    list->length = 0;
+    return list->words != NULL ? SSZ_SUCCESS : SSZ_ERROR_DESERIALIZATION;
+}
+
+/**
+ * Releases the storage of a bitlist.
+ *
+ * @param list Pointer to the bitlist.
+ */
+void ssz_bitlist_free(ssz_bitlist_t *list)
+{
+    if (list == NULL)
+    {
+        return;
+    }
+    free(list->words);
+    list->words = NULL;
+    list->length = 0;
+}
+
+/**
+ * Serializes a packed bitvector by copying its bytes.
+ *
+ * @param vec Pointer to the bitvector.
+ * @param out_buf Pointer to the output buffer.
+ * @param out_size Pointer to the size of the output buffer. Updated with the number of bytes written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_serialize(const ssz_bitvector_t *vec, uint8_t *out_buf, size_t *out_size)
+{
+    if (vec == NULL || vec->words == NULL || out_buf == NULL || out_size == NULL || vec->length == 0)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    size_t byte_count = (vec->length + 7) / SSZ_BITS_PER_BYTE;
+    if (*out_size < byte_count)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    memcpy(out_buf, vec->words, byte_count);
+    if (vec->length & 7)
+    {
+        out_buf[byte_count - 1] &= (uint8_t)((1U << (vec->length & 7)) - 1);
+    }
+    *out_size = byte_count;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Deserializes a packed bitvector by copying its bytes.
+ *
+ * @param buffer Pointer to the input buffer.
+ * @param buffer_size The size of the input buffer in bytes.
+ * @param vec Pointer to a bitvector whose length and words are set by the caller.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_deserialize(const uint8_t *buffer, size_t buffer_size, ssz_bitvector_t *vec)
+{
+    if (buffer == NULL || vec == NULL || vec->words == NULL || vec->length == 0)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (buffer_size != (vec->length + 7) / SSZ_BITS_PER_BYTE)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if ((vec->length & 7) && (buffer[buffer_size - 1] >> (vec->length & 7)) != 0)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    vec->words[SSZ_BITFIELD_WORDS(vec->length) - 1] = 0;
+    memcpy(vec->words, buffer, buffer_size);
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Merkleizes the first length bits of packed words as chunks, ignoring any bits at or above
+ * length. All chunks but the last are hashed in place; the last is copied and masked.
+ */
+static ssz_error_t bitfield_merkleize(const uint64_t *words, size_t length, size_t limit, uint8_t *out_root)
+{
+    const uint8_t *bytes = (const uint8_t *)words;
+    size_t byte_count = (length + 7) / SSZ_BITS_PER_BYTE;
+    size_t full_chunks = byte_count != 0 ? (byte_count - 1) / SSZ_BYTES_PER_CHUNK : 0;
+    ssz_merkleizer_t m;
+    ssz_error_t err = ssz_merkleizer_init(&m, limit);
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_push_chunks(&m, bytes, full_chunks);
+    }
+    if (err == SSZ_SUCCESS && byte_count != 0)
+    {
+        uint8_t last[SSZ_BYTES_PER_CHUNK] = {0};
+        size_t rem = byte_count - full_chunks * SSZ_BYTES_PER_CHUNK;
+        memcpy(last, bytes + full_chunks * SSZ_BYTES_PER_CHUNK, rem);
+        if (length & 7)
+        {
+            last[rem - 1] &= (uint8_t)((1U << (length & 7)) - 1);
+        }
+        err = ssz_merkleizer_push_chunks(&m, last, 1);
+    }
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_finalize(&m, out_root);
+    }
+    return err;
+}
+
+/**
+ * Computes the hash tree root of a packed bitvector.
+ *
+ * The words are already the packed chunk bytes, so they are merkleized in place; bits at or
+ * above the length are ignored, as in ssz_bitvector_serialize.
+ *
+ * @param vec Pointer to the bitvector.
+ * @param out_root Output buffer to write the hash tree root.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitvector_hash_tree_root(const ssz_bitvector_t *vec, uint8_t *out_root)
+{
+    if (vec == NULL || (vec->words == NULL && vec->length != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t limit = (vec->length + 255) / 256;
+    return bitfield_merkleize(vec->words, vec->length, limit, out_root);
+}
+
+/**
+ * Serializes a packed bitlist and appends the delimiter bit.
+ *
+ * @param list Pointer to the bitlist.
+ * @param out_buf Pointer to the output buffer.
+ * @param out_size Pointer to the size of the output buffer. Updated with the number of bytes written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_serialize(const ssz_bitlist_t *list, uint8_t *out_buf, size_t *out_size)
+{
+    if (list == NULL || (list->words == NULL && list->length != 0) || out_buf == NULL || out_size == NULL)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    size_t full_bytes = list->length / SSZ_BITS_PER_BYTE;
+    size_t rem = list->length & 7;
+    if (*out_size < full_bytes + 1)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    const uint8_t *bytes = (const uint8_t *)list->words;
+    memcpy(out_buf, bytes, full_bytes);
+    uint8_t last = rem != 0 ? (uint8_t)(bytes[full_bytes] & ((1U << rem) - 1)) : 0;
+    out_buf[full_bytes] = (uint8_t)(last | (1U << rem));
+    *out_size = full_bytes + 1;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Deserializes a packed bitlist and strips the delimiter bit.
+ *
+ * @param buffer Pointer to the input buffer.
+ * @param buffer_size The size of the input buffer in bytes.
+ * @param max_bits The maximum number of bits in the bitlist.
+ * @param list Pointer to a bitlist with enough words for the decoded length.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_deserialize(const uint8_t *buffer, size_t buffer_size, size_t max_bits, ssz_bitlist_t *list)
+{
+    if (buffer == NULL || list == NULL || list->words == NULL || buffer_size == 0)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    uint8_t last = buffer[buffer_size - 1];
+    if (last == 0 || buffer_size - 1 > max_bits / SSZ_BITS_PER_BYTE)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    unsigned delimiter = 31 - (unsigned)__builtin_clz(last);
+    size_t length = (buffer_size - 1) * SSZ_BITS_PER_BYTE + delimiter;
+    if (length > max_bits)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (length != 0)
+    {
+        size_t data_bytes = (length + 7) / SSZ_BITS_PER_BYTE;
+        list->words[SSZ_BITFIELD_WORDS(length) - 1] = 0;
+        memcpy(list->words, buffer, data_bytes);
+        bitfield_clear_tail(list->words, length);
+    }
+    list->length = length;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Computes the hash tree root of a packed bitlist.
+ *
+ * The words are merkleized in place against the chunk limit of max_bits, ignoring bits at or
+ * above the length, then the length is mixed in.
+ *
+ * @param list Pointer to the bitlist.
+ * @param max_bits The maximum number of bits in the bitlist.
+ * @param out_root Output buffer to write the hash tree root.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_bitlist_hash_tree_root(const ssz_bitlist_t *list, size_t max_bits, uint8_t *out_root)
+{
+    if (list == NULL || (list->words == NULL && list->length != 0) || list->length > max_bits)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t limit = (max_bits + 255) / 256;
+    ssz_error_t err = bitfield_merkleize(list->words, list->length, limit, out_root);
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_mix_in_length(out_root, list->length, out_root);
+    }
+    return err;
+}
@@ -3,10 +3,13 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdatomic.h>
 #include "ssz_deserialize.h"
 #include "ssz_constants.h"
 #include "ssz_types.h"
 #include "ssz_utils.h"
+#include "ssz_bitfield.h"
+#include "ssz_pool.h"
 
 /**
  * Deserializes an 8-bit unsigned integer from a single byte.
@@ -215,34 +218,16 @@ ssz_error_t ssz_deserialize_bitvector(
     {
         return SSZ_ERROR_DESERIALIZATION;
     }
-    const size_t full_bytes = num_bits / 8;
     const size_t remainder_bits = num_bits % 8;
-    bool *out_ptr = out_bits;
-    for (size_t i = 0; i < full_bytes; ++i)
-    {
-        const uint8_t byte = buffer[i];
-        *out_ptr++ = (byte & 0x01) != 0;
-        *out_ptr++ = (byte & 0x02) != 0;
-        *out_ptr++ = (byte & 0x04) != 0;
-        *out_ptr++ = (byte & 0x08) != 0;
-        *out_ptr++ = (byte & 0x10) != 0;
-        *out_ptr++ = (byte & 0x20) != 0;
-        *out_ptr++ = (byte & 0x40) != 0;
-        *out_ptr++ = (byte & 0x80) != 0;
-    }
     if (remainder_bits > 0)
     {
-        const uint8_t byte = buffer[full_bytes];
         uint8_t mask = ~((1 << remainder_bits) - 1);
-        if (byte & mask)
+        if (buffer[num_bits / 8] & mask)
         {
             return SSZ_ERROR_DESERIALIZATION;
         }
-        for (size_t bit = 0; bit < remainder_bits; ++bit)
-        {
-            *out_ptr++ = (byte & (1 << bit)) != 0;
-        }
     }
+    ssz_bits_unpack(buffer, num_bits, out_bits);
     return SSZ_SUCCESS;
 }
 
@@ -281,63 +266,18 @@ ssz_error_t ssz_deserialize_bitlist(
         }
         buffer_size = max_bytes;
     }
-    ssize_t boundary = -1;
-    for (ssize_t byte_i = (ssize_t)buffer_size - 1; byte_i >= 0; byte_i--)
-    {
-        const uint8_t val = buffer[byte_i];
-        if (val != 0)
-        {
-            const int bit = highest_bit_table[val];
-            boundary = (byte_i * 8) + bit;
-            break;
-        }
-    }
-    if (boundary < 0 || (size_t)boundary > max_bits)
+    size_t boundary;
+    if (!find_last_set_bit(buffer, buffer_size, &boundary) || boundary > max_bits)
     {
         return SSZ_ERROR_DESERIALIZATION;
     }
-    const size_t boundary_byte = (boundary / 8) + 1;
-    if (boundary_byte < buffer_size)
-    {
-        if (!is_zero(buffer + boundary_byte, buffer_size - boundary_byte))
-        {
-            return SSZ_ERROR_DESERIALIZATION;
-        }
-    }
-    const uint8_t boundary_mask = (uint8_t)((1U << ((boundary % 8) + 1)) - 1);
-    if ((buffer[boundary / 8] & ~boundary_mask) != 0)
-    {
-        return SSZ_ERROR_DESERIALIZATION;
-    }
-    const size_t data_bits = (size_t)boundary;
+    const size_t data_bits = boundary;
     *out_actual_bits = data_bits;
     if (data_bits < max_bits)
     {
         memset(out_bits + data_bits, 0, (max_bits - data_bits) * sizeof(bool));
     }
-    const size_t full_bytes = data_bits / 8;
-    const size_t rem_bits = data_bits % 8;
-    size_t i = 0;
-    for (; i < full_bytes; i++)
-    {
-        const uint8_t val = buffer[i];
-        out_bits[i * 8 + 0] = val & 0x01;
-        out_bits[i * 8 + 1] = val & 0x02;
-        out_bits[i * 8 + 2] = val & 0x04;
-        out_bits[i * 8 + 3] = val & 0x08;
-        out_bits[i * 8 + 4] = val & 0x10;
-        out_bits[i * 8 + 5] = val & 0x20;
-        out_bits[i * 8 + 6] = val & 0x40;
-        out_bits[i * 8 + 7] = val & 0x80;
-    }
-    if (rem_bits > 0)
-    {
-        const uint8_t val = buffer[full_bytes];
-        for (size_t bit = 0; bit < rem_bits; bit++)
-        {
-            out_bits[i * 8 + bit] = val & (1 << bit);
-        }
-    }
+    ssz_bits_unpack(buffer, data_bits, out_bits);
     return SSZ_SUCCESS;
 }
 
@@ -614,21 +554,11 @@ ssz_error_t ssz_deserialize_vector_bool(
     {
         return SSZ_ERROR_DESERIALIZATION;
     }
-    for (size_t i = 0; i < element_count; i++)
+    if (!is_boolean_bytes(buffer, element_count))
     {
-        if (buffer[i] == 0x00)
-        {
-            out_elements[i] = false;
-        }
-        else if (buffer[i] == 0x01)
-        {
-            out_elements[i] = true;
-        }
-        else
-        {
-            return SSZ_ERROR_DESERIALIZATION;
-        }
+        return SSZ_ERROR_DESERIALIZATION;
     }
+    memcpy(out_elements, buffer, element_count);
     return SSZ_SUCCESS;
 }
 
@@ -860,21 +790,129 @@ ssz_error_t ssz_deserialize_list_bool(
     size_t element_count = buffer_size;
     if (element_count > max_length)
         return SSZ_ERROR_DESERIALIZATION;
-    for (size_t i = 0; i < element_count; i++)
+    if (!is_boolean_bytes(buffer, element_count))
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    memcpy(out_elements, buffer, element_count);
+    *out_actual_count = element_count;
+    return SSZ_SUCCESS;
+}
+
+typedef struct
+{
+    const uint8_t *buffer;
+    size_t element_size;
+    size_t count;
+    uint8_t *out_elements;
+    size_t element_stride;
+    size_t range_size;
+    ssz_element_deserialize_fn deserialize_fn;
+    atomic_size_t first_error;
+} deserialize_parallel_ctx_t;
+
+/**
+ * Records a failing element index, keeping the smallest one seen so far.
+ */
+static void record_first_error(atomic_size_t *first_error, size_t index)
+{
+    size_t current = atomic_load(first_error);
+    while (index < current && !atomic_compare_exchange_weak(first_error, &current, index))
     {
-        if (buffer[i] == 0x00)
+    }
+}
+
+/**
+ * Deserializes one contiguous range of elements of a parallel list job.
+ *
+ * A range stops at its first failure and skips every element past the smallest failing
+ * index found so far, so the reported index does not depend on scheduling.
+ */
+static void deserialize_range_task(void *arg, size_t index)
+{
+    deserialize_parallel_ctx_t *ctx = (deserialize_parallel_ctx_t *)arg;
+    size_t first = index * ctx->range_size;
+    size_t end = ctx->count - first < ctx->range_size ? ctx->count : first + ctx->range_size;
+    for (size_t i = first; i < end; i++)
+    {
+        if (i >= atomic_load_explicit(&ctx->first_error, memory_order_relaxed))
         {
-            out_elements[i] = false;
+            return;
         }
-        else if (buffer[i] == 0x01)
+        if (ctx->deserialize_fn(ctx->buffer + i * ctx->element_size, ctx->element_size,
+                                ctx->out_elements + i * ctx->element_stride) != SSZ_SUCCESS)
+        {
+            record_first_error(&ctx->first_error, i);
+            return;
+        }
+    }
+}
+
+/**
+ * Deserializes the elements of a list of fixed-size elements using the built-in worker pool.
+ *
+ * Ranges hold about a quarter of a thread's share of the elements and no fewer than
+ * SSZ_PARALLEL_DESERIALIZE_MIN_RANGE, so that the dynamic task hand-out can balance uneven
+ * element costs. The serial path uses the same range task with a single range.
+ *
+ * @param buffer Pointer to the serialized elements.
+ * @param element_size The size of one serialized element in bytes.
+ * @param count Number of elements.
+ * @param out_elements Pointer to the array of decoded elements.
+ * @param element_stride Distance in bytes between consecutive decoded elements.
+ * @param deserialize_fn Function that deserializes one element.
+ * @param out_error_index Receives the index of the first failing element on error; may be NULL.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION if an element failed.
+ */
+ssz_error_t ssz_deserialize_fixed_list_parallel(
+    const uint8_t *buffer,
+    size_t element_size,
+    size_t count,
+    void *out_elements,
+    size_t element_stride,
+    ssz_element_deserialize_fn deserialize_fn,
+    size_t *out_error_index)
+{
+    if ((!buffer || !out_elements) && count != 0)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (!deserialize_fn)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    deserialize_parallel_ctx_t ctx;
+    ctx.buffer = buffer;
+    ctx.element_size = element_size;
+    ctx.count = count;
+    ctx.out_elements = (uint8_t *)out_elements;
+    ctx.element_stride = element_stride;
+    ctx.deserialize_fn = deserialize_fn;
+    atomic_init(&ctx.first_error, count);
+    size_t threads = ssz_pool_threads();
+    if (threads <= 1 || count < SSZ_PARALLEL_DESERIALIZE_MIN_ELEMENTS)
+    {
+        ctx.range_size = count;
+        deserialize_range_task(&ctx, 0);
+    }
+    else
+    {
+        size_t target_tasks = threads * 4;
+        ctx.range_size = (count + target_tasks - 1) / target_tasks;
+        if (ctx.range_size < SSZ_PARALLEL_DESERIALIZE_MIN_RANGE)
         {
-            out_elements[i] = true;
+            ctx.range_size = SSZ_PARALLEL_DESERIALIZE_MIN_RANGE;
         }
-        else
+        ssz_pool_run(deserialize_range_task, &ctx, (count + ctx.range_size - 1) / ctx.range_size);
+    }
+    size_t first_error = atomic_load(&ctx.first_error);
+    if (first_error < count)
+    {
+        if (out_error_index)
         {
-            return SSZ_ERROR_DESERIALIZATION;
+            *out_error_index = first_error;
         }
+        return SSZ_ERROR_DESERIALIZATION;
     }
-    *out_actual_count = element_count;
     return SSZ_SUCCESS;
-}
\ No newline at end of file
+}
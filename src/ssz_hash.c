@@ -0,0 +1,615 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <limits.h>
+#include "mincrypt/sha256.h"
+#include "ssz_hash.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SSZ_HASH_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+typedef void (*ssz_sha256_fn)(const uint8_t *data, size_t len, uint8_t *out_digest);
+typedef void (*ssz_sha256_64_fn)(const uint8_t *in, uint8_t *out_digest);
+
+/**
+ * Portable backend built on the mincrypt context API.
+ */
+static void sha256_generic(const uint8_t *data, size_t len, uint8_t *out_digest)
+{
+    SHA256_CTX ctx;
+    SHA256_init(&ctx);
+    while (len > (size_t)INT_MAX)
+    {
+        SHA256_update(&ctx, data, INT_MAX);
+        data += INT_MAX;
+        len -= INT_MAX;
+    }
+    SHA256_update(&ctx, data, (int)len);
+    memcpy(out_digest, SHA256_final(&ctx), SHA256_DIGEST_SIZE);
+}
+
+static const uint32_t SHA256_IV[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/*
+ * K[t] + W[t] for the second block of a 64-byte message. That block is always the
+ * padding block (0x80, zeros, bit length 512), so its message schedule is fixed.
+ */
+static const uint32_t SHA256_PAD64_KW[64] = {
+    0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374,
+    0x649b69c1, 0xf0fe4786, 0x0fe1edc6, 0x240cf254, 0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa,
+    0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7, 0x9a1231c3, 0xe70eeaa0, 0xfdb1232b, 0xc7353eb0,
+    0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd, 0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16,
+    0x007f3e86, 0x37088980, 0xa507ea32, 0x6fab9537, 0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37,
+    0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7, 0x521afaca, 0x31338431, 0x6ed41a95, 0x6d437890,
+    0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c, 0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76};
+
+static void sha256_store_state(const uint32_t state[8], uint8_t *out_digest)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        out_digest[4 * i + 0] = (uint8_t)(state[i] >> 24);
+        out_digest[4 * i + 1] = (uint8_t)(state[i] >> 16);
+        out_digest[4 * i + 2] = (uint8_t)(state[i] >> 8);
+        out_digest[4 * i + 3] = (uint8_t)(state[i]);
+    }
+}
+
+#define SHA256_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+/**
+ * Runs the 64 SHA-256 rounds over state given the per-round sums K[t] + W[t], then adds
+ * the result back into state.
+ */
+static void sha256_rounds_kw(uint32_t state[8], const uint32_t kw[64])
+{
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; t++)
+    {
+        uint32_t s1 = SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + ch + kw[t];
+        uint32_t s0 = SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/**
+ * Portable 64-byte hash. The data block is expanded and compressed directly from the
+ * input, and the padding block reuses the precomputed SHA256_PAD64_KW schedule.
+ */
+static void sha256_64_generic(const uint8_t *in, uint8_t *out_digest)
+{
+    uint32_t state[8];
+    uint32_t w[64];
+    uint32_t kw[64];
+    for (int t = 0; t < 16; t++)
+    {
+        w[t] = ((uint32_t)in[4 * t] << 24) | ((uint32_t)in[4 * t + 1] << 16) |
+               ((uint32_t)in[4 * t + 2] << 8) | (uint32_t)in[4 * t + 3];
+    }
+    for (int t = 16; t < 64; t++)
+    {
+        uint32_t s0 = SHA256_ROTR(w[t - 15], 7) ^ SHA256_ROTR(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        uint32_t s1 = SHA256_ROTR(w[t - 2], 17) ^ SHA256_ROTR(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+    for (int t = 0; t < 64; t++)
+    {
+        kw[t] = SHA256_K[t] + w[t];
+    }
+    memcpy(state, SHA256_IV, sizeof(state));
+    sha256_rounds_kw(state, kw);
+    sha256_rounds_kw(state, SHA256_PAD64_KW);
+    sha256_store_state(state, out_digest);
+}
+
+#ifdef SSZ_HASH_X86
+/**
+ * Writes the final padding blocks for a message of the given length.
+ *
+ * Copies the trailing partial block of the message into tail, appends the 0x80 marker,
+ * zero-fills and stores the big-endian bit length in the last eight bytes.
+ *
+ * @param data Pointer to the trailing (partial block) bytes of the message.
+ * @param rem Number of trailing bytes (less than 64).
+ * @param total_len Total message length in bytes.
+ * @param tail Output buffer of 128 bytes.
+ * @return The number of 64-byte blocks written to tail (1 or 2).
+ */
+static size_t sha256_pad_tail(const uint8_t *data, size_t rem, uint64_t total_len, uint8_t tail[128])
+{
+    size_t tail_blocks = rem < 56 ? 1 : 2;
+    size_t tail_len = tail_blocks * 64;
+    uint64_t bit_len = total_len * 8;
+    memcpy(tail, data, rem);
+    tail[rem] = 0x80;
+    memset(tail + rem + 1, 0, tail_len - rem - 1);
+    for (size_t i = 0; i < 8; i++)
+    {
+        tail[tail_len - 1 - i] = (uint8_t)(bit_len >> (8 * i));
+    }
+    return tail_blocks;
+}
+
+#define SHA256_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+
+/**
+ * Runs one block through the x86 SHA extensions. The state is kept in the ABEF/CDGH
+ * register layout the instructions expect.
+ */
+SHA256_SHANI_TARGET
+static inline void sha256_shani_block(__m128i *state0, __m128i *state1, const uint8_t *data)
+{
+    const __m128i shuf_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    const __m128i abef_save = *state0;
+    const __m128i cdgh_save = *state1;
+    __m128i s0 = *state0;
+    __m128i s1 = *state1;
+    __m128i w[4];
+    for (int i = 0; i < 4; i++)
+    {
+        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16 * i)), shuf_mask);
+    }
+    for (int g = 0; g < 16; g++)
+    {
+        __m128i msg = _mm_add_epi32(w[g & 3], _mm_loadu_si128((const __m128i *)&SHA256_K[4 * g]));
+        s1 = _mm_sha256rnds2_epu32(s1, s0, msg);
+        s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(msg, 0x0E));
+        if (g < 12)
+        {
+            __m128i next = _mm_sha256msg1_epu32(w[g & 3], w[(g + 1) & 3]);
+            next = _mm_add_epi32(next, _mm_alignr_epi8(w[(g + 3) & 3], w[(g + 2) & 3], 4));
+            w[g & 3] = _mm_sha256msg2_epu32(next, w[(g + 3) & 3]);
+        }
+    }
+    *state0 = _mm_add_epi32(s0, abef_save);
+    *state1 = _mm_add_epi32(s1, cdgh_save);
+}
+
+/**
+ * Converts a state array into the ABEF/CDGH layout.
+ */
+SHA256_SHANI_TARGET
+static inline void sha256_shani_load_state(const uint32_t state[8], __m128i *state0, __m128i *state1)
+{
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+    *state0 = _mm_alignr_epi8(tmp, efgh, 8);
+    *state1 = _mm_blend_epi16(efgh, tmp, 0xF0);
+}
+
+/**
+ * Converts the ABEF/CDGH layout back into state order (ABCD, EFGH).
+ */
+SHA256_SHANI_TARGET
+static inline void sha256_shani_unpack_state(__m128i *state0, __m128i *state1)
+{
+    __m128i tmp = _mm_shuffle_epi32(*state0, 0x1B);
+    __m128i dchg = _mm_shuffle_epi32(*state1, 0xB1);
+    *state0 = _mm_blend_epi16(tmp, dchg, 0xF0);
+    *state1 = _mm_alignr_epi8(dchg, tmp, 8);
+}
+
+/**
+ * Runs the SHA-256 compression function over whole 64-byte blocks using the x86 SHA
+ * extensions.
+ */
+SHA256_SHANI_TARGET
+static void sha256_shani_compress(uint32_t state[8], const uint8_t *data, size_t blocks)
+{
+    __m128i state0, state1;
+    sha256_shani_load_state(state, &state0, &state1);
+    while (blocks--)
+    {
+        sha256_shani_block(&state0, &state1, data);
+        data += 64;
+    }
+    sha256_shani_unpack_state(&state0, &state1);
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+/**
+ * SHA extensions 64-byte hash. The padding block needs no message expansion: its rounds
+ * consume the precomputed SHA256_PAD64_KW words directly.
+ */
+SHA256_SHANI_TARGET
+static void sha256_64_shani(const uint8_t *in, uint8_t *out_digest)
+{
+    const __m128i shuf_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1;
+    sha256_shani_load_state(SHA256_IV, &state0, &state1);
+    sha256_shani_block(&state0, &state1, in);
+    const __m128i abef_save = state0;
+    const __m128i cdgh_save = state1;
+    for (int g = 0; g < 16; g++)
+    {
+        __m128i msg = _mm_loadu_si128((const __m128i *)&SHA256_PAD64_KW[4 * g]);
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+    }
+    state0 = _mm_add_epi32(state0, abef_save);
+    state1 = _mm_add_epi32(state1, cdgh_save);
+    sha256_shani_unpack_state(&state0, &state1);
+    _mm_storeu_si128((__m128i *)out_digest, _mm_shuffle_epi8(state0, shuf_mask));
+    _mm_storeu_si128((__m128i *)(out_digest + 16), _mm_shuffle_epi8(state1, shuf_mask));
+}
+
+/**
+ * SHA extensions backend. Whole blocks are compressed straight from the caller's buffer;
+ * only the trailing partial block is staged for padding.
+ */
+static void sha256_shani(const uint8_t *data, size_t len, uint8_t *out_digest)
+{
+    uint32_t state[8];
+    uint8_t tail[128];
+    size_t full_blocks = len / 64;
+    size_t rem = len % 64;
+    memcpy(state, SHA256_IV, sizeof(state));
+    if (full_blocks)
+    {
+        sha256_shani_compress(state, data, full_blocks);
+    }
+    size_t tail_blocks = sha256_pad_tail(data + full_blocks * 64, rem, (uint64_t)len, tail);
+    sha256_shani_compress(state, tail, tail_blocks);
+    sha256_store_state(state, out_digest);
+}
+
+/*
+ * Multi-buffer kernels. Each vector lane carries the state of one independent 64-byte
+ * message, so a single pass over the 128 rounds hashes 8 (AVX2) or 16 (AVX-512) messages.
+ * Every input word is gathered before the first output word is stored, which lets the
+ * output overlap the input as it does when merkleizing a level in place.
+ */
+#define SHA256_LANES_ROUND(a, b, c, d, e, f, g, h, kw)                       \
+    do                                                                       \
+    {                                                                        \
+        VEC _t1 = V_ADD(V_ADD(V_ADD(h, V_BSIG1(e)), V_CH(e, f, g)), (kw));   \
+        VEC _t2 = V_ADD(V_BSIG0(a), V_MAJ(a, b, c));                         \
+        (d) = V_ADD((d), _t1);                                               \
+        (h) = V_ADD(_t1, _t2);                                               \
+    } while (0)
+
+#define SHA256_LANES_SCHEDULE(w, t)                                                      \
+    ((w)[(t) & 15] = V_ADD(V_ADD(V_SSIG1((w)[((t) - 2) & 15]), (w)[((t) - 7) & 15]),     \
+                           V_ADD(V_SSIG0((w)[((t) - 15) & 15]), (w)[(t) & 15])))
+
+#define SHA256_LANES_EIGHT_ROUNDS(t, KW)                       \
+    do                                                         \
+    {                                                          \
+        SHA256_LANES_ROUND(a, b, c, d, e, f, g, h, KW((t) + 0)); \
+        SHA256_LANES_ROUND(h, a, b, c, d, e, f, g, KW((t) + 1)); \
+        SHA256_LANES_ROUND(g, h, a, b, c, d, e, f, KW((t) + 2)); \
+        SHA256_LANES_ROUND(f, g, h, a, b, c, d, e, KW((t) + 3)); \
+        SHA256_LANES_ROUND(e, f, g, h, a, b, c, d, KW((t) + 4)); \
+        SHA256_LANES_ROUND(d, e, f, g, h, a, b, c, KW((t) + 5)); \
+        SHA256_LANES_ROUND(c, d, e, f, g, h, a, b, KW((t) + 6)); \
+        SHA256_LANES_ROUND(b, c, d, e, f, g, h, a, KW((t) + 7)); \
+    } while (0)
+
+#define SHA256_LANES_DATA_KW(t) \
+    V_ADD(V_SET1(SHA256_K[t]), (t) < 16 ? w[(t) & 15] : SHA256_LANES_SCHEDULE(w, t))
+#define SHA256_LANES_PAD_KW(t) V_SET1(SHA256_PAD64_KW[t])
+
+/*
+ * Runs both compression blocks of a 64-byte message on every lane. Expects w[0..15] to
+ * hold the big-endian message words and leaves the final state in s[0..7].
+ */
+#define SHA256_LANES_HASH64(w, s)                                                        \
+    do                                                                                   \
+    {                                                                                    \
+        VEC a = V_SET1(SHA256_IV[0]), b = V_SET1(SHA256_IV[1]);                          \
+        VEC c = V_SET1(SHA256_IV[2]), d = V_SET1(SHA256_IV[3]);                          \
+        VEC e = V_SET1(SHA256_IV[4]), f = V_SET1(SHA256_IV[5]);                          \
+        VEC g = V_SET1(SHA256_IV[6]), h = V_SET1(SHA256_IV[7]);                          \
+        for (int t = 0; t < 64; t += 8)                                                  \
+        {                                                                                \
+            SHA256_LANES_EIGHT_ROUNDS(t, SHA256_LANES_DATA_KW);                          \
+        }                                                                                \
+        a = V_ADD(a, V_SET1(SHA256_IV[0])); b = V_ADD(b, V_SET1(SHA256_IV[1]));          \
+        c = V_ADD(c, V_SET1(SHA256_IV[2])); d = V_ADD(d, V_SET1(SHA256_IV[3]));          \
+        e = V_ADD(e, V_SET1(SHA256_IV[4])); f = V_ADD(f, V_SET1(SHA256_IV[5]));          \
+        g = V_ADD(g, V_SET1(SHA256_IV[6])); h = V_ADD(h, V_SET1(SHA256_IV[7]));          \
+        (s)[0] = a; (s)[1] = b; (s)[2] = c; (s)[3] = d;                                  \
+        (s)[4] = e; (s)[5] = f; (s)[6] = g; (s)[7] = h;                                  \
+        for (int t = 0; t < 64; t += 8)                                                  \
+        {                                                                                \
+            SHA256_LANES_EIGHT_ROUNDS(t, SHA256_LANES_PAD_KW);                           \
+        }                                                                                \
+        (s)[0] = V_ADD((s)[0], a); (s)[1] = V_ADD((s)[1], b);                            \
+        (s)[2] = V_ADD((s)[2], c); (s)[3] = V_ADD((s)[3], d);                            \
+        (s)[4] = V_ADD((s)[4], e); (s)[5] = V_ADD((s)[5], f);                            \
+        (s)[6] = V_ADD((s)[6], g); (s)[7] = V_ADD((s)[7], h);                            \
+    } while (0)
+
+#define VEC __m256i
+#define V_SET1(x) _mm256_set1_epi32((int)(x))
+#define V_ADD(x, y) _mm256_add_epi32((x), (y))
+#define V_XOR(x, y) _mm256_xor_si256((x), (y))
+#define V_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+#define V_CH(x, y, z) V_XOR(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define V_MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define V_BSIG0(x) V_XOR(V_XOR(V_ROTR((x), 2), V_ROTR((x), 13)), V_ROTR((x), 22))
+#define V_BSIG1(x) V_XOR(V_XOR(V_ROTR((x), 6), V_ROTR((x), 11)), V_ROTR((x), 25))
+#define V_SSIG0(x) V_XOR(V_XOR(V_ROTR((x), 7), V_ROTR((x), 18)), _mm256_srli_epi32((x), 3))
+#define V_SSIG1(x) V_XOR(V_XOR(V_ROTR((x), 17), V_ROTR((x), 19)), _mm256_srli_epi32((x), 10))
+
+/**
+ * Hashes 8 consecutive 64-byte messages from in into 8 consecutive digests in out.
+ */
+__attribute__((target("avx2")))
+static void sha256_64_x8_avx2(const uint8_t *in, uint8_t *out)
+{
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                           3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i lanes = _mm256_setr_epi32(0, 64, 128, 192, 256, 320, 384, 448);
+    __m256i w[16];
+    __m256i s[8];
+    uint32_t words[8][8];
+    for (int t = 0; t < 16; t++)
+    {
+        w[t] = _mm256_shuffle_epi8(_mm256_i32gather_epi32((const int *)(in + 4 * t), lanes, 1), bswap);
+    }
+    SHA256_LANES_HASH64(w, s);
+    for (int t = 0; t < 8; t++)
+    {
+        _mm256_storeu_si256((__m256i *)words[t], _mm256_shuffle_epi8(s[t], bswap));
+    }
+    for (int lane = 0; lane < 8; lane++)
+    {
+        for (int t = 0; t < 8; t++)
+        {
+            memcpy(out + 32 * lane + 4 * t, &words[t][lane], 4);
+        }
+    }
+}
+
+#undef VEC
+#undef V_SET1
+#undef V_ADD
+#undef V_XOR
+#undef V_ROTR
+#undef V_CH
+#undef V_MAJ
+#undef V_BSIG0
+#undef V_BSIG1
+#undef V_SSIG0
+#undef V_SSIG1
+
+#define VEC __m512i
+#define V_SET1(x) _mm512_set1_epi32((int)(x))
+#define V_ADD(x, y) _mm512_add_epi32((x), (y))
+#define V_XOR3(x, y, z) _mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+#define V_CH(x, y, z) _mm512_ternarylogic_epi32((x), (y), (z), 0xCA)
+#define V_MAJ(x, y, z) _mm512_ternarylogic_epi32((x), (y), (z), 0xE8)
+#define V_BSIG0(x) V_XOR3(_mm512_ror_epi32((x), 2), _mm512_ror_epi32((x), 13), _mm512_ror_epi32((x), 22))
+#define V_BSIG1(x) V_XOR3(_mm512_ror_epi32((x), 6), _mm512_ror_epi32((x), 11), _mm512_ror_epi32((x), 25))
+#define V_SSIG0(x) V_XOR3(_mm512_ror_epi32((x), 7), _mm512_ror_epi32((x), 18), _mm512_srli_epi32((x), 3))
+#define V_SSIG1(x) V_XOR3(_mm512_ror_epi32((x), 17), _mm512_ror_epi32((x), 19), _mm512_srli_epi32((x), 10))
+
+/**
+ * Hashes 16 consecutive 64-byte messages from in into 16 consecutive digests in out.
+ */
+__attribute__((target("avx512f,avx512bw")))
+static void sha256_64_x16_avx512(const uint8_t *in, uint8_t *out)
+{
+    const __m512i bswap = _mm512_set4_epi32(0x0c0d0e0f, 0x08090a0b, 0x04050607, 0x00010203);
+    const __m512i in_lanes = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                                                  8, 9, 10, 11, 12, 13, 14, 15),
+                                                _mm512_set1_epi32(64));
+    const __m512i out_lanes = _mm512_srli_epi32(in_lanes, 1);
+    __m512i w[16];
+    __m512i s[8];
+    for (int t = 0; t < 16; t++)
+    {
+        w[t] = _mm512_shuffle_epi8(_mm512_i32gather_epi32(in_lanes, (const void *)(in + 4 * t), 1), bswap);
+    }
+    SHA256_LANES_HASH64(w, s);
+    for (int t = 0; t < 8; t++)
+    {
+        _mm512_i32scatter_epi32((void *)(out + 4 * t), out_lanes, _mm512_shuffle_epi8(s[t], bswap), 1);
+    }
+}
+
+#undef VEC
+#undef V_SET1
+#undef V_ADD
+#undef V_XOR3
+#undef V_CH
+#undef V_MAJ
+#undef V_BSIG0
+#undef V_BSIG1
+#undef V_SSIG0
+#undef V_SSIG1
+
+static uint64_t read_xcr0(void)
+{
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+}
+#endif
+
+/**
+ * Detects the instruction set extensions the library dispatches on.
+ *
+ * AVX2 and AVX-512 are only reported when XCR0 shows that the OS saves the YMM and ZMM
+ * state, so a kernel without AVX support never gets AVX code.
+ *
+ * @param features Output structure; every field is false on non-x86 builds.
+ */
+void ssz_cpu_detect(ssz_cpu_features_t *features)
+{
+    memset(features, 0, sizeof(*features));
+#ifdef SSZ_HASH_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return;
+    }
+    features->sse2 = (edx & (1u << 26)) != 0;
+    bool has_ssse3 = (ecx & (1u << 9)) != 0;
+    bool has_sse41 = (ecx & (1u << 19)) != 0;
+    bool has_osxsave = (ecx & (1u << 27)) != 0;
+    uint64_t xcr0 = has_osxsave ? read_xcr0() : 0;
+    bool os_ymm = (xcr0 & 0x06) == 0x06;
+    bool os_zmm = (xcr0 & 0xE6) == 0xE6;
+    if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx))
+    {
+        features->lzcnt = (ecx & (1u << 5)) != 0;
+    }
+    if (__get_cpuid_max(0, NULL) < 7)
+    {
+        return;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    features->shani = has_ssse3 && has_sse41 && (ebx & (1u << 29)) != 0;
+    features->avx2 = os_ymm && (ebx & (1u << 5)) != 0;
+    features->avx512 = os_zmm && (ebx & (1u << 16)) != 0 && (ebx & (1u << 30)) != 0;
+#endif
+}
+
+typedef void (*ssz_sha256_lanes_fn)(const uint8_t *in, uint8_t *out);
+
+static ssz_sha256_fn sha256_impl = sha256_generic;
+static ssz_sha256_64_fn sha256_64_impl = sha256_64_generic;
+static const char *sha256_impl_name = "generic";
+static ssz_sha256_lanes_fn sha256_lanes_impl = NULL;
+static size_t sha256_lanes = 1;
+static const char *sha256_lanes_name = "scalar";
+
+#ifdef SSZ_HASH_X86
+/**
+ * Picks the best available backends from CPUID once, before main runs, so the hot paths
+ * read fixed function pointers without any synchronisation. The 8-lane AVX2 kernel is
+ * only used without the SHA extensions, since single-buffer SHA-NI matches its throughput.
+ */
+__attribute__((constructor))
+static void sha256_select(void)
+{
+    ssz_cpu_features_t features;
+    ssz_cpu_detect(&features);
+    if (features.shani)
+    {
+        sha256_impl = sha256_shani;
+        sha256_64_impl = sha256_64_shani;
+        sha256_impl_name = "sha-ni";
+    }
+    if (features.avx512)
+    {
+        sha256_lanes_impl = sha256_64_x16_avx512;
+        sha256_lanes = 16;
+        sha256_lanes_name = "avx512";
+    }
+    else if (features.avx2 && !features.shani)
+    {
+        sha256_lanes_impl = sha256_64_x8_avx2;
+        sha256_lanes = 8;
+        sha256_lanes_name = "avx2";
+    }
+}
+#endif
+
+/**
+ * Computes the SHA-256 digest of a byte array using the backend selected for this CPU.
+ *
+ * @param data Pointer to the input bytes.
+ * @param len Number of input bytes.
+ * @param out_digest Output buffer to write the digest (32 bytes).
+ */
+void ssz_sha256(const uint8_t *data, size_t len, uint8_t *out_digest)
+{
+    sha256_impl(data, len, out_digest);
+}
+
+/**
+ * Computes the SHA-256 digest of exactly 64 bytes, the size of every Merkle tree node input.
+ *
+ * @param in Pointer to the 64 input bytes.
+ * @param out_digest Output buffer to write the digest (32 bytes). May alias in.
+ */
+void ssz_sha256_64(const uint8_t *in, uint8_t *out_digest)
+{
+    sha256_64_impl(in, out_digest);
+}
+
+/**
+ * Computes the SHA-256 digests of count consecutive 64-byte messages.
+ *
+ * Whole groups of messages go through the multi-buffer kernel; the remainder goes through
+ * the single-message 64-byte primitive.
+ *
+ * @param in Pointer to count * 64 input bytes.
+ * @param count Number of messages.
+ * @param out Output buffer for count * 32 digest bytes. May alias in.
+ */
+void ssz_sha256_64_batch(const uint8_t *in, size_t count, uint8_t *out)
+{
+    size_t i = 0;
+    if (sha256_lanes_impl != NULL)
+    {
+        for (; i + sha256_lanes <= count; i += sha256_lanes)
+        {
+            sha256_lanes_impl(in + 64 * i, out + 32 * i);
+        }
+    }
+    for (; i < count; i++)
+    {
+        sha256_64_impl(in + 64 * i, out + 32 * i);
+    }
+}
+
+/**
+ * Returns the name of the SHA-256 backend selected for this process.
+ *
+ * @return A static string such as "sha-ni" or "generic".
+ */
+const char *ssz_sha256_backend(void)
+{
+    return sha256_impl_name;
+}
+
+/**
+ * Returns the name of the multi-buffer backend used by ssz_sha256_64_batch.
+ *
+ * @return A static string such as "avx512", "avx2" or "scalar".
+ */
+const char *ssz_sha256_batch_backend(void)
+{
+    return sha256_lanes_name;
+}
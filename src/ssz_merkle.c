@@ -1,16 +1,120 @@
 #include <stdlib.h>
 #include <string.h>
-#include "mincrypt/sha256.h"
+#include <stdatomic.h>
 #include "ssz_merkle.h"
+#include "ssz_hash.h"
+#include "ssz_pool.h"
 #include "ssz_utils.h"
 #include "ssz_constants.h"
+#include "ssz_bitfield.h"
+
+/**
+ * Reduces a run of nodes at the given tree level to a single root.
+ *
+ * Whenever a level has an odd number of nodes, the missing right sibling is the root of an
+ * all-zero subtree of that height, so padding is never hashed. The odd node is paired with it
+ * in a stack buffer, so the level is reduced within its own num nodes; the root is left in
+ * the first node.
+ *
+ * @param nodes Pointer to the nodes of the starting level.
+ * @param num Number of nodes, at least 1.
+ * @param level Height of the starting level above the leaves.
+ * @param depth Height of the root above the leaves.
+ */
+static void merkleize_levels(uint8_t *nodes, size_t num, uint32_t level, uint32_t depth)
+{
+    uint8_t pair[2 * SSZ_BYTES_PER_CHUNK];
+    for (; level < depth; level++) 
+    {
+        size_t pairs = num >> 1;
+        if (num & 1) 
+        {
+            memcpy(pair, nodes + (num - 1) * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+            memcpy(pair + SSZ_BYTES_PER_CHUNK, zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+        }
+        ssz_hash_pairs(nodes, pairs, nodes);
+        if (num & 1) 
+        {
+            ssz_sha256_64(pair, nodes + pairs * SSZ_BYTES_PER_CHUNK);
+        }
+        num = pairs + (num & 1);
+    }
+}
+
+/**
+ * Returns the number of scratch bytes ssz_merkleize_ex needs for the given input.
+ *
+ * @param chunk_count Number of chunks to merkleize.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return The scratch size in bytes; 0 when the root is obtained without hashing.
+ */
+size_t ssz_merkleize_scratch_size(size_t chunk_count, size_t limit)
+{
+    if (chunk_count == 0 || ceil_log2(limit != 0 ? limit : chunk_count) == 0)
+    {
+        return 0;
+    }
+    return chunk_count * SSZ_BYTES_PER_CHUNK;
+}
+
+/**
+ * Computes the Merkle root from an array of chunks in caller-provided scratch memory.
+ *
+ * The chunks are copied into the scratch buffer, unless it is the chunk buffer itself, and
+ * reduced there level by level with merkleize_levels. No memory is allocated.
+ *
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param scratch Working buffer, or chunks itself to hash in place.
+ * @param scratch_size Size of scratch in bytes.
+ * @param out_root Output buffer to write the resulting Merkle root.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_ex(const uint8_t *chunks, size_t chunk_count, size_t limit, uint8_t *scratch,
+                             size_t scratch_size, uint8_t *out_root)
+{
+    if (limit != 0 && chunk_count > limit) 
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    if (out_root == NULL || (chunks == NULL && chunk_count != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    uint32_t depth = ceil_log2(limit != 0 ? limit : chunk_count);
+    if (chunk_count == 0) 
+    {
+        memcpy(out_root, zero_hashes[depth], SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    if (depth == 0) 
+    {
+        memcpy(out_root, chunks, SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    if (scratch == NULL || scratch_size < chunk_count * SSZ_BYTES_PER_CHUNK)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    if (scratch != chunks)
+    {
+        memcpy(scratch, chunks, chunk_count * SSZ_BYTES_PER_CHUNK);
+    }
+    merkleize_levels(scratch, chunk_count, 0, depth);
+    memcpy(out_root, scratch, SSZ_BYTES_PER_CHUNK);
+    return SSZ_SUCCESS;
+}
 
 /**
  * Computes the Merkle root from an array of chunks.
  *
- * This function constructs a Merkle tree by first copying the provided chunks
- * into leaf nodes, padding with zeros if necessary, and then iteratively hashing
- * pairs of nodes until a single root is obtained.
+ * This function copies the provided chunks into a working buffer and hashes it level by
+ * level. Padding leaves are never materialized: whenever a level has an odd number of
+ * nodes, the missing sibling is the precomputed root of an all-zero subtree of that
+ * height. Once a single node remains it is folded with zero subtree roots up to the depth
+ * implied by the limit, so memory and hashing are proportional to chunk_count. Small inputs
+ * use a stack buffer; larger ones allocate their scratch and defer to ssz_merkleize_ex.
  *
  * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
  * @param chunk_count Number of chunks provided.
@@ -20,58 +124,587 @@
  */
 ssz_error_t ssz_merkleize(const uint8_t *restrict chunks, size_t chunk_count, size_t limit, uint8_t *restrict out_root) 
 {
-    size_t effective = chunk_count;
-    if (limit != 0) 
+    if (limit != 0 && chunk_count > limit) 
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    size_t buffer_size = ssz_merkleize_scratch_size(chunk_count, limit);
+    uint8_t small_buf[SSZ_SMALL_BUFFER_SIZE];
+    uint8_t *nodes = buffer_size <= SSZ_SMALL_BUFFER_SIZE ? small_buf : malloc(buffer_size);
+    if (!nodes) 
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    ssz_error_t err = ssz_merkleize_ex(chunks, chunk_count, limit, nodes, buffer_size, out_root);
+    if (nodes != small_buf)
+    {
+        free(nodes);
+    }
+    return err;
+}
+
+/**
+ * Shared state of a parallel merkleization job.
+ */
+typedef struct
+{
+    const uint8_t *chunks;
+    size_t chunk_count;
+    size_t subtree_chunks;
+    uint8_t *roots;
+    atomic_int error;
+} merkleize_parallel_ctx_t;
+
+/**
+ * Computes the root of one power-of-two subtree of a parallel merkleization job.
+ *
+ * The subtree is streamed through a stack merkleizer, so concurrent tasks never contend on
+ * the allocator.
+ */
+static void merkleize_subtree_task(void *arg, size_t index)
+{
+    merkleize_parallel_ctx_t *ctx = (merkleize_parallel_ctx_t *)arg;
+    size_t first = index * ctx->subtree_chunks;
+    size_t count = ctx->chunk_count - first < ctx->subtree_chunks ? ctx->chunk_count - first : ctx->subtree_chunks;
+    ssz_merkleizer_t m;
+    ssz_error_t err = ssz_merkleizer_init(&m, ctx->subtree_chunks);
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_push_chunks(&m, ctx->chunks + first * SSZ_BYTES_PER_CHUNK, count);
+    }
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_finalize(&m, ctx->roots + index * SSZ_BYTES_PER_CHUNK);
+    }
+    if (err != SSZ_SUCCESS)
     {
-        if (chunk_count > limit) 
+        atomic_store(&ctx->error, (int)err);
+    }
+}
+
+/**
+ * Computes the Merkle root from an array of chunks using the built-in worker pool.
+ *
+ * The leaves are split into equal power-of-two subtrees, about four per thread and no smaller
+ * than SSZ_PARALLEL_MIN_SUBTREE_CHUNKS, whose roots are computed concurrently by streaming
+ * merkleizers. The calling thread then reduces the subtree roots to the final root.
+ * Inputs shorter than SSZ_PARALLEL_MERKLEIZE_MIN_CHUNKS, or a pool with a single thread,
+ * take the serial path directly.
+ *
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed; if non-zero, chunk_count must not exceed this limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_parallel(const uint8_t *chunks, size_t chunk_count, size_t limit, uint8_t *out_root)
+{
+    if (limit != 0 && chunk_count > limit)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    size_t threads = ssz_pool_threads();
+    if (threads <= 1 || chunk_count < SSZ_PARALLEL_MERKLEIZE_MIN_CHUNKS)
+    {
+        return ssz_merkleize(chunks, chunk_count, limit, out_root);
+    }
+    uint32_t depth = ceil_log2(limit != 0 ? limit : chunk_count);
+    size_t target_tasks = threads * 4;
+    uint32_t subtree_depth = ceil_log2((chunk_count + target_tasks - 1) / target_tasks);
+    if (subtree_depth < ceil_log2(SSZ_PARALLEL_MIN_SUBTREE_CHUNKS))
+    {
+        subtree_depth = ceil_log2(SSZ_PARALLEL_MIN_SUBTREE_CHUNKS);
+    }
+    merkleize_parallel_ctx_t ctx;
+    ctx.chunks = chunks;
+    ctx.chunk_count = chunk_count;
+    ctx.subtree_chunks = (size_t)1 << subtree_depth;
+    size_t n_subtrees = (chunk_count + ctx.subtree_chunks - 1) >> subtree_depth;
+    ctx.roots = malloc(n_subtrees * SSZ_BYTES_PER_CHUNK);
+    if (!ctx.roots)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    atomic_init(&ctx.error, SSZ_SUCCESS);
+    ssz_pool_run(merkleize_subtree_task, &ctx, n_subtrees);
+    ssz_error_t err = (ssz_error_t)atomic_load(&ctx.error);
+    if (err == SSZ_SUCCESS)
+    {
+        merkleize_levels(ctx.roots, n_subtrees, subtree_depth, depth);
+        memcpy(out_root, ctx.roots, SSZ_BYTES_PER_CHUNK);
+    }
+    free(ctx.roots);
+    return err;
+}
+
+/**
+ * Initializes a streaming merkleizer.
+ *
+ * @param m Pointer to the merkleizer to initialize.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleizer_init(ssz_merkleizer_t *m, size_t limit)
+{
+    if (m == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    m->count = 0;
+    m->limit = limit;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Appends chunks to a streaming merkleizer.
+ *
+ * Chunks are consumed in blocks. Each block is reduced level by level with ssz_hash_pairs:
+ * if the level already holds a pending left sibling it is combined with the first new node,
+ * the remaining nodes are hashed in pairs, and an unpaired last node becomes the new pending
+ * node of that level. The parents then form the run for the next level.
+ *
+ * @param m Pointer to an initialized merkleizer.
+ * @param chunks Pointer to the array of chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param chunk_count Number of chunks provided.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleizer_push_chunks(ssz_merkleizer_t *m, const uint8_t *chunks, size_t chunk_count)
+{
+    if (m == NULL || (chunks == NULL && chunk_count != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    if (m->limit != 0 && chunk_count > m->limit - m->count)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    if (m->limit == 0 && chunk_count > SIZE_MAX - m->count)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    uint8_t nodes[(SSZ_SMALL_BUFFER_SIZE / 2 + 1) * SSZ_BYTES_PER_CHUNK];
+    uint8_t pair[2 * SSZ_BYTES_PER_CHUNK];
+    while (chunk_count > 0)
+    {
+        size_t block = chunk_count < SSZ_SMALL_BUFFER_SIZE ? chunk_count : SSZ_SMALL_BUFFER_SIZE;
+        const uint8_t *src = chunks;
+        size_t start = m->count;
+        size_t run = block;
+        for (uint32_t level = 0; run > 0; level++)
         {
-            return SSZ_ERROR_SERIALIZATION;
+            size_t produced = 0;
+            if (start & 1)
+            {
+                memcpy(pair, m->pending[level], SSZ_BYTES_PER_CHUNK);
+                memcpy(pair + SSZ_BYTES_PER_CHUNK, src, SSZ_BYTES_PER_CHUNK);
+                ssz_sha256_64(pair, nodes);
+                src += SSZ_BYTES_PER_CHUNK;
+                run--;
+                produced = 1;
+            }
+            size_t pairs = run >> 1;
+            if (run & 1)
+            {
+                memcpy(m->pending[level], src + 2 * pairs * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+            }
+            ssz_hash_pairs(src, pairs, nodes + produced * SSZ_BYTES_PER_CHUNK);
+            src = nodes;
+            start >>= 1;
+            run = produced + pairs;
         }
-        effective = limit;
+        m->count += block;
+        chunks += block * SSZ_BYTES_PER_CHUNK;
+        chunk_count -= block;
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Computes the Merkle root of all chunks pushed so far.
+ *
+ * Pending nodes are folded from the lowest level upwards. A level without a pending node
+ * contributes the zero subtree root of that height as the right sibling.
+ *
+ * @param m Pointer to an initialized merkleizer.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleizer_finalize(const ssz_merkleizer_t *m, uint8_t *out_root)
+{
+    if (m == NULL || out_root == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
     }
-    if (effective == 0) 
+    uint32_t depth = ceil_log2(m->limit != 0 ? m->limit : m->count);
+    if (m->count == 0)
     {
-        memset(out_root, 0, SSZ_BYTES_PER_CHUNK);
+        memcpy(out_root, zero_hashes[depth], SSZ_BYTES_PER_CHUNK);
         return SSZ_SUCCESS;
     }
-    size_t padded = next_pow_of_two(effective);
-    if (padded == 1) 
+    if (depth < SSZ_MAX_MERKLE_DEPTH && m->count == ((size_t)1 << depth))
     {
-        if (chunk_count >= 1) 
-        {
-            memcpy(out_root, chunks, SSZ_BYTES_PER_CHUNK);
-        } else 
+        memcpy(out_root, m->pending[depth], SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    uint8_t pair[2 * SSZ_BYTES_PER_CHUNK];
+    uint8_t node[SSZ_BYTES_PER_CHUNK];
+    bool have_node = false;
+    for (uint32_t level = 0; level < depth; level++)
+    {
+        bool has_pending = (m->count >> level) & 1;
+        if (!has_pending && !have_node)
         {
-            memset(out_root, 0, SSZ_BYTES_PER_CHUNK);
+            continue;
         }
+        memcpy(pair, has_pending ? m->pending[level] : node, SSZ_BYTES_PER_CHUNK);
+        memcpy(pair + SSZ_BYTES_PER_CHUNK, has_pending && have_node ? node : zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+        ssz_sha256_64(pair, node);
+        have_node = true;
+    }
+    memcpy(out_root, node, SSZ_BYTES_PER_CHUNK);
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Computes the Merkle root of a byte string packed into chunks.
+ *
+ * Whole chunks are pushed straight from the input into a streaming merkleizer and only the
+ * final partial chunk is copied and zero-padded, so the input is never duplicated.
+ *
+ * @param bytes Pointer to the input bytes. May be NULL if byte_count is 0.
+ * @param byte_count Number of input bytes.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_packed(const uint8_t *bytes, size_t byte_count, size_t limit, uint8_t *out_root)
+{
+    ssz_merkleizer_t m;
+    size_t full_chunks = byte_count / SSZ_BYTES_PER_CHUNK;
+    size_t rem = byte_count % SSZ_BYTES_PER_CHUNK;
+    ssz_error_t err = ssz_merkleizer_init(&m, limit);
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_push_chunks(&m, bytes, full_chunks);
+    }
+    if (err == SSZ_SUCCESS && rem != 0)
+    {
+        uint8_t last[SSZ_BYTES_PER_CHUNK] = {0};
+        memcpy(last, bytes + full_chunks * SSZ_BYTES_PER_CHUNK, rem);
+        err = ssz_merkleizer_push_chunks(&m, last, 1);
+    }
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_finalize(&m, out_root);
+    }
+    return err;
+}
+
+/**
+ * Checks that a basic element size divides a chunk and that the byte length fits in size_t.
+ */
+static bool basic_layout_valid(size_t element_size, size_t element_count, size_t max_length)
+{
+    if (element_size == 0 || element_size > SSZ_BYTES_PER_CHUNK || (element_size & (element_size - 1)) != 0)
+    {
+        return false;
+    }
+    return element_count <= max_length && max_length <= SIZE_MAX / element_size;
+}
+
+/**
+ * Computes the hash tree root of a vector of basic values.
+ *
+ * The element array is already the packed chunk sequence, so it is handed directly to
+ * ssz_merkleize_packed without an intermediate ssz_pack buffer.
+ *
+ * @param elements Pointer to the element array. May be NULL if element_count is 0.
+ * @param element_size Size of each element in bytes.
+ * @param element_count Number of elements in the vector.
+ * @param out_root Output buffer to write the hash tree root.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_hash_tree_root_basic_vector(const void *elements, size_t element_size, size_t element_count,
+                                            uint8_t *out_root)
+{
+    if (!basic_layout_valid(element_size, element_count, element_count) || out_root == NULL ||
+        (elements == NULL && element_count != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t byte_count = element_count * element_size;
+    size_t limit = (byte_count + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
+    return ssz_merkleize_packed(elements, byte_count, limit, out_root);
+}
+
+/**
+ * Computes the hash tree root of a list of basic values.
+ *
+ * The elements are merkleized in place against the chunk limit of max_length elements,
+ * then the element count is mixed in.
+ *
+ * @param elements Pointer to the element array. May be NULL if element_count is 0.
+ * @param element_size Size of each element in bytes.
+ * @param element_count Number of elements in the list.
+ * @param max_length Maximum number of elements of the list type.
+ * @param out_root Output buffer to write the hash tree root.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_hash_tree_root_basic_list(const void *elements, size_t element_size, size_t element_count,
+                                          size_t max_length, uint8_t *out_root)
+{
+    if (element_count > max_length)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    if (!basic_layout_valid(element_size, element_count, max_length) || out_root == NULL ||
+        (elements == NULL && element_count != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t limit = (max_length * element_size + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
+    ssz_error_t err = ssz_merkleize_packed(elements, element_count * element_size, limit, out_root);
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_mix_in_length(out_root, element_count, out_root);
+    }
+    return err;
+}
+
+/**
+ * Computes the Merkle root of an array of boolean values packed as a bitfield.
+ *
+ * Bits are packed little-endian within each byte, a few chunks at a time, into a stack buffer
+ * that is streamed into a merkleizer. No length delimiter is added.
+ *
+ * @param bits Pointer to the array of boolean values. May be NULL if bit_count is 0.
+ * @param bit_count Number of boolean values.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkleize_bits(const bool *bits, size_t bit_count, size_t limit, uint8_t *out_root)
+{
+    ssz_merkleizer_t m;
+    uint8_t packed[SSZ_SMALL_BUFFER_SIZE];
+    const size_t bits_per_block = SSZ_SMALL_BUFFER_SIZE * SSZ_BITS_PER_BYTE;
+    ssz_error_t err = ssz_merkleizer_init(&m, limit);
+    for (size_t start = 0; err == SSZ_SUCCESS && start < bit_count; start += bits_per_block)
+    {
+        size_t n = bit_count - start < bits_per_block ? bit_count - start : bits_per_block;
+        size_t n_bytes = (n + 7) >> 3;
+        size_t n_chunks = (n_bytes + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
+        memset(packed + n_bytes, 0, n_chunks * SSZ_BYTES_PER_CHUNK - n_bytes);
+        ssz_bits_pack(bits + start, n, packed);
+        err = ssz_merkleizer_push_chunks(&m, packed, n_chunks);
+    }
+    if (err == SSZ_SUCCESS)
+    {
+        err = ssz_merkleizer_finalize(&m, out_root);
+    }
+    return err;
+}
+
+/**
+ * Hashes adjacent pairs of chunks into their parent nodes.
+ *
+ * Each 64-byte pair is an independent SHA256 message, so the whole level is handed to the
+ * batch hasher, which runs as many pairs side by side as the CPU has lanes for.
+ *
+ * @param in Pointer to n_pairs * 2 chunks (each chunk is SSZ_BYTES_PER_CHUNK bytes).
+ * @param n_pairs Number of chunk pairs to hash.
+ * @param out Output buffer for n_pairs chunks. May be the same pointer as in.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_hash_pairs(const uint8_t *in, size_t n_pairs, uint8_t *out)
+{
+    if (n_pairs == 0)
+    {
         return SSZ_SUCCESS;
     }
-    uint8_t *restrict nodes = malloc(padded * SSZ_BYTES_PER_CHUNK);
-    if (!nodes) 
+    if (in == NULL || out == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    ssz_sha256_64_batch(in, n_pairs, out);
+    return SSZ_SUCCESS;
+}
+
+/**
+ * One proof's hashing step at the current level of ssz_verify_branches.
+ */
+typedef struct
+{
+    uint8_t message[2 * SSZ_BYTES_PER_CHUNK]; /**< Left and right child of the parent node. */
+    uint64_t gindex;                          /**< Generalized index of the proof's current node. */
+    size_t proof;                             /**< Index of the proof. */
+    size_t slot;                              /**< Index of the deduplicated message in the batch. */
+} branch_step_t;
+
+/**
+ * Orders steps by node, then by message, so identical hashes end up adjacent.
+ */
+static int branch_step_compare(const void *a, const void *b)
+{
+    const branch_step_t *x = a;
+    const branch_step_t *y = b;
+    if (x->gindex != y->gindex)
+    {
+        return x->gindex < y->gindex ? -1 : 1;
+    }
+    int cmp = memcmp(x->message, y->message, sizeof(x->message));
+    if (cmp != 0)
+    {
+        return cmp;
+    }
+    return (x->proof > y->proof) - (x->proof < y->proof);
+}
+
+static uint32_t gindex_depth(uint64_t gindex)
+{
+    return 63 - (uint32_t)__builtin_clzll(gindex);
+}
+
+/**
+ * Verifies many Merkle branches against the same root in one pass.
+ *
+ * Every level collects one 64-byte message per live proof, sorts them so that proofs hashing
+ * the same node with the same sibling become neighbours, and hashes each distinct message once
+ * through ssz_hash_pairs. A proof whose message and remaining branch both equal those of its
+ * neighbour can only end at the same root, so it is merged into that neighbour and drops out
+ * of all upper levels.
+ *
+ * @param leaves Pointer to gindex_count leaves (each leaf is SSZ_BYTES_PER_CHUNK bytes).
+ * @param branches Pointer to gindex_count branch pointers.
+ * @param gindices Pointer to the generalized indices of the leaves.
+ * @param gindex_count Number of proofs.
+ * @param root Pointer to the expected root.
+ * @param out_valid Output array of gindex_count validity flags.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_verify_branches(const uint8_t *leaves, const uint8_t *const *branches, const uint64_t *gindices,
+                                size_t gindex_count, const uint8_t *root, bool *out_valid)
+{
+    if (gindex_count == 0)
+    {
+        return SSZ_SUCCESS;
+    }
+    if (leaves == NULL || branches == NULL || gindices == NULL || root == NULL || out_valid == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    uint32_t max_depth = 0;
+    for (size_t i = 0; i < gindex_count; i++)
+    {
+        if (gindices[i] == 0)
+        {
+            return SSZ_ERROR_OUT_OF_RANGE;
+        }
+        uint32_t depth = gindex_depth(gindices[i]);
+        if (depth > 0 && branches[i] == NULL)
+        {
+            return SSZ_ERROR_MERKLEIZATION;
+        }
+        if (depth > max_depth)
+        {
+            max_depth = depth;
+        }
+    }
+
+    uint8_t *nodes = malloc(gindex_count * SSZ_BYTES_PER_CHUNK);
+    uint8_t *batch = malloc(gindex_count * 2 * SSZ_BYTES_PER_CHUNK);
+    branch_step_t *steps = malloc(gindex_count * sizeof(branch_step_t));
+    size_t *merged_into = malloc(gindex_count * sizeof(size_t));
+    if (nodes == NULL || batch == NULL || steps == NULL || merged_into == NULL)
     {
+        free(nodes);
+        free(batch);
+        free(steps);
+        free(merged_into);
         return SSZ_ERROR_MERKLEIZATION;
     }
-    if (chunk_count) 
+    memcpy(nodes, leaves, gindex_count * SSZ_BYTES_PER_CHUNK);
+    for (size_t i = 0; i < gindex_count; i++)
     {
-        memcpy(nodes, chunks, chunk_count * SSZ_BYTES_PER_CHUNK);
+        merged_into[i] = i;
     }
-    if (chunk_count < padded) 
+
+    ssz_error_t err = SSZ_SUCCESS;
+    for (uint32_t level = max_depth; level > 0 && err == SSZ_SUCCESS; level--)
     {
-        memset(nodes + chunk_count * SSZ_BYTES_PER_CHUNK, 0, (padded - chunk_count) * SSZ_BYTES_PER_CHUNK);
+        size_t n_steps = 0;
+        for (size_t i = 0; i < gindex_count; i++)
+        {
+            uint32_t depth = gindex_depth(gindices[i]);
+            if (merged_into[i] != i || depth < level)
+            {
+                continue;
+            }
+            branch_step_t *step = &steps[n_steps++];
+            const uint8_t *sibling = branches[i] + (size_t)(depth - level) * SSZ_BYTES_PER_CHUNK;
+            step->gindex = gindices[i] >> (depth - level);
+            step->proof = i;
+            if (step->gindex & 1)
+            {
+                memcpy(step->message, sibling, SSZ_BYTES_PER_CHUNK);
+                memcpy(step->message + SSZ_BYTES_PER_CHUNK, nodes + i * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+            }
+            else
+            {
+                memcpy(step->message, nodes + i * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+                memcpy(step->message + SSZ_BYTES_PER_CHUNK, sibling, SSZ_BYTES_PER_CHUNK);
+            }
+        }
+        qsort(steps, n_steps, sizeof(branch_step_t), branch_step_compare);
+
+        size_t n_unique = 0;
+        for (size_t s = 0; s < n_steps; s++)
+        {
+            const branch_step_t *prev = s > 0 ? &steps[s - 1] : NULL;
+            if (prev == NULL || prev->gindex != steps[s].gindex ||
+                memcmp(prev->message, steps[s].message, sizeof(steps[s].message)) != 0)
+            {
+                memcpy(batch + n_unique * 2 * SSZ_BYTES_PER_CHUNK, steps[s].message, sizeof(steps[s].message));
+                steps[s].slot = n_unique++;
+                continue;
+            }
+            steps[s].slot = prev->slot;
+            size_t leader = merged_into[prev->proof];
+            size_t proof = steps[s].proof;
+            size_t rest = (size_t)(level - 1) * SSZ_BYTES_PER_CHUNK;
+            const uint8_t *leader_rest = branches[leader] + (gindex_depth(gindices[leader]) - level + 1) * SSZ_BYTES_PER_CHUNK;
+            const uint8_t *proof_rest = branches[proof] + (gindex_depth(gindices[proof]) - level + 1) * SSZ_BYTES_PER_CHUNK;
+            if (memcmp(leader_rest, proof_rest, rest) == 0)
+            {
+                merged_into[proof] = leader;
+            }
+        }
+
+        err = ssz_hash_pairs(batch, n_unique, batch);
+        for (size_t s = 0; s < n_steps; s++)
+        {
+            memcpy(nodes + steps[s].proof * SSZ_BYTES_PER_CHUNK, batch + steps[s].slot * SSZ_BYTES_PER_CHUNK,
+                   SSZ_BYTES_PER_CHUNK);
+        }
     }
-    size_t num = padded;
-    while (num > 1) 
+
+    if (err == SSZ_SUCCESS)
     {
-        size_t parent = num >> 1;
-        for (size_t i = 0; i < parent; i++) 
+        for (size_t i = 0; i < gindex_count; i++)
         {
-            SHA256_hash(nodes + (2 * i) * SSZ_BYTES_PER_CHUNK, 2 * SSZ_BYTES_PER_CHUNK, nodes + i * SSZ_BYTES_PER_CHUNK);
+            size_t r = i;
+            while (merged_into[r] != r)
+            {
+                r = merged_into[r];
+            }
+            out_valid[i] = memcmp(nodes + r * SSZ_BYTES_PER_CHUNK, root, SSZ_BYTES_PER_CHUNK) == 0;
         }
-        num = parent;
     }
-    memcpy(out_root, nodes, SSZ_BYTES_PER_CHUNK);
     free(nodes);
-    return SSZ_SUCCESS;
+    free(batch);
+    free(steps);
+    free(merged_into);
+    return err;
 }
 
 /**
@@ -119,7 +752,8 @@ ssz_error_t ssz_pack(
  *
  * This function converts a bitfield represented as an array of booleans into a compact byte array,
  * and then divides that byte array into fixed-size chunks (each of size SSZ_BYTES_PER_CHUNK) for Merkleization.
- * If bit_count is zero, a single default chunk is generated.
+ * If bit_count is zero, a single default chunk is generated. The bits are packed directly into
+ * out_chunks, so no intermediate buffer is allocated.
  *
  * @param bits Pointer to the array of boolean values.
  * @param bit_count Number of boolean values in the array.
@@ -129,48 +763,29 @@ ssz_error_t ssz_pack(
  */
 ssz_error_t ssz_pack_bits(const bool *bits, size_t bit_count, uint8_t *out_chunks, size_t *out_chunk_count) {
     size_t bitfield_len = bit_count ? (bit_count + 7) >> 3 : 1;
-    uint8_t small_buf[SSZ_SMALL_BUFFER_SIZE];
-    uint8_t *bitfield_bytes = bitfield_len <= SSZ_SMALL_BUFFER_SIZE ? small_buf : malloc(bitfield_len);
-    if (!bitfield_bytes) 
+    size_t chunk_count = (bitfield_len + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
+    if (out_chunks == NULL || out_chunk_count == NULL || (bits == NULL && bit_count != 0)) 
     {
         return SSZ_ERROR_MERKLEIZATION;
     }
+    memset(out_chunks, 0, chunk_count * SSZ_BYTES_PER_CHUNK);
     if (!bit_count) 
     {
-        bitfield_bytes[0] = 0x01;
+        out_chunks[0] = 0x01;
     }
     else 
     {
-        memset(bitfield_bytes, 0, bitfield_len);
-        size_t full_bytes = bit_count >> 3, rem = bit_count & 7;
-        for (size_t i = 0; i < full_bytes; i++) 
-        {
-            size_t base = i << 3;
-            bitfield_bytes[i] = (uint8_t)bits[base] | (uint8_t)bits[base+1] << 1 |
-                (uint8_t)bits[base+2] << 2 | (uint8_t)bits[base+3] << 3 |
-                (uint8_t)bits[base+4] << 4 | (uint8_t)bits[base+5] << 5 |
-                (uint8_t)bits[base+6] << 6 | (uint8_t)bits[base+7] << 7;
-        }
-        if (rem) 
-        {
-            uint8_t byte = 0;
-            for (size_t j = 0, base = full_bytes << 3; j < rem; j++) byte |= (uint8_t)bits[base + j] << j;
-            bitfield_bytes[full_bytes] = byte;
-        }
+        ssz_bits_pack(bits, bit_count, out_chunks);
     }
-    ssz_error_t err = ssz_pack(bitfield_bytes, 1, bitfield_len, out_chunks, out_chunk_count);
-    if (bitfield_bytes != small_buf)
-    {
-        free(bitfield_bytes);
-    }
-    return err;
+    *out_chunk_count = chunk_count;
+    return SSZ_SUCCESS;
 }
 
 /**
  * Mixes a length value into a Merkle root to produce an updated root.
  *
  * This function takes an existing Merkle root and a length value, then mixes the length
- * into the root by placing it in a buffer alongside the original root and computing SHA256_hash.
+ * into the root by placing it in a buffer alongside the original root and computing SHA256.
  *
  * @param root Pointer to the original Merkle root (32 bytes).
  * @param length 64-bit unsigned integer representing the length to mix in.
@@ -189,7 +804,7 @@ ssz_error_t ssz_mix_in_length(const uint8_t *root, uint64_t length, uint8_t *out
     buf[38] = (uint8_t)(length >> 48);
     buf[39] = (uint8_t)(length >> 56);
     memset(buf + 40, 0, 24);
-    SHA256_hash(buf, 64, out_root);
+    ssz_sha256_64(buf, out_root);
     return SSZ_SUCCESS;
 }
 
@@ -197,7 +812,7 @@ ssz_error_t ssz_mix_in_length(const uint8_t *root, uint64_t length, uint8_t *out
  * Mixes a selector byte into a Merkle root to produce an updated root.
  *
  * This function takes an existing Merkle root and a selector byte, places the selector in a
- * buffer along with the root, and computes SHA256_hash to produce a new Merkle root.
+ * buffer along with the root, and computes SHA256 to produce a new Merkle root.
  *
  * @param root Pointer to the original Merkle root (32 bytes).
  * @param selector The selector byte to mix into the root.
@@ -212,6 +827,6 @@ ssz_error_t ssz_mix_in_selector(
     uint8_t buf[64] = {0};
     memcpy(buf, root, 32);
     buf[32] = selector;
-    SHA256_hash(buf, 64, out_root);
+    ssz_sha256_64(buf, out_root);
     return SSZ_SUCCESS;
 }
\ No newline at end of file
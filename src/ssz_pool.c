@@ -0,0 +1,226 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+#include "ssz_pool.h"
+
+static pthread_mutex_t pool_run_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_done_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t *pool_workers;
+static size_t pool_worker_count;
+static size_t pool_thread_count;
+static bool pool_configured;
+static bool pool_stopping;
+static uint64_t pool_generation;
+static uint64_t pool_base_generation;
+static size_t pool_active;
+static ssz_pool_task_fn pool_fn;
+static void *pool_ctx;
+static size_t pool_n_tasks;
+static atomic_size_t pool_next_task;
+static _Thread_local bool pool_in_task;
+
+/**
+ * Claims and executes tasks of the current job until none are left.
+ */
+static void pool_drain(ssz_pool_task_fn fn, void *ctx, size_t n_tasks)
+{
+    pool_in_task = true;
+    for (;;)
+    {
+        size_t index = atomic_fetch_add_explicit(&pool_next_task, 1, memory_order_relaxed);
+        if (index >= n_tasks)
+        {
+            break;
+        }
+        fn(ctx, index);
+    }
+    pool_in_task = false;
+}
+
+/**
+ * Worker thread main loop: waits for a new job generation, drains it and reports completion.
+ */
+static void *pool_worker_main(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&pool_lock);
+    uint64_t seen = pool_base_generation;
+    for (;;)
+    {
+        while (!pool_stopping && pool_generation == seen)
+        {
+            pthread_cond_wait(&pool_work_cond, &pool_lock);
+        }
+        if (pool_stopping)
+        {
+            break;
+        }
+        seen = pool_generation;
+        ssz_pool_task_fn fn = pool_fn;
+        void *ctx = pool_ctx;
+        size_t n_tasks = pool_n_tasks;
+        pthread_mutex_unlock(&pool_lock);
+        pool_drain(fn, ctx, n_tasks);
+        pthread_mutex_lock(&pool_lock);
+        if (--pool_active == 0)
+        {
+            pthread_cond_signal(&pool_done_cond);
+        }
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return NULL;
+}
+
+/**
+ * Stops and joins all worker threads. Must be called with pool_run_lock held.
+ */
+static void pool_stop_workers(void)
+{
+    pthread_mutex_lock(&pool_lock);
+    pool_stopping = true;
+    pthread_cond_broadcast(&pool_work_cond);
+    pthread_mutex_unlock(&pool_lock);
+    for (size_t i = 0; i < pool_worker_count; i++)
+    {
+        pthread_join(pool_workers[i], NULL);
+    }
+    free(pool_workers);
+    pool_workers = NULL;
+    pool_worker_count = 0;
+    pool_stopping = false;
+}
+
+/**
+ * Returns the number of online CPUs, or 1 if it cannot be determined.
+ */
+static size_t pool_online_cpus(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (size_t)online : 1;
+#endif
+}
+
+/**
+ * Starts n_threads - 1 worker threads. Must be called with pool_run_lock held.
+ */
+static ssz_error_t pool_start_workers(size_t n_threads)
+{
+    if (n_threads == 0)
+    {
+        n_threads = pool_online_cpus();
+    }
+    pool_thread_count = 1;
+    pool_configured = true;
+    if (n_threads == 1)
+    {
+        return SSZ_SUCCESS;
+    }
+    pool_base_generation = pool_generation;
+    pool_workers = malloc((n_threads - 1) * sizeof(pthread_t));
+    if (!pool_workers)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    for (size_t i = 0; i < n_threads - 1; i++)
+    {
+        if (pthread_create(&pool_workers[pool_worker_count], NULL, pool_worker_main, NULL) != 0)
+        {
+            pool_stop_workers();
+            return SSZ_ERROR_OUT_OF_RANGE;
+        }
+        pool_worker_count++;
+    }
+    pool_thread_count = n_threads;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Sets the number of threads used by the built-in worker pool.
+ *
+ * @param n_threads Number of threads, or 0 for the number of online CPUs.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_pool_set_threads(size_t n_threads)
+{
+    pthread_mutex_lock(&pool_run_lock);
+    pool_stop_workers();
+    ssz_error_t err = pool_start_workers(n_threads);
+    pthread_mutex_unlock(&pool_run_lock);
+    return err;
+}
+
+/**
+ * Returns the number of threads used by the built-in worker pool.
+ *
+ * @return The configured thread count, including the calling thread, or 1 inside a task.
+ */
+size_t ssz_pool_threads(void)
+{
+    if (pool_in_task)
+    {
+        return 1;
+    }
+    pthread_mutex_lock(&pool_run_lock);
+    if (!pool_configured)
+    {
+        pool_start_workers(0);
+    }
+    size_t n = pool_thread_count;
+    pthread_mutex_unlock(&pool_run_lock);
+    return n;
+}
+
+/**
+ * Runs fn(ctx, i) for every i in [0, n_tasks) on the built-in worker pool.
+ *
+ * @param fn Function to execute for each task.
+ * @param ctx Context pointer passed to every task.
+ * @param n_tasks Number of tasks.
+ */
+void ssz_pool_run(ssz_pool_task_fn fn, void *ctx, size_t n_tasks)
+{
+    if (pool_in_task || n_tasks <= 1)
+    {
+        for (size_t i = 0; i < n_tasks; i++)
+        {
+            fn(ctx, i);
+        }
+        return;
+    }
+    pthread_mutex_lock(&pool_run_lock);
+    if (!pool_configured)
+    {
+        pool_start_workers(0);
+    }
+    atomic_store_explicit(&pool_next_task, 0, memory_order_relaxed);
+    pthread_mutex_lock(&pool_lock);
+    pool_fn = fn;
+    pool_ctx = ctx;
+    pool_n_tasks = n_tasks;
+    pool_active = pool_worker_count;
+    pool_generation++;
+    pthread_cond_broadcast(&pool_work_cond);
+    pthread_mutex_unlock(&pool_lock);
+    pool_drain(fn, ctx, n_tasks);
+    pthread_mutex_lock(&pool_lock);
+    while (pool_active > 0)
+    {
+        pthread_cond_wait(&pool_done_cond, &pool_lock);
+    }
+    pthread_mutex_unlock(&pool_lock);
+    pthread_mutex_unlock(&pool_run_lock);
+}
@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ssz_proof.h"
+#include "ssz_constants.h"
+
+static int proof_compare_desc(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x < y) - (x > y);
+}
+
+/**
+ * Sorts an index array in descending order and removes duplicates.
+ *
+ * @return The number of unique indices.
+ */
+static size_t proof_sort_unique(uint64_t *indices, size_t count)
+{
+    if (count < 2)
+    {
+        return count;
+    }
+    qsort(indices, count, sizeof(uint64_t), proof_compare_desc);
+    size_t unique = 1;
+    for (size_t i = 1; i < count; i++)
+    {
+        if (indices[i] != indices[unique - 1])
+        {
+            indices[unique++] = indices[i];
+        }
+    }
+    return unique;
+}
+
+/**
+ * Computes the generalized indices of the helper nodes of a multiproof.
+ *
+ * The path and branch sets are built as sorted, deduplicated arrays and the helpers are the
+ * branch entries that do not appear on any path, found with a single merge pass.
+ *
+ * @param gindices Pointer to the requested generalized indices.
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param capacity Capacity of out_indices.
+ * @param out_count Pointer to store the number of helper indices.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_multiproof_indices(const uint64_t *gindices, size_t gindex_count, uint64_t *out_indices,
+                                   size_t capacity, size_t *out_count)
+{
+    if ((gindices == NULL && gindex_count != 0) || out_count == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < gindex_count; i++)
+    {
+        if (gindices[i] == 0)
+        {
+            return SSZ_ERROR_OUT_OF_RANGE;
+        }
+        total += 63 - (size_t)__builtin_clzll(gindices[i]);
+    }
+    uint64_t *paths = malloc((2 * total + 1) * sizeof(uint64_t));
+    if (!paths)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    uint64_t *branches = paths + total;
+    size_t n = 0;
+    for (size_t i = 0; i < gindex_count; i++)
+    {
+        for (uint64_t g = gindices[i]; g > 1; g >>= 1)
+        {
+            paths[n] = g;
+            branches[n] = g ^ 1;
+            n++;
+        }
+    }
+    size_t n_paths = proof_sort_unique(paths, n);
+    size_t n_branches = proof_sort_unique(branches, n);
+    size_t count = 0;
+    size_t p = 0;
+    ssz_error_t err = SSZ_SUCCESS;
+    for (size_t b = 0; b < n_branches; b++)
+    {
+        while (p < n_paths && paths[p] > branches[b])
+        {
+            p++;
+        }
+        if (p < n_paths && paths[p] == branches[b])
+        {
+            continue;
+        }
+        if (count == capacity || out_indices == NULL)
+        {
+            err = SSZ_ERROR_OUT_OF_RANGE;
+            break;
+        }
+        out_indices[count++] = branches[b];
+    }
+    free(paths);
+    *out_count = count;
+    return err;
+}
+
+/**
+ * Builds the Merkle branch of a single node of a cached hash tree.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindex Generalized index of the proven node.
+ * @param out_branch Output buffer for the branch.
+ * @param out_depth Pointer to store the number of branch nodes written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_proof(ssz_tree_t *tree, uint64_t gindex, uint8_t *out_branch, size_t *out_depth)
+{
+    if (tree == NULL || out_branch == NULL || out_depth == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    if (gindex == 0 || 63 - (uint32_t)__builtin_clzll(gindex) > ssz_tree_depth(tree))
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    size_t depth = 0;
+    for (uint64_t g = gindex; g > 1; g >>= 1)
+    {
+        ssz_error_t err = ssz_tree_get_node(tree, g ^ 1, out_branch + depth * SSZ_BYTES_PER_CHUNK);
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+        depth++;
+    }
+    *out_depth = depth;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Builds a deduplicated multiproof for several nodes of a cached hash tree.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindices Pointer to the requested generalized indices.
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param out_nodes Output buffer for the helper nodes.
+ * @param capacity Capacity of out_indices and out_nodes, in entries.
+ * @param out_count Pointer to store the number of helpers written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_multiproof(ssz_tree_t *tree, const uint64_t *gindices, size_t gindex_count,
+                                uint64_t *out_indices, uint8_t *out_nodes, size_t capacity, size_t *out_count)
+{
+    if (tree == NULL || out_nodes == NULL || (gindices == NULL && gindex_count != 0) || out_count == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    uint32_t depth = ssz_tree_depth(tree);
+    for (size_t i = 0; i < gindex_count; i++)
+    {
+        if (gindices[i] == 0 || 63 - (uint32_t)__builtin_clzll(gindices[i]) > depth)
+        {
+            return SSZ_ERROR_OUT_OF_RANGE;
+        }
+    }
+    ssz_error_t err = ssz_multiproof_indices(gindices, gindex_count, out_indices, capacity, out_count);
+    for (size_t i = 0; err == SSZ_SUCCESS && i < *out_count; i++)
+    {
+        err = ssz_tree_get_node(tree, out_indices[i], out_nodes + i * SSZ_BYTES_PER_CHUNK);
+    }
+    return err;
+}
+
+/**
+ * Builds a deduplicated multiproof directly from an array of chunks.
+ *
+ * @param chunks Pointer to the array of chunks.
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @param gindices Pointer to the requested generalized indices.
+ * @param gindex_count Number of requested indices.
+ * @param out_indices Output buffer for the helper indices.
+ * @param out_nodes Output buffer for the helper nodes.
+ * @param capacity Capacity of out_indices and out_nodes, in entries.
+ * @param out_count Pointer to store the number of helpers written.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_merkle_multiproof(const uint8_t *chunks, size_t chunk_count, size_t limit,
+                                  const uint64_t *gindices, size_t gindex_count,
+                                  uint64_t *out_indices, uint8_t *out_nodes, size_t capacity, size_t *out_count)
+{
+    ssz_tree_t tree;
+    ssz_error_t err = ssz_tree_init(&tree, chunks, chunk_count, limit);
+    if (err != SSZ_SUCCESS)
+    {
+        return err;
+    }
+    err = ssz_tree_multiproof(&tree, gindices, gindex_count, out_indices, out_nodes, capacity, out_count);
+    ssz_tree_free(&tree);
+    return err;
+}
@@ -0,0 +1,377 @@
+#include <string.h>
+#include "ssz_reader.h"
+#include "ssz_constants.h"
+
+/**
+ * Records the first error of a reader and returns it.
+ */
+static ssz_error_t reader_fail(ssz_reader_t *reader, ssz_error_t err)
+{
+    if (reader->error == SSZ_SUCCESS)
+    {
+        reader->error = err;
+    }
+    return reader->error;
+}
+
+/**
+ * Asks the step function for the size of the next field, decoding zero-size fields on the
+ * spot, until a field needs bytes or the object is complete.
+ */
+static ssz_error_t reader_advance(ssz_reader_t *reader)
+{
+    for (;;)
+    {
+        reader->need = 0;
+        reader->expecting = true;
+        ssz_error_t err = reader->step(reader, NULL, 0);
+        reader->expecting = false;
+        if (err != SSZ_SUCCESS)
+        {
+            return reader_fail(reader, err);
+        }
+        if (reader->complete || reader->need > 0)
+        {
+            return SSZ_SUCCESS;
+        }
+        err = reader->step(reader, reader->buf, 0);
+        if (err != SSZ_SUCCESS)
+        {
+            return reader_fail(reader, err);
+        }
+    }
+}
+
+/**
+ * Decodes the current field from size bytes at data and asks for the next one.
+ */
+static ssz_error_t reader_run(ssz_reader_t *reader, const uint8_t *data, size_t size)
+{
+    ssz_error_t err = reader->step(reader, data, size);
+    if (err != SSZ_SUCCESS)
+    {
+        return reader_fail(reader, err);
+    }
+    reader->position += size;
+    return reader_advance(reader);
+}
+
+/**
+ * Finds the bounds of the next variable-size field, checking all offsets on the first call.
+ */
+static ssz_error_t reader_variable_size(ssz_reader_t *reader, size_t *out_size)
+{
+    size_t index = reader->variable_index;
+    if (index >= reader->offset_count)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (index == 0)
+    {
+        if (reader->offsets[0] != reader->position)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+        for (size_t i = 1; i < reader->offset_count; i++)
+        {
+            if (reader->offsets[i] < reader->offsets[i - 1])
+            {
+                return SSZ_ERROR_DESERIALIZATION;
+            }
+        }
+        if (reader->offsets[reader->offset_count - 1] > reader->total_size)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+    }
+    size_t end = index + 1 < reader->offset_count ? reader->offsets[index + 1] : reader->total_size;
+    *out_size = end - reader->offsets[index];
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Initializes a reader for an object of known serialized size.
+ *
+ * @param reader Pointer to the reader to initialize.
+ * @param staging Staging buffer owned by the caller.
+ * @param staging_size Size of the staging buffer in bytes.
+ * @param total_size Serialized size of the object.
+ * @param step Field-by-field decoder of the object.
+ * @param object Object to decode into.
+ * @param arena Arena for nested lists, or NULL to use malloc.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_reader_init(ssz_reader_t *reader, uint8_t *staging, size_t staging_size, size_t total_size,
+                            ssz_reader_step_fn step, void *object, ssz_arena_t *arena)
+{
+    if (reader == NULL || staging == NULL || staging_size == 0 || step == NULL || object == NULL)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    memset(reader, 0, sizeof(*reader));
+    reader->step = step;
+    reader->object = object;
+    reader->arena = arena;
+    reader->buf = staging;
+    reader->capacity = staging_size;
+    reader->total_size = total_size;
+    reader->error = SSZ_SUCCESS;
+    return reader_advance(reader);
+}
+
+/**
+ * Feeds the next chunk of serialized input to the reader.
+ *
+ * A field that is entirely inside the chunk and has nothing staged is decoded in place;
+ * otherwise its bytes are collected in the staging buffer first.
+ *
+ * @param reader Pointer to the reader.
+ * @param data Pointer to the chunk.
+ * @param len Number of bytes in the chunk.
+ * @return SSZ_SUCCESS on success, or the first error of the reader.
+ */
+ssz_error_t ssz_reader_push(ssz_reader_t *reader, const uint8_t *data, size_t len)
+{
+    if (reader->error != SSZ_SUCCESS)
+    {
+        return reader->error;
+    }
+    if (data == NULL && len != 0)
+    {
+        return reader_fail(reader, SSZ_ERROR_DESERIALIZATION);
+    }
+    while (len > 0)
+    {
+        if (reader->complete)
+        {
+            return reader_fail(reader, SSZ_ERROR_DESERIALIZATION);
+        }
+        ssz_error_t err;
+        if (reader->buffered == 0 && len >= reader->need)
+        {
+            size_t size = reader->need;
+            err = reader_run(reader, data, size);
+            data += size;
+            len -= size;
+        }
+        else
+        {
+            size_t take = reader->need - reader->buffered;
+            if (take > len)
+            {
+                take = len;
+            }
+            memcpy(reader->buf + reader->buffered, data, take);
+            reader->buffered += take;
+            data += take;
+            len -= take;
+            if (reader->buffered < reader->need)
+            {
+                break;
+            }
+            reader->buffered = 0;
+            err = reader_run(reader, reader->buf, reader->need);
+        }
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Returns how many more bytes the reader needs before it can decode its next field.
+ *
+ * @param reader Pointer to the reader.
+ * @return The number of bytes, or 0 once the object is complete or the reader has failed.
+ */
+size_t ssz_reader_needed(const ssz_reader_t *reader)
+{
+    if (reader->error != SSZ_SUCCESS || reader->complete)
+    {
+        return 0;
+    }
+    return reader->need - reader->buffered;
+}
+
+/**
+ * Returns whether the whole object has been decoded.
+ *
+ * @param reader Pointer to the reader.
+ * @return true once every byte of the object has been decoded without error.
+ */
+bool ssz_reader_complete(const ssz_reader_t *reader)
+{
+    return reader->error == SSZ_SUCCESS && reader->complete;
+}
+
+/**
+ * Announces that the current field needs size more bytes, decoded in one step.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Number of bytes.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_reader_expect(ssz_reader_t *reader, size_t size)
+{
+    if (size > reader->total_size - reader->position)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (size > reader->capacity)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    reader->need = size;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Announces a byte vector of size bytes that may be decoded in several steps.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Size of the vector in bytes.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION if size runs past the object.
+ */
+ssz_error_t ssz_reader_expect_bytes(ssz_reader_t *reader, size_t size)
+{
+    if (!reader->field_started)
+    {
+        if (size > reader->total_size - reader->position)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+        reader->field_started = true;
+        reader->field_variable = false;
+        reader->field_size = size;
+        reader->field_position = 0;
+    }
+    size_t remaining = reader->field_size - reader->field_position;
+    reader->need = remaining < reader->capacity ? remaining : reader->capacity;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Announces the next variable-size field, decoded in one step.
+ *
+ * @param reader Pointer to the reader.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_reader_expect_variable(ssz_reader_t *reader)
+{
+    size_t size = 0;
+    ssz_error_t err = reader_variable_size(reader, &size);
+    if (err != SSZ_SUCCESS)
+    {
+        return err;
+    }
+    reader->field_started = true;
+    reader->field_variable = true;
+    reader->field_size = size;
+    reader->field_position = 0;
+    return ssz_reader_expect(reader, size);
+}
+
+/**
+ * Announces the next variable-size field as a list of fixed-size elements, decoded in steps
+ * of as many whole elements as fit the staging buffer.
+ *
+ * @param reader Pointer to the reader.
+ * @param element_size Size of one element in bytes.
+ * @param max_length Maximum number of elements.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_reader_expect_elements(ssz_reader_t *reader, size_t element_size, size_t max_length)
+{
+    if (element_size == 0)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if (element_size > reader->capacity)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    if (!reader->field_started)
+    {
+        size_t size = 0;
+        ssz_error_t err = reader_variable_size(reader, &size);
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+        if (size % element_size != 0 || size / element_size > max_length)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+        reader->field_started = true;
+        reader->field_variable = true;
+        reader->field_size = size;
+        reader->field_position = 0;
+    }
+    size_t remaining = reader->field_size - reader->field_position;
+    size_t step = reader->capacity - reader->capacity % element_size;
+    reader->need = remaining < step ? remaining : step;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Stores an offset of the fixed part and moves on to the next field.
+ *
+ * @param reader Pointer to the reader.
+ * @param data Pointer to the 4 offset bytes.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if there are too many offsets.
+ */
+ssz_error_t ssz_reader_read_offset(ssz_reader_t *reader, const uint8_t *data)
+{
+    if (reader->offset_count == SSZ_READER_MAX_OFFSETS)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    reader->offsets[reader->offset_count++] = (uint32_t)data[0] | ((uint32_t)data[1] << 8) |
+                                              ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+    reader->stage++;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Reports that the current step decoded size bytes.
+ *
+ * @param reader Pointer to the reader.
+ * @param size Number of bytes decoded.
+ * @return SSZ_SUCCESS.
+ */
+ssz_error_t ssz_reader_consumed(ssz_reader_t *reader, size_t size)
+{
+    if (reader->field_started)
+    {
+        reader->field_position += size;
+        if (reader->field_position < reader->field_size)
+        {
+            return SSZ_SUCCESS;
+        }
+        reader->field_started = false;
+        if (reader->field_variable)
+        {
+            reader->variable_index++;
+        }
+    }
+    reader->stage++;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Marks the object as complete once the step function has no field left.
+ *
+ * @param reader Pointer to the reader.
+ * @return SSZ_SUCCESS if the object ends at total_size, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_reader_end(ssz_reader_t *reader)
+{
+    if (reader->position != reader->total_size || reader->variable_index != reader->offset_count)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    reader->complete = true;
+    return SSZ_SUCCESS;
+}
@@ -7,6 +7,7 @@
 #include "ssz_constants.h"
 #include "ssz_types.h"
 #include "ssz_utils.h"
+#include "ssz_bitfield.h"
 
 /**
  * Serializes an 8-bit unsigned integer into a single byte.
@@ -210,27 +211,7 @@ ssz_error_t ssz_serialize_bitvector(const bool *restrict bits, size_t num_bits,
     {
         return SSZ_ERROR_SERIALIZATION;
     }
-    const size_t full_bytes = num_bits / 8;
-    const size_t remainder_bits = num_bits % 8;
-    const bool *bit_ptr = bits;
-    uint8_t *out_ptr = out_buf;
-    for (size_t i = 0; i < full_bytes; ++i)
-    {
-        *out_ptr++ = (uint8_t)((bit_ptr[0] << 0) | (bit_ptr[1] << 1) |
-                               (bit_ptr[2] << 2) | (bit_ptr[3] << 3) |
-                               (bit_ptr[4] << 4) | (bit_ptr[5] << 5) |
-                               (bit_ptr[6] << 6) | (bit_ptr[7] << 7));
-        bit_ptr += 8;
-    }
-    if (remainder_bits > 0)
-    {
-        uint8_t value = 0;
-        for (size_t bit = 0; bit < remainder_bits; ++bit)
-        {
-            value |= (*bit_ptr++) << bit;
-        }
-        *out_ptr = value;
-    }
+    ssz_bits_pack(bits, num_bits, out_buf);
     *out_size = byte_count;
     return SSZ_SUCCESS;
 }
@@ -259,37 +240,12 @@ ssz_error_t ssz_serialize_bitlist(const bool *bits, size_t num_bits, uint8_t *ou
     }
     const size_t delimiter_byte = num_bits / 8;
     const size_t delimiter_bit = num_bits % 8;
-    const bool *bit_ptr = bits;
-    for (size_t j = 0; j < byte_count; j++)
+    if (delimiter_bit == 0)
     {
-        uint8_t byte = 0;
-        const size_t start = j * 8;
-        if (start + 8 <= num_bits)
-        {
-            byte |= (uint8_t)(*bit_ptr++) << 0;
-            byte |= (uint8_t)(*bit_ptr++) << 1;
-            byte |= (uint8_t)(*bit_ptr++) << 2;
-            byte |= (uint8_t)(*bit_ptr++) << 3;
-            byte |= (uint8_t)(*bit_ptr++) << 4;
-            byte |= (uint8_t)(*bit_ptr++) << 5;
-            byte |= (uint8_t)(*bit_ptr++) << 6;
-            byte |= (uint8_t)(*bit_ptr++) << 7;
-        }
-        else
-        {
-            for (size_t k = 0; k < 8; k++)
-            {
-                if (start + k >= num_bits)
-                    break;
-                byte |= (uint8_t)(*bit_ptr++) << k;
-            }
-        }
-        if (j == delimiter_byte)
-        {
-            byte |= (1 << delimiter_bit);
-        }
-        out_buf[j] = byte;
+        out_buf[delimiter_byte] = 0;
     }
+    ssz_bits_pack(bits, num_bits, out_buf);
+    out_buf[delimiter_byte] |= (uint8_t)(1 << delimiter_bit);
     *out_size = byte_count;
     return SSZ_SUCCESS;
 }
@@ -0,0 +1,355 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ssz_tree.h"
+#include "ssz_merkle.h"
+#include "ssz_hash.h"
+#include "ssz_utils.h"
+
+/**
+ * Returns the number of stored nodes at a level of a tree with chunk_count leaves.
+ */
+static size_t tree_level_nodes(size_t chunk_count, uint32_t level)
+{
+    if (chunk_count == 0)
+    {
+        return 0;
+    }
+    return level >= 64 ? 1 : ((chunk_count - 1) >> level) + 1;
+}
+
+/**
+ * Grows the storage of a level so that it can hold at least the given number of nodes.
+ */
+static ssz_error_t tree_reserve_level(ssz_tree_t *tree, uint32_t level, size_t nodes)
+{
+    if (nodes <= tree->capacities[level])
+    {
+        return SSZ_SUCCESS;
+    }
+    size_t capacity = tree->capacities[level] ? tree->capacities[level] : 1;
+    while (capacity < nodes)
+    {
+        capacity <<= 1;
+    }
+    uint8_t *grown = realloc(tree->levels[level], capacity * SSZ_BYTES_PER_CHUNK);
+    if (!grown)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    tree->levels[level] = grown;
+    tree->capacities[level] = capacity;
+    return SSZ_SUCCESS;
+}
+
+static int tree_compare_index(const void *a, const void *b)
+{
+    size_t x = *(const size_t *)a;
+    size_t y = *(const size_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Sorts the dirty leaf list and removes duplicate indices.
+ */
+static void tree_compact_dirty(ssz_tree_t *tree)
+{
+    if (tree->dirty_count < 2)
+    {
+        return;
+    }
+    qsort(tree->dirty, tree->dirty_count, sizeof(size_t), tree_compare_index);
+    size_t unique = 1;
+    for (size_t i = 1; i < tree->dirty_count; i++)
+    {
+        if (tree->dirty[i] != tree->dirty[unique - 1])
+        {
+            tree->dirty[unique++] = tree->dirty[i];
+        }
+    }
+    tree->dirty_count = unique;
+}
+
+/**
+ * Builds a cached hash tree over an array of chunks.
+ *
+ * @param tree Pointer to the tree to initialize.
+ * @param chunks Pointer to the array of chunks. May be NULL if chunk_count is 0.
+ * @param chunk_count Number of chunks provided.
+ * @param limit Maximum number of chunks allowed, or 0 for no limit.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_init(ssz_tree_t *tree, const uint8_t *chunks, size_t chunk_count, size_t limit)
+{
+    if (tree == NULL || (chunks == NULL && chunk_count != 0))
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    memset(tree, 0, sizeof(*tree));
+    if (limit != 0 && chunk_count > limit)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    tree->limit = limit;
+    if (chunk_count == 0)
+    {
+        return SSZ_SUCCESS;
+    }
+    uint32_t top = ceil_log2(chunk_count);
+    for (uint32_t level = 0; level <= top; level++)
+    {
+        if (tree_reserve_level(tree, level, tree_level_nodes(chunk_count, level)) != SSZ_SUCCESS)
+        {
+            ssz_tree_free(tree);
+            return SSZ_ERROR_MERKLEIZATION;
+        }
+    }
+    tree->chunk_count = chunk_count;
+    memcpy(tree->levels[0], chunks, chunk_count * SSZ_BYTES_PER_CHUNK);
+    uint8_t pair[2 * SSZ_BYTES_PER_CHUNK];
+    for (uint32_t level = 0; level < top; level++)
+    {
+        size_t nodes = tree_level_nodes(chunk_count, level);
+        ssz_hash_pairs(tree->levels[level], nodes >> 1, tree->levels[level + 1]);
+        if (nodes & 1)
+        {
+            memcpy(pair, tree->levels[level] + (nodes - 1) * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+            memcpy(pair + SSZ_BYTES_PER_CHUNK, zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+            ssz_sha256_64(pair, tree->levels[level + 1] + (nodes >> 1) * SSZ_BYTES_PER_CHUNK);
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Releases all memory owned by a cached hash tree.
+ *
+ * @param tree Pointer to the tree to release.
+ */
+void ssz_tree_free(ssz_tree_t *tree)
+{
+    if (tree == NULL)
+    {
+        return;
+    }
+    for (size_t level = 0; level <= SSZ_MAX_MERKLE_DEPTH; level++)
+    {
+        free(tree->levels[level]);
+    }
+    free(tree->dirty);
+    memset(tree, 0, sizeof(*tree));
+}
+
+/**
+ * Replaces or appends a leaf of a cached hash tree.
+ *
+ * Appending reserves room for the new node on every level of its path before the leaf count
+ * changes, so a failed allocation leaves the tree untouched.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param index Index of the leaf, at most the current chunk count.
+ * @param chunk Pointer to the new leaf value (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_set_chunk(ssz_tree_t *tree, size_t index, const uint8_t *chunk)
+{
+    if (tree == NULL || chunk == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    if (index > tree->chunk_count || (index == tree->chunk_count && tree->limit != 0 && index == tree->limit))
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    if (index == tree->chunk_count)
+    {
+        size_t grown = tree->chunk_count + 1;
+        uint32_t top = ceil_log2(grown);
+        for (uint32_t level = 0; level <= top; level++)
+        {
+            if (tree_reserve_level(tree, level, tree_level_nodes(grown, level)) != SSZ_SUCCESS)
+            {
+                return SSZ_ERROR_MERKLEIZATION;
+            }
+        }
+    }
+    if (tree->dirty_count == tree->dirty_capacity)
+    {
+        if (tree->dirty_capacity >= tree->chunk_count)
+        {
+            tree_compact_dirty(tree);
+        }
+        if (tree->dirty_count == tree->dirty_capacity)
+        {
+            size_t capacity = tree->dirty_capacity ? tree->dirty_capacity * 2 : 16;
+            size_t *grown = realloc(tree->dirty, capacity * sizeof(size_t));
+            if (!grown)
+            {
+                return SSZ_ERROR_MERKLEIZATION;
+            }
+            tree->dirty = grown;
+            tree->dirty_capacity = capacity;
+        }
+    }
+    if (index == tree->chunk_count)
+    {
+        tree->chunk_count++;
+    }
+    memcpy(tree->levels[0] + index * SSZ_BYTES_PER_CHUNK, chunk, SSZ_BYTES_PER_CHUNK);
+    tree->dirty[tree->dirty_count++] = index;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Computes the Merkle root of a cached hash tree.
+ *
+ * The sorted, deduplicated dirty indices are turned into parent indices one level at a time.
+ * Because the list stays sorted, siblings and shared ancestors collapse into a single entry.
+ * The child pairs of all parents of a level are gathered into one buffer and hashed with a
+ * single ssz_hash_pairs call before being scattered back into the level above.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param out_root Output buffer to write the resulting Merkle root (at least SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_root(ssz_tree_t *tree, uint8_t *out_root)
+{
+    if (tree == NULL || out_root == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    size_t count = tree->chunk_count;
+    uint32_t top = ceil_log2(count);
+    uint32_t depth = tree->limit != 0 ? ceil_log2(tree->limit) : top;
+    if (count == 0)
+    {
+        memcpy(out_root, zero_hashes[depth], SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    if (tree->dirty_count > 0)
+    {
+        tree_compact_dirty(tree);
+        size_t buffer_size = tree->dirty_count * 2 * SSZ_BYTES_PER_CHUNK;
+        uint8_t small_buf[SSZ_SMALL_BUFFER_SIZE];
+        uint8_t *pairs = buffer_size <= SSZ_SMALL_BUFFER_SIZE ? small_buf : malloc(buffer_size);
+        if (!pairs)
+        {
+            return SSZ_ERROR_MERKLEIZATION;
+        }
+        size_t *indices = tree->dirty;
+        size_t k = tree->dirty_count;
+        for (uint32_t level = 0; level < top; level++)
+        {
+            size_t nodes = tree_level_nodes(count, level);
+            const uint8_t *src = tree->levels[level];
+            size_t parents = 0;
+            for (size_t i = 0; i < k; i++)
+            {
+                size_t parent = indices[i] >> 1;
+                if (parents > 0 && indices[parents - 1] == parent)
+                {
+                    continue;
+                }
+                indices[parents] = parent;
+                uint8_t *dst = pairs + parents * 2 * SSZ_BYTES_PER_CHUNK;
+                memcpy(dst, src + 2 * parent * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+                if (2 * parent + 1 < nodes)
+                {
+                    memcpy(dst + SSZ_BYTES_PER_CHUNK, src + (2 * parent + 1) * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+                }
+                else
+                {
+                    memcpy(dst + SSZ_BYTES_PER_CHUNK, zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+                }
+                parents++;
+            }
+            ssz_hash_pairs(pairs, parents, pairs);
+            uint8_t *up = tree->levels[level + 1];
+            for (size_t i = 0; i < parents; i++)
+            {
+                memcpy(up + indices[i] * SSZ_BYTES_PER_CHUNK, pairs + i * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+            }
+            k = parents;
+        }
+        tree->dirty_count = 0;
+        if (pairs != small_buf)
+        {
+            free(pairs);
+        }
+    }
+    uint8_t node[2 * SSZ_BYTES_PER_CHUNK];
+    memcpy(node, tree->levels[top], SSZ_BYTES_PER_CHUNK);
+    for (uint32_t level = top; level < depth; level++)
+    {
+        memcpy(node + SSZ_BYTES_PER_CHUNK, zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+        ssz_sha256_64(node, node);
+    }
+    memcpy(out_root, node, SSZ_BYTES_PER_CHUNK);
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Returns the depth of a cached hash tree.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @return The depth implied by the limit, or by the chunk count when the limit is 0.
+ */
+uint32_t ssz_tree_depth(const ssz_tree_t *tree)
+{
+    return ceil_log2(tree->limit != 0 ? tree->limit : tree->chunk_count);
+}
+
+/**
+ * Reads a node of a cached hash tree by generalized index.
+ *
+ * Levels above the highest stored level hold a single non-padding node on their left edge,
+ * which is folded from the stored top node with zero subtree roots.
+ *
+ * @param tree Pointer to an initialized tree.
+ * @param gindex Generalized index of the node.
+ * @param out_node Output buffer to write the node (SSZ_BYTES_PER_CHUNK bytes).
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_tree_get_node(ssz_tree_t *tree, uint64_t gindex, uint8_t *out_node)
+{
+    if (tree == NULL || out_node == NULL)
+    {
+        return SSZ_ERROR_MERKLEIZATION;
+    }
+    uint32_t depth = ssz_tree_depth(tree);
+    uint32_t node_depth = 63 - (uint32_t)__builtin_clzll(gindex | 1);
+    if (gindex == 0 || node_depth > depth)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    if (tree->dirty_count > 0)
+    {
+        uint8_t root[SSZ_BYTES_PER_CHUNK];
+        ssz_error_t err = ssz_tree_root(tree, root);
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+    }
+    uint32_t level = depth - node_depth;
+    uint64_t index = gindex - ((uint64_t)1 << node_depth);
+    if (index >= tree_level_nodes(tree->chunk_count, level))
+    {
+        memcpy(out_node, zero_hashes[level], SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    uint32_t top = ceil_log2(tree->chunk_count);
+    if (level <= top)
+    {
+        memcpy(out_node, tree->levels[level] + index * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK);
+        return SSZ_SUCCESS;
+    }
+    uint8_t node[2 * SSZ_BYTES_PER_CHUNK];
+    memcpy(node, tree->levels[top], SSZ_BYTES_PER_CHUNK);
+    for (uint32_t l = top; l < level; l++)
+    {
+        memcpy(node + SSZ_BYTES_PER_CHUNK, zero_hashes[l], SSZ_BYTES_PER_CHUNK);
+        ssz_sha256_64(node, node);
+    }
+    memcpy(out_node, node, SSZ_BYTES_PER_CHUNK);
+    return SSZ_SUCCESS;
+}
@@ -4,6 +4,174 @@
 #include <stdbool.h>
 #include "ssz_utils.h"
 #include "ssz_constants.h"
+#include "ssz_hash.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SSZ_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+#define SCAN_HIGH_BITS 0xFEFEFEFEFEFEFEFEULL
+#define SCAN_BLOCK_SIZE 512
+
+typedef uint64_t (*scan_or_fold_fn)(const uint8_t *ptr, size_t len);
+typedef bool (*scan_last_bit_fn)(const uint8_t *ptr, size_t len, size_t *out_bit);
+
+/**
+ * Loads eight bytes as a little-endian word.
+ */
+static inline uint64_t load_le64(const uint8_t *ptr)
+{
+    uint64_t w;
+    memcpy(&w, ptr, sizeof(w));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    w = __builtin_bswap64(w);
+#endif
+    return w;
+}
+
+/**
+ * ORs every byte of the region into the byte lane (offset % 8) of a 64-bit word.
+ *
+ * The region is all zeros when the result is zero, and holds only 0/1 bytes when the result
+ * has no bit outside the low bit of each lane. Four independent accumulators keep the loop
+ * free of a serial dependency so the compiler can vectorize it.
+ */
+static uint64_t or_fold_word(const uint8_t *ptr, size_t len)
+{
+    uint64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32)
+    {
+        a0 |= load_le64(ptr + i);
+        a1 |= load_le64(ptr + i + 8);
+        a2 |= load_le64(ptr + i + 16);
+        a3 |= load_le64(ptr + i + 24);
+    }
+    for (; i + 8 <= len; i += 8)
+    {
+        a0 |= load_le64(ptr + i);
+    }
+    for (; i < len; i++)
+    {
+        a1 |= ptr[i];
+    }
+    return a0 | a1 | a2 | a3;
+}
+
+/**
+ * Scans backward a word at a time for the highest set bit.
+ */
+static bool last_set_bit_word(const uint8_t *ptr, size_t len, size_t *out_bit)
+{
+    size_t end = len;
+    for (; end >= 8; end -= 8)
+    {
+        uint64_t w = load_le64(ptr + end - 8);
+        if (w != 0)
+        {
+            *out_bit = (end - 8) * SSZ_BITS_PER_BYTE + 63 - (size_t)__builtin_clzll(w);
+            return true;
+        }
+    }
+    for (; end > 0; end--)
+    {
+        if (ptr[end - 1] != 0)
+        {
+            *out_bit = (end - 1) * SSZ_BITS_PER_BYTE + 31 - (size_t)__builtin_clz(ptr[end - 1]);
+            return true;
+        }
+    }
+    return false;
+}
+
+#ifdef SSZ_SCAN_X86
+/**
+ * AVX2 variant of or_fold_word: 128 bytes per iteration into four vector accumulators,
+ * folded down to the same 64-bit lane layout at the end.
+ */
+__attribute__((target("avx2")))
+static uint64_t or_fold_avx2(const uint8_t *ptr, size_t len)
+{
+    __m256i a0 = _mm256_setzero_si256(), a1 = a0, a2 = a0, a3 = a0;
+    size_t i = 0;
+    for (; i + 128 <= len; i += 128)
+    {
+        a0 = _mm256_or_si256(a0, _mm256_loadu_si256((const __m256i *)(ptr + i)));
+        a1 = _mm256_or_si256(a1, _mm256_loadu_si256((const __m256i *)(ptr + i + 32)));
+        a2 = _mm256_or_si256(a2, _mm256_loadu_si256((const __m256i *)(ptr + i + 64)));
+        a3 = _mm256_or_si256(a3, _mm256_loadu_si256((const __m256i *)(ptr + i + 96)));
+    }
+    for (; i + 32 <= len; i += 32)
+    {
+        a0 = _mm256_or_si256(a0, _mm256_loadu_si256((const __m256i *)(ptr + i)));
+    }
+    __m256i acc = _mm256_or_si256(_mm256_or_si256(a0, a1), _mm256_or_si256(a2, a3));
+    __m128i half = _mm_or_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    uint64_t folded = (uint64_t)_mm_cvtsi128_si64(half) | (uint64_t)_mm_extract_epi64(half, 1);
+    return folded | or_fold_word(ptr + i, len - i);
+}
+
+/**
+ * AVX2 variant of last_set_bit_word: skips 32 zero bytes per step, then uses the byte mask of
+ * the first non-zero block and lzcnt to locate the bit.
+ */
+__attribute__((target("avx2,lzcnt")))
+static bool last_set_bit_avx2(const uint8_t *ptr, size_t len, size_t *out_bit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t end = len;
+    for (; end >= 32; end -= 32)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(ptr + end - 32));
+        uint32_t nonzero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero));
+        if (nonzero != 0)
+        {
+            size_t byte = end - 32 + 31 - (size_t)_lzcnt_u32(nonzero);
+            *out_bit = byte * SSZ_BITS_PER_BYTE + 31 - (size_t)_lzcnt_u32(ptr[byte]);
+            return true;
+        }
+    }
+    return last_set_bit_word(ptr, end, out_bit);
+}
+#endif
+
+static scan_or_fold_fn or_fold_impl = or_fold_word;
+static scan_last_bit_fn last_set_bit_impl = last_set_bit_word;
+static const char *scan_impl_name = "word";
+
+#ifdef SSZ_SCAN_X86
+/**
+ * Picks the AVX2 scanning kernels once, before main runs, when the CPU supports them.
+ */
+__attribute__((constructor))
+static void scan_select(void)
+{
+    ssz_cpu_features_t features;
+    ssz_cpu_detect(&features);
+    if (features.avx2 && features.lzcnt)
+    {
+        or_fold_impl = or_fold_avx2;
+        last_set_bit_impl = last_set_bit_avx2;
+        scan_impl_name = "avx2";
+    }
+}
+#endif
+
+/**
+ * Folds the region block by block, stopping as soon as the result has a bit in stop_mask so
+ * that malformed input is rejected without reading the rest of it.
+ */
+static uint64_t or_fold_until(const uint8_t *ptr, size_t len, uint64_t stop_mask)
+{
+    uint64_t acc = 0;
+    for (size_t i = 0; i < len && (acc & stop_mask) == 0; i += SCAN_BLOCK_SIZE)
+    {
+        size_t n = len - i < SCAN_BLOCK_SIZE ? len - i : SCAN_BLOCK_SIZE;
+        acc |= or_fold_impl(ptr + i, n);
+    }
+    return acc;
+}
 
 /**
  * Checks if the given memory region is filled with zeros.
@@ -14,14 +182,42 @@
  */
 bool is_zero(const uint8_t *ptr, size_t len)
 {
-    for (size_t j = 0; j < len; ++j) 
-    {
-        if (ptr[j] != 0)
-        {
-            return false;
-        }
-    }
-    return true;
+    return or_fold_until(ptr, len, ~(uint64_t)0) == 0;
+}
+
+/**
+ * Checks if every byte of the given memory region is 0x00 or 0x01.
+ *
+ * @param ptr Pointer to the memory region.
+ * @param len The length of the memory region in bytes.
+ * @return true if all bytes are 0 or 1, otherwise false.
+ */
+bool is_boolean_bytes(const uint8_t *ptr, size_t len)
+{
+    return (or_fold_until(ptr, len, SCAN_HIGH_BITS) & SCAN_HIGH_BITS) == 0;
+}
+
+/**
+ * Finds the highest set bit of a little-endian bit array.
+ *
+ * @param ptr Pointer to the memory region.
+ * @param len The length of the memory region in bytes.
+ * @param out_bit Set to the index of the highest set bit when one exists.
+ * @return true if a set bit was found, false if the region is all zeros.
+ */
+bool find_last_set_bit(const uint8_t *ptr, size_t len, size_t *out_bit)
+{
+    return last_set_bit_impl(ptr, len, out_bit);
+}
+
+/**
+ * Returns the name of the selected scanning backend.
+ *
+ * @return A static string.
+ */
+const char *ssz_scan_backend(void)
+{
+    return scan_impl_name;
 }
 
 /**
@@ -48,6 +244,22 @@ uint64_t next_pow_of_two(uint64_t value)
     return p;
 }
 
+/**
+ * Computes the base-2 logarithm of the given value, rounded up.
+ *
+ * @param value The input value.
+ * @return The smallest d such that 2^d >= value, or 0 if value is 0 or 1.
+ */
+uint32_t ceil_log2(uint64_t value)
+{
+    uint32_t depth = 0;
+    while (depth < 64 && (1ULL << depth) < value)
+    {
+        depth++;
+    }
+    return depth;
+}
+
 /**
  * Validates whether the provided offset is within the maximum allowed SSZ offset range.
  *
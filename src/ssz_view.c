@@ -0,0 +1,186 @@
+#include "ssz_view.h"
+#include "ssz_utils.h"
+
+/**
+ * Returns the sub-view of a variable-size field from its offset and the next field's offset.
+ *
+ * @param view Pointer to the container view.
+ * @param position Byte position of the field's offset.
+ * @param next_position Byte position of the next variable field's offset, or SSZ_VIEW_END.
+ * @param out Output sub-view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION on invalid offsets.
+ */
+ssz_error_t ssz_view_variable(const ssz_view_t *view, size_t position, size_t next_position, ssz_view_t *out)
+{
+    if (position > view->size || view->size - position < SSZ_BYTES_PER_LENGTH_OFFSET)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    size_t start = ssz_view_uint32(view, position);
+    size_t end = view->size;
+    if (next_position != SSZ_VIEW_END)
+    {
+        if (next_position > view->size || view->size - next_position < SSZ_BYTES_PER_LENGTH_OFFSET)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+        end = ssz_view_uint32(view, next_position);
+    }
+    if (start > end || end > view->size)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    out->data = view->data + start;
+    out->size = end - start;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Checks that a view holds a list of fixed-size elements.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param max_length Maximum number of elements.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_list(const ssz_view_t *list, size_t element_size, size_t max_length)
+{
+    if (element_size == 0 || list->size % element_size != 0 || list->size / element_size > max_length)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Checks that a view holds a list of fixed-size containers and validates every element.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param max_length Maximum number of elements.
+ * @param element_view Function that validates one element.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_container_list(const ssz_view_t *list, size_t element_size, size_t max_length,
+                                          ssz_view_fn element_view)
+{
+    if (ssz_view_check_list(list, element_size, max_length) != SSZ_SUCCESS)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    for (size_t position = 0; position < list->size; position += element_size)
+    {
+        ssz_view_t element;
+        if (element_view(list->data + position, element_size, &element) != SSZ_SUCCESS)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Checks that a view holds a bitlist with a delimiter bit and at most max_bits bits.
+ *
+ * @param list Pointer to the bitlist view.
+ * @param max_bits Maximum number of bits.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_bitlist(const ssz_view_t *list, size_t max_bits)
+{
+    size_t delimiter = 0;
+    if (list->size == 0 || !find_last_set_bit(list->data + list->size - 1, 1, &delimiter))
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    if ((list->size - 1) * SSZ_BITS_PER_BYTE + delimiter > max_bits)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Checks the offset table of a list of variable-size elements and optionally every element.
+ *
+ * @param list Pointer to the list view.
+ * @param max_length Maximum number of elements.
+ * @param element_view Function that validates one element, or NULL.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_DESERIALIZATION otherwise.
+ */
+ssz_error_t ssz_view_check_variable_list(const ssz_view_t *list, size_t max_length, ssz_view_fn element_view)
+{
+    if (list->size == 0)
+    {
+        return SSZ_SUCCESS;
+    }
+    if (list->size < SSZ_BYTES_PER_LENGTH_OFFSET)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    size_t first = ssz_view_uint32(list, 0);
+    if (first == 0 || first % SSZ_BYTES_PER_LENGTH_OFFSET != 0 || first > list->size ||
+        first / SSZ_BYTES_PER_LENGTH_OFFSET > max_length)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
+    size_t count = first / SSZ_BYTES_PER_LENGTH_OFFSET;
+    size_t start = first;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t end = i + 1 < count ? ssz_view_uint32(list, (i + 1) * SSZ_BYTES_PER_LENGTH_OFFSET) : list->size;
+        if (end < start || end > list->size)
+        {
+            return SSZ_ERROR_DESERIALIZATION;
+        }
+        if (element_view != NULL)
+        {
+            ssz_view_t element;
+            if (element_view(list->data + start, end - start, &element) != SSZ_SUCCESS)
+            {
+                return SSZ_ERROR_DESERIALIZATION;
+            }
+        }
+        start = end;
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Returns a view of one element of a list of fixed-size elements.
+ *
+ * @param list Pointer to the list view.
+ * @param element_size Size of each element in bytes.
+ * @param index Index of the element.
+ * @param out Output element view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if index is past the end.
+ */
+ssz_error_t ssz_view_list_element(const ssz_view_t *list, size_t element_size, size_t index, ssz_view_t *out)
+{
+    if (element_size == 0 || index >= list->size / element_size)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    out->data = list->data + index * element_size;
+    out->size = element_size;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Returns a view of one element of a list of variable-size elements.
+ *
+ * @param list Pointer to a list view checked with ssz_view_check_variable_list.
+ * @param index Index of the element.
+ * @param out Output element view.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_OUT_OF_RANGE if index is past the end.
+ */
+ssz_error_t ssz_view_variable_list_element(const ssz_view_t *list, size_t index, ssz_view_t *out)
+{
+    size_t count = ssz_view_variable_list_length(list);
+    if (index >= count)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    size_t position = index * SSZ_BYTES_PER_LENGTH_OFFSET;
+    return ssz_view_variable(list, position, index + 1 < count ? position + SSZ_BYTES_PER_LENGTH_OFFSET : SSZ_VIEW_END, out);
+}
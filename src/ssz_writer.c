@@ -0,0 +1,346 @@
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+#include "ssz_writer.h"
+#include "ssz_constants.h"
+
+#define SSZ_WRITER_MIN_STAGING 64
+#define SSZ_WRITER_MIN_IOV 3
+
+/**
+ * Records the first error of a writer and returns it.
+ */
+static ssz_error_t writer_fail(ssz_writer_t *writer, ssz_error_t err)
+{
+    if (writer->error == SSZ_SUCCESS)
+    {
+        writer->error = err;
+    }
+    return writer->error;
+}
+
+/**
+ * Initializes a writer over a staging buffer and a sink.
+ *
+ * @param writer Pointer to the writer to initialize.
+ * @param staging Staging buffer owned by the caller.
+ * @param staging_size Size of the staging buffer in bytes.
+ * @param sink Function that consumes staged bytes.
+ * @param ctx Context pointer passed to the sink.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION on invalid arguments.
+ */
+ssz_error_t ssz_writer_init(ssz_writer_t *writer, uint8_t *staging, size_t staging_size, ssz_sink_fn sink, void *ctx)
+{
+    if (writer == NULL || staging == NULL || sink == NULL || staging_size < SSZ_WRITER_MIN_STAGING)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    memset(writer, 0, sizeof(*writer));
+    writer->sink = sink;
+    writer->ctx = ctx;
+    writer->buf = staging;
+    writer->capacity = staging_size;
+    writer->error = SSZ_SUCCESS;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Initializes a writer in iovec mode.
+ *
+ * @param writer Pointer to the writer to initialize.
+ * @param scratch Scratch buffer for small encoded values.
+ * @param scratch_size Size of the scratch buffer in bytes.
+ * @param iov Array that collects the pending iovec entries.
+ * @param iov_capacity Number of entries in iov.
+ * @param zero_copy_min Smallest write that is referenced in place.
+ * @param sink Function that consumes iovec batches.
+ * @param ctx Context pointer passed to the sink.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION on invalid arguments.
+ */
+ssz_error_t ssz_writer_init_iov(ssz_writer_t *writer, uint8_t *scratch, size_t scratch_size, ssz_iovec_t *iov,
+                                size_t iov_capacity, size_t zero_copy_min, ssz_iov_sink_fn sink, void *ctx)
+{
+    if (writer == NULL || scratch == NULL || iov == NULL || sink == NULL ||
+        scratch_size < SSZ_WRITER_MIN_STAGING || iov_capacity < SSZ_WRITER_MIN_IOV || zero_copy_min == 0)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    memset(writer, 0, sizeof(*writer));
+    writer->iov_sink = sink;
+    writer->ctx = ctx;
+    writer->buf = scratch;
+    writer->capacity = scratch_size;
+    writer->iov = iov;
+    writer->iov_capacity = iov_capacity;
+    writer->zero_copy_min = zero_copy_min;
+    writer->error = SSZ_SUCCESS;
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Turns the staged bytes that are not yet covered by an iovec entry into one.
+ */
+static void writer_close_segment(ssz_writer_t *writer)
+{
+    if (writer->used > writer->segment_start)
+    {
+        writer->iov[writer->iov_count].base = writer->buf + writer->segment_start;
+        writer->iov[writer->iov_count].len = writer->used - writer->segment_start;
+        writer->iov_count++;
+        writer->segment_start = writer->used;
+    }
+}
+
+/**
+ * Hands all staged bytes to the sink.
+ *
+ * @param writer Pointer to the writer.
+ * @return SSZ_SUCCESS on success, or the first error reported by the sink.
+ */
+ssz_error_t ssz_writer_flush(ssz_writer_t *writer)
+{
+    if (writer->error != SSZ_SUCCESS)
+    {
+        return writer->error;
+    }
+    if (writer->iov_sink != NULL)
+    {
+        writer_close_segment(writer);
+        if (writer->iov_count > 0)
+        {
+            ssz_error_t err = writer->iov_sink(writer->ctx, writer->iov, writer->iov_count);
+            if (err != SSZ_SUCCESS)
+            {
+                return writer_fail(writer, err);
+            }
+        }
+        writer->flushed += writer->used + writer->referenced;
+        writer->used = 0;
+        writer->segment_start = 0;
+        writer->iov_count = 0;
+        writer->referenced = 0;
+    }
+    else if (writer->used > 0)
+    {
+        ssz_error_t err = writer->sink(writer->ctx, writer->buf, writer->used);
+        if (err != SSZ_SUCCESS)
+        {
+            return writer_fail(writer, err);
+        }
+        writer->flushed += writer->used;
+        writer->used = 0;
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Appends bytes to the output, staging small writes and passing large ones through
+ * (or referencing them in place in iovec mode).
+ *
+ * @param writer Pointer to the writer.
+ * @param data Pointer to the bytes to append.
+ * @param len Number of bytes.
+ * @return SSZ_SUCCESS on success, or the first error reported by the sink.
+ */
+ssz_error_t ssz_writer_write(ssz_writer_t *writer, const void *data, size_t len)
+{
+    const uint8_t *src = data;
+    if (writer->error != SSZ_SUCCESS)
+    {
+        return writer->error;
+    }
+    if (src == NULL && len != 0)
+    {
+        return writer_fail(writer, SSZ_ERROR_SERIALIZATION);
+    }
+    if (writer->iov_sink != NULL && len >= writer->zero_copy_min)
+    {
+        /* The staged segment before the reference, the reference and the staged segment after it. */
+        if (writer->iov_count + 3 > writer->iov_capacity && ssz_writer_flush(writer) != SSZ_SUCCESS)
+        {
+            return writer->error;
+        }
+        writer_close_segment(writer);
+        writer->iov[writer->iov_count].base = (void *)src;
+        writer->iov[writer->iov_count].len = len;
+        writer->iov_count++;
+        writer->referenced += len;
+        return SSZ_SUCCESS;
+    }
+    while (len > 0)
+    {
+        if (writer->iov_sink == NULL && writer->used == 0 && len >= writer->capacity)
+        {
+            size_t n = len - len % writer->capacity;
+            ssz_error_t err = writer->sink(writer->ctx, src, n);
+            if (err != SSZ_SUCCESS)
+            {
+                return writer_fail(writer, err);
+            }
+            writer->flushed += n;
+            src += n;
+            len -= n;
+            continue;
+        }
+        if (writer->iov_sink != NULL && writer->iov_count == writer->iov_capacity &&
+            ssz_writer_flush(writer) != SSZ_SUCCESS)
+        {
+            return writer->error;
+        }
+        size_t room = writer->capacity - writer->used;
+        size_t n = len < room ? len : room;
+        memcpy(writer->buf + writer->used, src, n);
+        writer->used += n;
+        src += n;
+        len -= n;
+        if (writer->used == writer->capacity)
+        {
+            ssz_error_t err = ssz_writer_flush(writer);
+            if (err != SSZ_SUCCESS)
+            {
+                return err;
+            }
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Reserves len contiguous bytes of staging space at the current position.
+ *
+ * @param writer Pointer to the writer.
+ * @param len Number of bytes to reserve.
+ * @return Pointer to the reserved bytes, or NULL on error.
+ */
+uint8_t *ssz_writer_reserve(ssz_writer_t *writer, size_t len)
+{
+    if (writer->error != SSZ_SUCCESS)
+    {
+        return NULL;
+    }
+    if (len > writer->capacity)
+    {
+        writer_fail(writer, SSZ_ERROR_SERIALIZATION);
+        return NULL;
+    }
+    if ((len > writer->capacity - writer->used ||
+         (writer->iov_sink != NULL && writer->iov_count == writer->iov_capacity)) &&
+        ssz_writer_flush(writer) != SSZ_SUCCESS)
+    {
+        return NULL;
+    }
+    uint8_t *out = writer->buf + writer->used;
+    writer->used += len;
+    return out;
+}
+
+/**
+ * Appends a 4-byte little-endian offset.
+ *
+ * The offset is encoded straight into staging space, so it is never referenced in place.
+ *
+ * @param writer Pointer to the writer.
+ * @param offset Offset value.
+ * @return SSZ_SUCCESS on success, or an error code on failure.
+ */
+ssz_error_t ssz_writer_write_offset(ssz_writer_t *writer, uint64_t offset)
+{
+    if (offset > UINT32_MAX)
+    {
+        return writer_fail(writer, SSZ_ERROR_SERIALIZATION);
+    }
+    uint8_t *out = ssz_writer_reserve(writer, SSZ_BYTES_PER_LENGTH_OFFSET);
+    if (out == NULL)
+    {
+        return writer->error;
+    }
+    out[0] = (uint8_t)offset;
+    out[1] = (uint8_t)(offset >> 8);
+    out[2] = (uint8_t)(offset >> 16);
+    out[3] = (uint8_t)(offset >> 24);
+    return SSZ_SUCCESS;
+}
+
+/**
+ * Returns the total number of bytes written so far.
+ *
+ * @param writer Pointer to the writer.
+ * @return The current output position.
+ */
+uint64_t ssz_writer_position(const ssz_writer_t *writer)
+{
+    return writer->flushed + writer->used + writer->referenced;
+}
+
+#ifndef _WIN32
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+_Static_assert(sizeof(ssz_iovec_t) == sizeof(struct iovec) &&
+                   offsetof(ssz_iovec_t, base) == offsetof(struct iovec, iov_base) &&
+                   offsetof(ssz_iovec_t, len) == offsetof(struct iovec, iov_len),
+               "ssz_iovec_t must match struct iovec");
+
+/**
+ * Writes an iovec batch to a file descriptor with writev.
+ *
+ * @param ctx Pointer to an int holding the file descriptor.
+ * @param iov Pointer to the iovec entries.
+ * @param iov_count Number of entries.
+ * @return SSZ_SUCCESS on success, or SSZ_ERROR_SERIALIZATION if writev fails.
+ */
+ssz_error_t ssz_writev_fd_sink(void *ctx, const ssz_iovec_t *iov, size_t iov_count)
+{
+    int fd = *(const int *)ctx;
+    size_t i = 0;
+    size_t done = 0;
+    while (i < iov_count)
+    {
+        if (done == iov[i].len)
+        {
+            i++;
+            done = 0;
+            continue;
+        }
+        ssize_t n;
+        if (done > 0)
+        {
+            struct iovec rest = {(uint8_t *)iov[i].base + done, iov[i].len - done};
+            n = writev(fd, &rest, 1);
+        }
+        else
+        {
+            size_t batch = iov_count - i < IOV_MAX ? iov_count - i : IOV_MAX;
+            n = writev(fd, (const struct iovec *)(iov + i), (int)batch);
+        }
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return SSZ_ERROR_SERIALIZATION;
+        }
+        size_t left = (size_t)n;
+        while (left > 0)
+        {
+            size_t avail = iov[i].len - done;
+            if (left < avail)
+            {
+                done += left;
+                break;
+            }
+            left -= avail;
+            i++;
+            done = 0;
+        }
+    }
+    return SSZ_SUCCESS;
+}
+#endif
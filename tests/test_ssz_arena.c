@@ -0,0 +1,105 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "ssz_arena.h"
+
+static void test_arena_alloc(void)
+{
+    printf("\n--- Testing ssz_arena_alloc ---\n");
+    printf("Testing alignment and non-overlap of mixed allocation sizes...\n");
+    {
+        static const size_t sizes[] = {1, 7, 16, 33, 200, 1000, 3, 5000, 0, 64};
+        uint8_t *ptrs[sizeof(sizes) / sizeof(sizes[0])];
+        ssz_arena_t arena;
+        bool ok = true;
+        ssz_arena_init(&arena, 1024);
+        for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            ptrs[i] = ssz_arena_alloc(&arena, sizes[i]);
+            ok = ok && ptrs[i] != NULL && ((uintptr_t)ptrs[i] % 16) == 0;
+            if (ok)
+            {
+                memset(ptrs[i], (int)i, sizes[i]);
+            }
+        }
+        for (size_t i = 0; ok && i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            for (size_t j = 0; j < sizes[i]; j++)
+            {
+                ok = ok && ptrs[i][j] == (uint8_t)i;
+            }
+        }
+        if (ok)
+        {
+            printf("  OK: Allocations are aligned and keep their contents.\n");
+        }
+        else
+        {
+            printf("  FAIL: Allocations are misaligned or overlap.\n");
+        }
+        ssz_arena_free(&arena);
+    }
+
+    printf("Testing that a NULL arena falls back to malloc...\n");
+    {
+        void *ptr = ssz_arena_alloc(NULL, 100);
+        if (ptr != NULL)
+        {
+            printf("  OK: malloc fallback returned memory.\n");
+        }
+        else
+        {
+            printf("  FAIL: malloc fallback returned NULL.\n");
+        }
+        ssz_arena_release(NULL, ptr);
+    }
+}
+
+static void test_arena_reset(void)
+{
+    printf("\n--- Testing ssz_arena_reset and ssz_arena_free ---\n");
+    printf("Testing that reset reuses blocks without growing...\n");
+    {
+        ssz_arena_t arena;
+        bool ok = true;
+        size_t capacity = 0;
+        uint8_t *first = NULL;
+        ssz_arena_init(&arena, 256);
+        for (int round = 0; ok && round < 3; round++)
+        {
+            ssz_arena_reset(&arena);
+            uint8_t *p = ssz_arena_alloc(&arena, 100);
+            for (int i = 0; ok && i < 20; i++)
+            {
+                ok = ssz_arena_alloc(&arena, 50 + (size_t)i * 10) != NULL;
+            }
+            if (round == 0)
+            {
+                first = p;
+                capacity = ssz_arena_capacity(&arena);
+            }
+            ok = ok && p == first && ssz_arena_capacity(&arena) == capacity;
+        }
+        ssz_arena_free(&arena);
+        ok = ok && ssz_arena_capacity(&arena) == 0 && ssz_arena_alloc(&arena, 10) != NULL;
+        ssz_arena_free(&arena);
+        if (ok)
+        {
+            printf("  OK: Capacity stays at %zu bytes across resets.\n", capacity);
+        }
+        else
+        {
+            printf("  FAIL: Arena grew or moved after reset.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_arena_alloc();
+    test_arena_reset();
+
+    return 0;
+}
@@ -0,0 +1,297 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "ssz_bitfield.h"
+#include "ssz_serialize.h"
+#include "ssz_deserialize.h"
+#include "ssz_merkle.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+#define MAX_BITS 2048
+
+static bool pattern_bit(size_t i)
+{
+    return ((i * 7) % 5) < 2;
+}
+
+static void test_bitlist_matches_bool_api(void)
+{
+    printf("\n--- Testing ssz_bitlist_t against the bool API ---\n");
+    printf("Testing serialization, deserialization and roots for many lengths...\n");
+    {
+        static bool bits[MAX_BITS];
+        static uint8_t expected[MAX_BITS / 8 + 1];
+        static uint8_t out[MAX_BITS / 8 + 1];
+        static const size_t lengths[] = {0, 1, 7, 8, 9, 63, 64, 65, 255, 256, 257, 1000, 2047, 2048};
+        size_t mismatches = 0;
+        ssz_bitlist_t list;
+        ssz_bitlist_t decoded;
+        ssz_bitlist_init(&list, MAX_BITS);
+        ssz_bitlist_init(&decoded, MAX_BITS);
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            size_t n = lengths[l];
+            memset(list.words, 0, SSZ_BITFIELD_WORDS(MAX_BITS) * sizeof(uint64_t));
+            for (size_t i = 0; i < n; i++)
+            {
+                bits[i] = pattern_bit(i);
+                ssz_bitfield_set(list.words, i, bits[i]);
+            }
+            list.length = n;
+            size_t expected_size = sizeof(expected);
+            size_t out_size = sizeof(out);
+            uint8_t expected_root[32];
+            uint8_t root[32];
+            ssz_serialize_bitlist(bits, n, expected, &expected_size);
+            ssz_merkleize_bits(bits, n, MAX_BITS / 256, expected_root);
+            ssz_mix_in_length(expected_root, n, expected_root);
+            bool ok = ssz_bitlist_serialize(&list, out, &out_size) == SSZ_SUCCESS && out_size == expected_size &&
+                      memcmp(out, expected, out_size) == 0;
+            ok = ok && ssz_bitlist_deserialize(out, out_size, MAX_BITS, &decoded) == SSZ_SUCCESS &&
+                 decoded.length == n;
+            for (size_t i = 0; ok && i < n; i++)
+            {
+                ok = ssz_bitfield_get(decoded.words, i) == bits[i];
+            }
+            ok = ok && ssz_bitlist_hash_tree_root(&decoded, MAX_BITS, root) == SSZ_SUCCESS &&
+                 memcmp(root, expected_root, 32) == 0;
+            if (!ok)
+            {
+                mismatches++;
+            }
+        }
+        ssz_bitlist_free(&list);
+        ssz_bitlist_free(&decoded);
+        if (mismatches == 0)
+        {
+            printf("  OK: All lengths match the bool API.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu lengths differ from the bool API.\n", mismatches);
+        }
+    }
+
+    printf("Testing malformed bitlists...\n");
+    {
+        static const uint8_t no_delimiter[] = {0x05, 0x00};
+        static const uint8_t too_long[] = {0xFF, 0x02};
+        ssz_bitlist_t list;
+        ssz_bitlist_init(&list, 16);
+        bool ok = ssz_bitlist_deserialize(no_delimiter, sizeof(no_delimiter), 16, &list) != SSZ_SUCCESS &&
+                  ssz_bitlist_deserialize(too_long, sizeof(too_long), 8, &list) != SSZ_SUCCESS &&
+                  ssz_bitlist_deserialize(too_long, sizeof(too_long), 9, &list) == SSZ_SUCCESS && list.length == 9;
+        ssz_bitlist_free(&list);
+        if (ok)
+        {
+            printf("  OK: Malformed bitlists rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Malformed bitlists were not handled correctly.\n");
+        }
+    }
+}
+
+static void test_bitvector_matches_bool_api(void)
+{
+    printf("\n--- Testing ssz_bitvector_t against the bool API ---\n");
+    printf("Testing serialization, deserialization and roots for many lengths...\n");
+    {
+        static bool bits[MAX_BITS];
+        static uint64_t words[SSZ_BITFIELD_WORDS(MAX_BITS)];
+        static uint64_t decoded_words[SSZ_BITFIELD_WORDS(MAX_BITS)];
+        static uint8_t expected[MAX_BITS / 8];
+        static uint8_t out[MAX_BITS / 8];
+        static const size_t lengths[] = {1, 4, 8, 9, 64, 65, 256, 257, 513, 2048};
+        size_t mismatches = 0;
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            size_t n = lengths[l];
+            ssz_bitvector_t vec = {words, n};
+            ssz_bitvector_t decoded = {decoded_words, n};
+            memset(words, 0, sizeof(words));
+            for (size_t i = 0; i < n; i++)
+            {
+                bits[i] = !pattern_bit(i);
+                ssz_bitfield_set(words, i, bits[i]);
+            }
+            size_t expected_size = sizeof(expected);
+            size_t out_size = sizeof(out);
+            uint8_t expected_root[32];
+            uint8_t root[32];
+            ssz_serialize_bitvector(bits, n, expected, &expected_size);
+            ssz_merkleize_bits(bits, n, (n + 255) / 256, expected_root);
+            bool ok = ssz_bitvector_serialize(&vec, out, &out_size) == SSZ_SUCCESS && out_size == expected_size &&
+                      memcmp(out, expected, out_size) == 0 &&
+                      ssz_bitvector_deserialize(out, out_size, &decoded) == SSZ_SUCCESS &&
+                      memcmp(decoded_words, words, SSZ_BITFIELD_WORDS(n) * sizeof(uint64_t)) == 0 &&
+                      ssz_bitvector_hash_tree_root(&decoded, root) == SSZ_SUCCESS &&
+                      memcmp(root, expected_root, 32) == 0;
+            if (!ok)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All lengths match the bool API.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu lengths differ from the bool API.\n", mismatches);
+        }
+    }
+
+    printf("Testing a bitvector with set padding bits...\n");
+    {
+        static const uint8_t padded[] = {0xF0};
+        uint64_t word = 0;
+        ssz_bitvector_t vec = {&word, 4};
+        if (ssz_bitvector_deserialize(padded, sizeof(padded), &vec) != SSZ_SUCCESS)
+        {
+            printf("  OK: Padding bits rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Padding bits were accepted.\n");
+        }
+    }
+}
+
+static void test_roots_ignore_stray_bits(void)
+{
+    printf("\n--- Testing bitfield roots with bits set past the length ---\n");
+    printf("Testing bitvector and bitlist roots over all-ones words...\n");
+    {
+        static bool bits[MAX_BITS];
+        static uint64_t words[SSZ_BITFIELD_WORDS(MAX_BITS)];
+        static const size_t lengths[] = {1, 4, 9, 63, 255, 257, 1000, 2047};
+        size_t mismatches = 0;
+        memset(words, 0xFF, sizeof(words));
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+        {
+            size_t n = lengths[l];
+            ssz_bitvector_t vec = {words, n};
+            ssz_bitlist_t list = {words, n};
+            uint8_t expected_root[32];
+            uint8_t root[32];
+            for (size_t i = 0; i < n; i++)
+            {
+                bits[i] = true;
+            }
+            ssz_merkleize_bits(bits, n, (n + 255) / 256, expected_root);
+            bool ok = ssz_bitvector_hash_tree_root(&vec, root) == SSZ_SUCCESS && memcmp(root, expected_root, 32) == 0;
+            ssz_merkleize_bits(bits, n, MAX_BITS / 256, expected_root);
+            ssz_mix_in_length(expected_root, n, expected_root);
+            ok = ok && ssz_bitlist_hash_tree_root(&list, MAX_BITS, root) == SSZ_SUCCESS &&
+                 memcmp(root, expected_root, 32) == 0;
+            if (!ok)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: Bits at or above the length do not change the root.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu lengths hashed bits past the length.\n", mismatches);
+        }
+    }
+}
+
+static void test_bits_pack_unpack(void)
+{
+    printf("\n--- Testing ssz_bits_pack and ssz_bits_unpack (backend: %s) ---\n", ssz_bits_backend());
+    printf("Testing every length from 0 to 300 against a per-bit reference...\n");
+    {
+        static bool bits[MAX_BITS];
+        static bool unpacked[MAX_BITS + 1];
+        static uint8_t packed[MAX_BITS / 8 + 1];
+        size_t mismatches = 0;
+        for (size_t n = 0; n <= 300; n++)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                bits[i] = pattern_bit(i + n);
+            }
+            memset(packed, 0xAA, sizeof(packed));
+            ssz_bits_pack(bits, n, packed);
+            for (size_t i = 0; i < n; i++)
+            {
+                if (((packed[i / 8] >> (i % 8)) & 1) != bits[i])
+                {
+                    mismatches++;
+                }
+            }
+            if ((n % 8) != 0 && (packed[n / 8] >> (n % 8)) != 0)
+            {
+                mismatches++;
+            }
+            if (packed[(n + 7) / 8] != 0xAA)
+            {
+                mismatches++;
+            }
+            packed[n / 8] |= (uint8_t)(0xFF << (n % 8));
+            memset(unpacked, 0xAA, sizeof(unpacked));
+            ssz_bits_unpack(packed, n, unpacked);
+            if (memcmp(unpacked, bits, n) != 0 || *(const uint8_t *)&unpacked[n] != 0xAA)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All lengths pack and unpack correctly.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu mismatches.\n", mismatches);
+        }
+    }
+
+    printf("Testing that any non-zero byte packs as a set bit...\n");
+    {
+        uint8_t raw[256];
+        bool bits[256];
+        uint8_t packed[32];
+        size_t mismatches = 0;
+        for (size_t i = 0; i < sizeof(raw); i++)
+        {
+            raw[i] = (i % 3 == 0) ? 0 : (uint8_t)i;
+        }
+        memcpy(bits, raw, sizeof(bits));
+        ssz_bits_pack(bits, 256, packed);
+        for (size_t i = 0; i < 256; i++)
+        {
+            if (((packed[i / 8] >> (i % 8)) & 1) != (raw[i] != 0))
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: Non-canonical booleans packed as set bits.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu non-canonical booleans packed incorrectly.\n", mismatches);
+        }
+    }
+}
+
+int main(void)
+{
+    test_bits_pack_unpack();
+    test_bitlist_matches_bool_api();
+    test_bitvector_matches_bool_api();
+    test_roots_ignore_stray_bits();
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include "ssz_deserialize.h"
 #include "ssz_serialize.h"
 #include "ssz_constants.h"
+#include "ssz_pool.h"
 
 static bool compare_bool_arrays(const bool *arr1, const bool *arr2, size_t len)
 {
@@ -1245,6 +1246,145 @@ static void test_deserialize_list_bool(void)
     }
 }
 
+static ssz_error_t deserialize_bool_element(const uint8_t *buffer, size_t buffer_size, void *out_element)
+{
+    return ssz_deserialize_boolean(buffer, buffer_size, (bool *)out_element);
+}
+
+typedef struct
+{
+    const uint8_t *buffer;
+    size_t count;
+    bool *out[2];
+    ssz_error_t errors[2];
+} nested_decode_ctx_t;
+
+static void nested_decode_task(void *arg, size_t index)
+{
+    nested_decode_ctx_t *ctx = (nested_decode_ctx_t *)arg;
+    size_t error_index = 0;
+    ctx->errors[index] = ssz_deserialize_fixed_list_parallel(ctx->buffer, 1, ctx->count, ctx->out[index], sizeof(bool),
+                                                             deserialize_bool_element, &error_index);
+}
+
+static void test_deserialize_fixed_list_parallel(void)
+{
+    printf("\n--- Testing ssz_deserialize_fixed_list_parallel ---\n");
+    static const size_t threads[] = {1, 2, 4, 0};
+    const size_t count = 100000;
+    uint8_t *buffer = malloc(count);
+    bool *out = malloc(count * sizeof(bool));
+    if (!buffer || !out)
+    {
+        printf("  FAIL: Allocation failed.\n");
+        free(buffer);
+        free(out);
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        buffer[i] = (uint8_t)((i * 7) % 3 == 0);
+    }
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+    {
+        printf("Testing a %zu-element list with %zu requested threads...\n", count, threads[t]);
+        {
+            bool ok = ssz_pool_set_threads(threads[t]) == SSZ_SUCCESS;
+            size_t error_index = 0;
+            memset(out, 0, count * sizeof(bool));
+            ok = ok && ssz_deserialize_fixed_list_parallel(buffer, 1, count, out, sizeof(bool),
+                                                           deserialize_bool_element, &error_index) == SSZ_SUCCESS;
+            for (size_t i = 0; ok && i < count; i++)
+            {
+                ok = out[i] == (buffer[i] == 1);
+            }
+            if (ok)
+            {
+                printf("  OK: All elements decoded.\n");
+            }
+            else
+            {
+                printf("  FAIL: Parallel decode returned wrong elements.\n");
+            }
+        }
+        printf("Testing that the first failing index is reported with %zu requested threads...\n", threads[t]);
+        {
+            bool ok = true;
+            buffer[70001] = 2;
+            buffer[5003] = 7;
+            buffer[99999] = 9;
+            for (int round = 0; ok && round < 10; round++)
+            {
+                size_t error_index = 0;
+                ok = ssz_deserialize_fixed_list_parallel(buffer, 1, count, out, sizeof(bool),
+                                                         deserialize_bool_element,
+                                                         &error_index) == SSZ_ERROR_DESERIALIZATION &&
+                     error_index == 5003;
+            }
+            buffer[70001] = 0;
+            buffer[5003] = 0;
+            buffer[99999] = 0;
+            if (ok)
+            {
+                printf("  OK: Index 5003 reported on every run.\n");
+            }
+            else
+            {
+                printf("  FAIL: Wrong or unstable failing index.\n");
+            }
+        }
+    }
+
+    printf("Testing a parallel decode from inside a pool task...\n");
+    {
+        static nested_decode_ctx_t ctx;
+        bool ok = ssz_pool_set_threads(2) == SSZ_SUCCESS;
+        ctx.buffer = buffer;
+        ctx.count = count;
+        ctx.out[0] = malloc(count * sizeof(bool));
+        ctx.out[1] = malloc(count * sizeof(bool));
+        ok = ok && ctx.out[0] != NULL && ctx.out[1] != NULL;
+        if (ok)
+        {
+            ssz_pool_run(nested_decode_task, &ctx, 2);
+            ok = ctx.errors[0] == SSZ_SUCCESS && ctx.errors[1] == SSZ_SUCCESS;
+        }
+        for (size_t i = 0; ok && i < count; i++)
+        {
+            ok = ctx.out[0][i] == (buffer[i] == 1) && ctx.out[1][i] == (buffer[i] == 1);
+        }
+        free(ctx.out[0]);
+        free(ctx.out[1]);
+        if (ok)
+        {
+            printf("  OK: Nested decode ran to completion.\n");
+        }
+        else
+        {
+            printf("  FAIL: Nested decode returned wrong elements.\n");
+        }
+    }
+    ssz_pool_set_threads(0);
+
+    printf("Testing an empty list and a null element function...\n");
+    {
+        bool ok = ssz_deserialize_fixed_list_parallel(NULL, 1, 0, NULL, sizeof(bool), deserialize_bool_element,
+                                                      NULL) == SSZ_SUCCESS &&
+                  ssz_deserialize_fixed_list_parallel(buffer, 1, count, out, sizeof(bool), NULL,
+                                                      NULL) == SSZ_ERROR_DESERIALIZATION;
+        if (ok)
+        {
+            printf("  OK: Empty list accepted and null function rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Edge cases handled incorrectly.\n");
+        }
+    }
+    free(buffer);
+    free(out);
+}
+
 int main(void)
 {
     test_deserialize_uintN();
@@ -1266,6 +1406,7 @@ int main(void)
     test_deserialize_list_uint128();
     test_deserialize_list_uint256();
     test_deserialize_list_bool();
+    test_deserialize_fixed_list_parallel();
     
     return 0;
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "ssz_deserialize.h"
 #include "ssz_constants.h"
 #include "ssz_merkle.h"
+#include "ssz_bitfield.h"
 #include "yaml_parser.h"
 
 #ifndef TESTS_DIR
@@ -106,6 +107,51 @@ unsigned char *read_file(const char *filepath, size_t *size_out)
     return buffer;
 }
 
+/* Round-trips the fixture through the packed ssz_bitlist_t API and checks its root. */
+static const char *check_packed_bitlist(const uint8_t *data, size_t size, size_t max_bits, const uint8_t *expected_root)
+{
+    ssz_bitlist_t list;
+    const char *result = NULL;
+    uint8_t root[SSZ_BYTES_PER_CHUNK];
+    uint8_t *out_buf = malloc(size);
+    size_t out_size = size;
+    if (!out_buf || ssz_bitlist_init(&list, max_bits) != SSZ_SUCCESS)
+    {
+        free(out_buf);
+        return "Memory allocation failed for packed bitlist";
+    }
+    if (ssz_bitlist_deserialize(data, size, max_bits, &list) != SSZ_SUCCESS)
+    {
+        result = "Packed bitlist deserialization failed";
+    }
+    else if (ssz_bitlist_serialize(&list, out_buf, &out_size) != SSZ_SUCCESS || out_size != size ||
+             memcmp(out_buf, data, size) != 0)
+    {
+        result = "Packed bitlist re-serialization mismatch";
+    }
+    else if (ssz_bitlist_hash_tree_root(&list, max_bits, root) != SSZ_SUCCESS ||
+             memcmp(root, expected_root, SSZ_BYTES_PER_CHUNK) != 0)
+    {
+        result = "Packed bitlist root mismatch";
+    }
+    ssz_bitlist_free(&list);
+    free(out_buf);
+    return result;
+}
+
+/* Returns whether the packed ssz_bitlist_t API accepts the input. */
+static bool packed_bitlist_accepts(const uint8_t *data, size_t size, size_t max_bits)
+{
+    ssz_bitlist_t list;
+    if (ssz_bitlist_init(&list, max_bits) != SSZ_SUCCESS)
+    {
+        return false;
+    }
+    bool accepted = ssz_bitlist_deserialize(data, size, max_bits, &list) == SSZ_SUCCESS;
+    ssz_bitlist_free(&list);
+    return accepted;
+}
+
 void process_serialized_file(const char *folder_name, const char *folder_path, const char *serialized_file_path)
 {
     total_valid_tests++;
@@ -331,6 +377,18 @@ void process_serialized_file(const char *folder_name, const char *folder_path, c
         return;
     }
 
+    const char *packed_err = check_packed_bitlist(expected_data, dec_size, max_bits, yaml_data);
+    if (packed_err != NULL)
+    {
+        valid_failed++;
+        record_failure(folder_name, folder_path, packed_err);
+        free(yaml_data);
+        free(out_buf);
+        free(expected_data);
+        free(in_mem);
+        return;
+    }
+
     valid_passed++;
     free(yaml_data);
     free(out_buf);
@@ -384,6 +442,11 @@ void process_invalid_serialized_file(const char *folder_name, const char *folder
         invalid_failed++;
         record_failure(folder_name, folder_path, "Unexpected success: deserialization did not fail as expected");
     }
+    else if (packed_bitlist_accepts(decoded_data, dec_size, max_allowed))
+    {
+        invalid_failed++;
+        record_failure(folder_name, folder_path, "Unexpected success: packed deserialization did not fail as expected");
+    }
     else
     {
         invalid_passed++;
@@ -11,6 +11,7 @@
 #include "ssz_deserialize.h"
 #include "ssz_constants.h"
 #include "ssz_merkle.h"
+#include "ssz_bitfield.h"
 #include "yaml_parser.h"
 
 #ifndef TESTS_DIR
@@ -106,6 +107,46 @@ unsigned char *read_file(const char *filepath, size_t *size_out)
     return buffer;
 }
 
+/* Round-trips the fixture through the packed ssz_bitvector_t API and checks its root. */
+static const char *check_packed_bitvector(const uint8_t *data, size_t size, size_t bits, const uint8_t *expected_root)
+{
+    const char *result = NULL;
+    uint8_t root[SSZ_BYTES_PER_CHUNK];
+    ssz_bitvector_t vec = {calloc(SSZ_BITFIELD_WORDS(bits), sizeof(uint64_t)), bits};
+    uint8_t *out_buf = malloc(size);
+    size_t out_size = size;
+    if (!vec.words || !out_buf)
+    {
+        result = "Memory allocation failed for packed bitvector";
+    }
+    else if (ssz_bitvector_deserialize(data, size, &vec) != SSZ_SUCCESS)
+    {
+        result = "Packed bitvector deserialization failed";
+    }
+    else if (ssz_bitvector_serialize(&vec, out_buf, &out_size) != SSZ_SUCCESS || out_size != size ||
+             memcmp(out_buf, data, size) != 0)
+    {
+        result = "Packed bitvector re-serialization mismatch";
+    }
+    else if (ssz_bitvector_hash_tree_root(&vec, root) != SSZ_SUCCESS ||
+             memcmp(root, expected_root, SSZ_BYTES_PER_CHUNK) != 0)
+    {
+        result = "Packed bitvector root mismatch";
+    }
+    free(vec.words);
+    free(out_buf);
+    return result;
+}
+
+/* Returns whether the packed ssz_bitvector_t API accepts the input. */
+static bool packed_bitvector_accepts(const uint8_t *data, size_t size, size_t bits)
+{
+    ssz_bitvector_t vec = {calloc(SSZ_BITFIELD_WORDS(bits) + 1, sizeof(uint64_t)), bits};
+    bool accepted = vec.words != NULL && ssz_bitvector_deserialize(data, size, &vec) == SSZ_SUCCESS;
+    free(vec.words);
+    return accepted;
+}
+
 void process_serialized_file(const char *folder_name, const char *folder_path, const char *serialized_file_path)
 {
     total_valid_tests++;
@@ -287,6 +328,12 @@ void process_serialized_file(const char *folder_name, const char *folder_path, c
         free(in_mem);
         return;
     }
+    const char *packed_err = check_packed_bitvector(expected_data, dec_size, max_bits, yaml_data);
+    if (packed_err != NULL)
+    {
+        valid_failed++;
+        record_failure(folder_name, folder_path, packed_err);
+    }
     free(yaml_data);
     free(out_buf);
     free(expected_data);
@@ -343,6 +390,13 @@ void process_invalid_serialized_file(const char *folder_name, const char *folder
         snprintf(msg, sizeof(msg), "Deserialization unexpectedly succeeded in folder %s", folder_name);
         record_failure(folder_name, folder_path, msg);
     }
+    else if (packed_bitvector_accepts(decoded_data, dec_size, max_bits))
+    {
+        invalid_failed++;
+        char msg[256];
+        snprintf(msg, sizeof(msg), "Packed deserialization unexpectedly succeeded in folder %s", folder_name);
+        record_failure(folder_name, folder_path, msg);
+    }
     else
     {
         invalid_passed++;
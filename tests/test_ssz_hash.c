@@ -0,0 +1,300 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "mincrypt/sha256.h"
+#include "ssz_hash.h"
+#include "ssz_bitfield.h"
+#include "ssz_utils.h"
+#include "ssz_merkle.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+static void fill_pattern(uint8_t *buf, size_t len, uint32_t seed)
+{
+    uint32_t x = seed * 2654435761u + 1;
+    for (size_t i = 0; i < len; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buf[i] = (uint8_t)x;
+    }
+}
+
+static void test_sha256_known_vectors(void)
+{
+    printf("\n--- Testing ssz_sha256 known vectors (backend: %s) ---\n", ssz_sha256_backend());
+    uint8_t digest[32];
+
+    printf("Testing digest of \"abc\"...\n");
+    {
+        static const uint8_t expected[32] = {
+            0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+            0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+        ssz_sha256((const uint8_t *)"abc", 3, digest);
+        if (memcmp(digest, expected, 32) == 0)
+        {
+            printf("  OK: Digest of \"abc\" matches.\n");
+        }
+        else
+        {
+            printf("  FAIL: Digest of \"abc\" does not match.\n");
+        }
+    }
+
+    printf("Testing digest of 64 zero bytes...\n");
+    {
+        static const uint8_t expected[32] = {
+            0xf5, 0xa5, 0xfd, 0x42, 0xd1, 0x6a, 0x20, 0x30, 0x27, 0x98, 0xef, 0x6e, 0xd3, 0x09, 0x97, 0x9b,
+            0x43, 0x00, 0x3d, 0x23, 0x20, 0xd9, 0xf0, 0xe8, 0xea, 0x98, 0x31, 0xa9, 0x27, 0x59, 0xfb, 0x4b};
+        uint8_t zeros[64] = {0};
+        ssz_sha256(zeros, sizeof(zeros), digest);
+        if (memcmp(digest, expected, 32) == 0)
+        {
+            printf("  OK: Digest of 64 zero bytes matches.\n");
+        }
+        else
+        {
+            printf("  FAIL: Digest of 64 zero bytes does not match.\n");
+        }
+    }
+}
+
+static void test_sha256_matches_mincrypt(void)
+{
+    printf("\n--- Testing ssz_sha256 against mincrypt ---\n");
+    printf("Testing all lengths from 0 to 1024 bytes...\n");
+    {
+        uint8_t buf[1024];
+        uint8_t expected[32];
+        uint8_t digest[32];
+        size_t mismatches = 0;
+        for (size_t len = 0; len <= sizeof(buf); len++)
+        {
+            fill_pattern(buf, len, (uint32_t)len);
+            SHA256_hash(buf, (int)len, expected);
+            ssz_sha256(buf, len, digest);
+            if (memcmp(digest, expected, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All digests match mincrypt.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu digests differ from mincrypt.\n", mismatches);
+        }
+    }
+}
+
+static void test_sha256_64(void)
+{
+    printf("\n--- Testing ssz_sha256_64 ---\n");
+    printf("Testing 256 random 64-byte messages against mincrypt...\n");
+    {
+        uint8_t buf[64];
+        uint8_t expected[32];
+        uint8_t digest[32];
+        size_t mismatches = 0;
+        for (uint32_t seed = 0; seed < 256; seed++)
+        {
+            fill_pattern(buf, sizeof(buf), seed);
+            SHA256_hash(buf, sizeof(buf), expected);
+            ssz_sha256_64(buf, digest);
+            if (memcmp(digest, expected, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All 64-byte digests match mincrypt.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu 64-byte digests differ from mincrypt.\n", mismatches);
+        }
+    }
+
+    printf("Testing ssz_sha256_64 with output aliasing input...\n");
+    {
+        uint8_t buf[64];
+        uint8_t expected[32];
+        fill_pattern(buf, sizeof(buf), 99);
+        SHA256_hash(buf, sizeof(buf), expected);
+        ssz_sha256_64(buf, buf);
+        if (memcmp(buf, expected, 32) == 0)
+        {
+            printf("  OK: In-place 64-byte digest matches mincrypt.\n");
+        }
+        else
+        {
+            printf("  FAIL: In-place 64-byte digest does not match mincrypt.\n");
+        }
+    }
+}
+
+static void test_hash_pairs(void)
+{
+    printf("\n--- Testing ssz_hash_pairs (batch backend: %s) ---\n", ssz_sha256_batch_backend());
+    enum { MAX_PAIRS = 67 };
+    static uint8_t in[MAX_PAIRS * 64];
+    static uint8_t work[MAX_PAIRS * 64];
+    static uint8_t expected[MAX_PAIRS * 32];
+    static uint8_t out[MAX_PAIRS * 32];
+    fill_pattern(in, sizeof(in), 3);
+    for (size_t i = 0; i < MAX_PAIRS; i++)
+    {
+        SHA256_hash(in + 64 * i, 64, expected + 32 * i);
+    }
+
+    printf("Testing every pair count from 0 to %d...\n", MAX_PAIRS);
+    {
+        size_t mismatches = 0;
+        for (size_t n = 0; n <= MAX_PAIRS; n++)
+        {
+            memset(out, 0, sizeof(out));
+            if (ssz_hash_pairs(in, n, out) != SSZ_SUCCESS || memcmp(out, expected, 32 * n) != 0)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All pair counts match mincrypt.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu pair counts differ from mincrypt.\n", mismatches);
+        }
+    }
+
+    printf("Testing in-place hashing of a level...\n");
+    {
+        memcpy(work, in, sizeof(work));
+        ssz_error_t err = ssz_hash_pairs(work, MAX_PAIRS, work);
+        if (err == SSZ_SUCCESS && memcmp(work, expected, sizeof(expected)) == 0)
+        {
+            printf("  OK: In-place level matches mincrypt.\n");
+        }
+        else
+        {
+            printf("  FAIL: In-place level does not match mincrypt.\n");
+        }
+    }
+
+    printf("Testing NULL input with non-zero pair count...\n");
+    {
+        if (ssz_hash_pairs(NULL, 1, out) == SSZ_ERROR_MERKLEIZATION)
+        {
+            printf("  OK: NULL input rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: NULL input was not rejected.\n");
+        }
+    }
+}
+
+static void test_merkle_digests(void)
+{
+    printf("\n--- Testing merkle functions with the selected backend ---\n");
+    printf("Testing ssz_merkleize of 5 chunks with limit 8...\n");
+    {
+        uint8_t chunks[8 * SSZ_BYTES_PER_CHUNK];
+        uint8_t nodes[8 * SSZ_BYTES_PER_CHUNK];
+        uint8_t expected[32];
+        uint8_t root[32];
+        memset(chunks, 0, sizeof(chunks));
+        fill_pattern(chunks, 5 * SSZ_BYTES_PER_CHUNK, 7);
+        memcpy(nodes, chunks, sizeof(nodes));
+        for (size_t num = 8; num > 1; num >>= 1)
+        {
+            for (size_t i = 0; i < num / 2; i++)
+            {
+                SHA256_hash(nodes + 2 * i * SSZ_BYTES_PER_CHUNK, 64, nodes + i * SSZ_BYTES_PER_CHUNK);
+            }
+        }
+        memcpy(expected, nodes, 32);
+        ssz_error_t err = ssz_merkleize(chunks, 5, 8, root);
+        if (err == SSZ_SUCCESS && memcmp(root, expected, 32) == 0)
+        {
+            printf("  OK: Merkle root matches the mincrypt reference.\n");
+        }
+        else
+        {
+            printf("  FAIL: Merkle root does not match the mincrypt reference.\n");
+        }
+    }
+
+    printf("Testing ssz_mix_in_length and ssz_mix_in_selector...\n");
+    {
+        uint8_t root[32];
+        uint8_t buf[64];
+        uint8_t expected_len[32], expected_sel[32];
+        uint8_t out_len[32], out_sel[32];
+        fill_pattern(root, sizeof(root), 11);
+        memset(buf, 0, sizeof(buf));
+        memcpy(buf, root, 32);
+        buf[32] = 0x39;
+        buf[33] = 0x30;
+        SHA256_hash(buf, 64, expected_len);
+        memset(buf + 32, 0, 32);
+        buf[32] = 0x02;
+        SHA256_hash(buf, 64, expected_sel);
+        ssz_mix_in_length(root, 12345, out_len);
+        ssz_mix_in_selector(root, 0x02, out_sel);
+        if (memcmp(out_len, expected_len, 32) == 0 && memcmp(out_sel, expected_sel, 32) == 0)
+        {
+            printf("  OK: Mix-in results match the mincrypt reference.\n");
+        }
+        else
+        {
+            printf("  FAIL: Mix-in results do not match the mincrypt reference.\n");
+        }
+    }
+}
+
+static void test_cpu_dispatch(void)
+{
+    printf("\n--- Testing runtime dispatch against ssz_cpu_detect ---\n");
+    printf("Testing that every selected backend follows the detected features...\n");
+    {
+        ssz_cpu_features_t features;
+        ssz_cpu_detect(&features);
+        const char *bits = features.avx2 ? "avx2" : features.sse2 ? "sse2" : "scalar";
+        const char *scan = features.avx2 && features.lzcnt ? "avx2" : "word";
+        const char *batch = features.avx512                  ? "avx512"
+                            : features.avx2 && !features.shani ? "avx2"
+                                                               : "scalar";
+        const char *sha = features.shani ? "sha-ni" : "generic";
+        if (strcmp(ssz_bits_backend(), bits) == 0 && strcmp(ssz_scan_backend(), scan) == 0 &&
+            strcmp(ssz_sha256_batch_backend(), batch) == 0 && strcmp(ssz_sha256_backend(), sha) == 0)
+        {
+            printf("  OK: Backends %s, %s, %s and %s match the detected features.\n", ssz_sha256_backend(),
+                   ssz_sha256_batch_backend(), ssz_bits_backend(), ssz_scan_backend());
+        }
+        else
+        {
+            printf("  FAIL: A backend does not match the detected features.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_sha256_known_vectors();
+    test_sha256_matches_mincrypt();
+    test_sha256_64();
+    test_hash_pairs();
+    test_merkle_digests();
+    test_cpu_dispatch();
+
+    return 0;
+}
@@ -0,0 +1,665 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "mincrypt/sha256.h"
+#include "ssz_merkle.h"
+#include "ssz_pool.h"
+#include "ssz_proof.h"
+#include "ssz_tree.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+static void fill_pattern(uint8_t *buf, size_t len, uint32_t seed)
+{
+    uint32_t x = seed * 2654435761u + 1;
+    for (size_t i = 0; i < len; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buf[i] = (uint8_t)x;
+    }
+}
+
+/* Naive reference: materializes every padding leaf and hashes the full tree. */
+static void reference_merkleize(const uint8_t *chunks, size_t chunk_count, size_t limit, uint8_t *out_root)
+{
+    size_t width = 1;
+    size_t effective = limit != 0 ? limit : chunk_count;
+    while (width < effective)
+    {
+        width <<= 1;
+    }
+    uint8_t *nodes = calloc(width, SSZ_BYTES_PER_CHUNK);
+    if (chunk_count > 0)
+    {
+        memcpy(nodes, chunks, chunk_count * SSZ_BYTES_PER_CHUNK);
+    }
+    for (size_t num = width; num > 1; num >>= 1)
+    {
+        for (size_t i = 0; i < num / 2; i++)
+        {
+            SHA256_hash(nodes + 2 * i * SSZ_BYTES_PER_CHUNK, 64, nodes + i * SSZ_BYTES_PER_CHUNK);
+        }
+    }
+    memcpy(out_root, nodes, SSZ_BYTES_PER_CHUNK);
+    free(nodes);
+}
+
+static void test_zero_hashes(void)
+{
+    printf("\n--- Testing zero_hashes table ---\n");
+    printf("Testing every entry against hashing the previous entry with itself...\n");
+    {
+        uint8_t buf[64];
+        uint8_t digest[32];
+        bool ok = true;
+        for (size_t i = 0; i < SSZ_BYTES_PER_CHUNK; i++)
+        {
+            ok = ok && zero_hashes[0][i] == 0;
+        }
+        for (size_t d = 0; d < SSZ_MAX_MERKLE_DEPTH; d++)
+        {
+            memcpy(buf, zero_hashes[d], 32);
+            memcpy(buf + 32, zero_hashes[d], 32);
+            SHA256_hash(buf, 64, digest);
+            ok = ok && memcmp(digest, zero_hashes[d + 1], 32) == 0;
+        }
+        if (ok)
+        {
+            printf("  OK: All zero subtree roots are consistent.\n");
+        }
+        else
+        {
+            printf("  FAIL: zero_hashes table is inconsistent.\n");
+        }
+    }
+
+    printf("Testing zero_hashes[1] against the known digest...\n");
+    {
+        static const uint8_t expected[32] = {
+            0xf5, 0xa5, 0xfd, 0x42, 0xd1, 0x6a, 0x20, 0x30, 0x27, 0x98, 0xef, 0x6e, 0xd3, 0x09, 0x97, 0x9b,
+            0x43, 0x00, 0x3d, 0x23, 0x20, 0xd9, 0xf0, 0xe8, 0xea, 0x98, 0x31, 0xa9, 0x27, 0x59, 0xfb, 0x4b};
+        if (memcmp(zero_hashes[1], expected, 32) == 0)
+        {
+            printf("  OK: zero_hashes[1] matches.\n");
+        }
+        else
+        {
+            printf("  FAIL: zero_hashes[1] does not match.\n");
+        }
+    }
+}
+
+static void test_merkleize_against_reference(void)
+{
+    printf("\n--- Testing ssz_merkleize against a full-tree reference ---\n");
+    printf("Testing chunk counts 0..40 against limits from 0 to 128...\n");
+    {
+        static uint8_t chunks[40 * SSZ_BYTES_PER_CHUNK];
+        static const size_t limits[] = {0, 1, 2, 3, 5, 8, 17, 33, 40, 64, 100, 128};
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        size_t cases = 0;
+        for (size_t count = 0; count <= 40; count++)
+        {
+            fill_pattern(chunks, count * SSZ_BYTES_PER_CHUNK, (uint32_t)count);
+            for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+            {
+                size_t limit = limits[l];
+                if (limit != 0 && count > limit)
+                {
+                    continue;
+                }
+                reference_merkleize(chunks, count, limit, expected);
+                if (ssz_merkleize(chunks, count, limit, root) != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+                {
+                    mismatches++;
+                }
+                cases++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All %zu roots match the reference.\n", cases);
+        }
+        else
+        {
+            printf("  FAIL: %zu of %zu roots differ from the reference.\n", mismatches, cases);
+        }
+    }
+}
+
+static void test_merkleize_large_limits(void)
+{
+    printf("\n--- Testing ssz_merkleize with large limits ---\n");
+    printf("Testing 3 chunks with limit 2^40...\n");
+    {
+        uint8_t chunks[3 * SSZ_BYTES_PER_CHUNK];
+        uint8_t buf[64];
+        uint8_t left[32], right[32];
+        uint8_t root[32];
+        fill_pattern(chunks, sizeof(chunks), 21);
+        SHA256_hash(chunks, 64, left);
+        memcpy(buf, chunks + 64, 32);
+        memset(buf + 32, 0, 32);
+        SHA256_hash(buf, 64, right);
+        memcpy(buf, left, 32);
+        memcpy(buf + 32, right, 32);
+        SHA256_hash(buf, 64, left);
+        for (size_t d = 2; d < 40; d++)
+        {
+            memcpy(buf, left, 32);
+            memcpy(buf + 32, zero_hashes[d], 32);
+            SHA256_hash(buf, 64, left);
+        }
+        ssz_error_t err = ssz_merkleize(chunks, 3, (size_t)1 << 40, root);
+        if (err == SSZ_SUCCESS && memcmp(root, left, 32) == 0)
+        {
+            printf("  OK: Root matches the manual fold.\n");
+        }
+        else
+        {
+            printf("  FAIL: Root does not match the manual fold.\n");
+        }
+    }
+
+    printf("Testing an empty list with limit 2^40...\n");
+    {
+        uint8_t root[32];
+        ssz_error_t err = ssz_merkleize(NULL, 0, (size_t)1 << 40, root);
+        if (err == SSZ_SUCCESS && memcmp(root, zero_hashes[40], 32) == 0)
+        {
+            printf("  OK: Root equals zero_hashes[40].\n");
+        }
+        else
+        {
+            printf("  FAIL: Root does not equal zero_hashes[40].\n");
+        }
+    }
+
+    printf("Testing chunk count exceeding the limit...\n");
+    {
+        uint8_t chunks[3 * SSZ_BYTES_PER_CHUNK] = {0};
+        uint8_t root[32];
+        if (ssz_merkleize(chunks, 3, 2, root) == SSZ_ERROR_SERIALIZATION)
+        {
+            printf("  OK: Oversized input rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized input was not rejected.\n");
+        }
+    }
+}
+
+static void test_merkleizer_streaming(void)
+{
+    printf("\n--- Testing ssz_merkleizer_t ---\n");
+    printf("Testing streamed roots against ssz_merkleize with varying push sizes...\n");
+    {
+        enum { MAX_CHUNKS = 700 };
+        static uint8_t chunks[MAX_CHUNKS * SSZ_BYTES_PER_CHUNK];
+        static const size_t counts[] = {0, 1, 2, 3, 7, 8, 9, 31, 64, 255, 256, 257, 511, 513, 700};
+        static const size_t steps[] = {1, 3, 256, 1000};
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        size_t cases = 0;
+        fill_pattern(chunks, sizeof(chunks), 5);
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            size_t count = counts[c];
+            size_t limits[] = {0, count, 1024, (size_t)1 << 40};
+            for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+            {
+                ssz_merkleize(chunks, count, limits[l], expected);
+                for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++)
+                {
+                    ssz_merkleizer_t m;
+                    bool ok = ssz_merkleizer_init(&m, limits[l]) == SSZ_SUCCESS;
+                    for (size_t pos = 0; pos < count; pos += steps[s])
+                    {
+                        size_t n = count - pos < steps[s] ? count - pos : steps[s];
+                        ok = ok && ssz_merkleizer_push_chunks(&m, chunks + pos * SSZ_BYTES_PER_CHUNK, n) == SSZ_SUCCESS;
+                    }
+                    ok = ok && ssz_merkleizer_finalize(&m, root) == SSZ_SUCCESS;
+                    if (!ok || memcmp(root, expected, 32) != 0)
+                    {
+                        mismatches++;
+                    }
+                    cases++;
+                }
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All %zu streamed roots match ssz_merkleize.\n", cases);
+        }
+        else
+        {
+            printf("  FAIL: %zu of %zu streamed roots differ from ssz_merkleize.\n", mismatches, cases);
+        }
+    }
+
+    printf("Testing pushes beyond the limit...\n");
+    {
+        uint8_t chunks[3 * SSZ_BYTES_PER_CHUNK] = {0};
+        uint8_t root[32];
+        uint8_t expected[32];
+        ssz_merkleizer_t m;
+        ssz_merkleizer_init(&m, 4);
+        ssz_merkleizer_push_chunks(&m, chunks, 3);
+        ssz_error_t err = ssz_merkleizer_push_chunks(&m, chunks, 2);
+        ssz_merkleizer_finalize(&m, root);
+        ssz_merkleize(chunks, 3, 4, expected);
+        if (err == SSZ_ERROR_SERIALIZATION && memcmp(root, expected, 32) == 0)
+        {
+            printf("  OK: Oversized push rejected without changing the state.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized push was not handled correctly.\n");
+        }
+    }
+}
+
+static void test_merkleize_parallel(void)
+{
+    printf("\n--- Testing ssz_merkleize_parallel ---\n");
+    printf("Testing parallel roots against ssz_merkleize for several thread counts...\n");
+    {
+        static const size_t counts[] = {100, 16384, 16385, 40000, 65536};
+        static const size_t threads[] = {1, 2, 3, 8};
+        size_t max_count = 65536;
+        uint8_t *chunks = malloc(max_count * SSZ_BYTES_PER_CHUNK);
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        size_t cases = 0;
+        fill_pattern(chunks, max_count * SSZ_BYTES_PER_CHUNK, 13);
+        for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+        {
+            ssz_pool_set_threads(threads[t]);
+            for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+            {
+                size_t limits[] = {0, counts[c], (size_t)1 << 40};
+                for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+                {
+                    ssz_merkleize(chunks, counts[c], limits[l], expected);
+                    ssz_error_t err = ssz_merkleize_parallel(chunks, counts[c], limits[l], root);
+                    if (err != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+                    {
+                        mismatches++;
+                    }
+                    cases++;
+                }
+            }
+        }
+        ssz_pool_set_threads(0);
+        free(chunks);
+        if (mismatches == 0)
+        {
+            printf("  OK: All %zu parallel roots match ssz_merkleize.\n", cases);
+        }
+        else
+        {
+            printf("  FAIL: %zu of %zu parallel roots differ from ssz_merkleize.\n", mismatches, cases);
+        }
+    }
+
+    printf("Testing parallel chunk count exceeding the limit...\n");
+    {
+        uint8_t chunks[3 * SSZ_BYTES_PER_CHUNK] = {0};
+        uint8_t root[32];
+        if (ssz_merkleize_parallel(chunks, 3, 2, root) == SSZ_ERROR_SERIALIZATION)
+        {
+            printf("  OK: Oversized input rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized input was not rejected.\n");
+        }
+    }
+}
+
+static void test_merkleize_packed_and_bits(void)
+{
+    printf("\n--- Testing ssz_merkleize_packed and ssz_merkleize_bits ---\n");
+    printf("Testing packed byte strings against ssz_pack and ssz_merkleize...\n");
+    {
+        uint8_t bytes[300];
+        uint8_t chunks[10 * SSZ_BYTES_PER_CHUNK];
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        fill_pattern(bytes, sizeof(bytes), 17);
+        for (size_t len = 0; len <= sizeof(bytes); len++)
+        {
+            size_t chunk_count = 0;
+            ssz_pack(bytes, 1, len, chunks, &chunk_count);
+            ssz_merkleize(chunks, chunk_count, 16, expected);
+            if (ssz_merkleize_packed(bytes, len, 16, root) != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All packed roots match.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu packed roots differ.\n", mismatches);
+        }
+    }
+
+    printf("Testing bitfields against ssz_pack_bits and ssz_merkleize...\n");
+    {
+        static bool bits[5000];
+        static uint8_t chunks[20 * SSZ_BYTES_PER_CHUNK];
+        static const size_t counts[] = {1, 7, 8, 9, 255, 256, 257, 2047, 2048, 2049, 5000};
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        for (size_t i = 0; i < sizeof(bits); i++)
+        {
+            bits[i] = ((i * 7) % 5) < 2;
+        }
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            size_t chunk_count = 0;
+            ssz_pack_bits(bits, counts[c], chunks, &chunk_count);
+            ssz_merkleize(chunks, chunk_count, 20, expected);
+            if (ssz_merkleize_bits(bits, counts[c], 20, root) != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        if (ssz_merkleize_bits(NULL, 0, 20, root) != SSZ_SUCCESS || memcmp(root, zero_hashes[5], 32) != 0)
+        {
+            mismatches++;
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All bitfield roots match.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu bitfield roots differ.\n", mismatches);
+        }
+    }
+}
+
+/* Sequential reference in the style of is_valid_merkle_branch. */
+static bool reference_verify_branch(const uint8_t *leaf, const uint8_t *branch, uint64_t gindex, const uint8_t *root)
+{
+    uint8_t buf[64];
+    memcpy(buf, leaf, 32);
+    for (size_t i = 0; gindex > 1; i++, gindex >>= 1)
+    {
+        if (gindex & 1)
+        {
+            memmove(buf + 32, buf, 32);
+            memcpy(buf, branch + 32 * i, 32);
+        }
+        else
+        {
+            memcpy(buf + 32, branch + 32 * i, 32);
+        }
+        SHA256_hash(buf, 64, buf);
+    }
+    return memcmp(buf, root, 32) == 0;
+}
+
+static void test_verify_branches(void)
+{
+    printf("\n--- Testing ssz_verify_branches ---\n");
+    enum { COUNT = 200, PROOFS = COUNT + 4 };
+    static uint8_t chunks[COUNT * SSZ_BYTES_PER_CHUNK];
+    static uint8_t leaves[PROOFS * SSZ_BYTES_PER_CHUNK];
+    static uint8_t branch_data[PROOFS][64 * SSZ_BYTES_PER_CHUNK];
+    static const uint8_t *branches[PROOFS];
+    static uint64_t gindices[PROOFS];
+    static bool valid[PROOFS];
+    uint8_t root[32];
+    ssz_tree_t tree;
+    fill_pattern(chunks, sizeof(chunks), 23);
+    ssz_tree_init(&tree, chunks, COUNT, (size_t)1 << 32);
+    ssz_tree_root(&tree, root);
+    uint32_t depth = ssz_tree_depth(&tree);
+    for (size_t i = 0; i < PROOFS; i++)
+    {
+        size_t depth_out = 0;
+        if (i < COUNT)
+        {
+            gindices[i] = ((uint64_t)1 << depth) + (i * 37) % COUNT;
+        }
+        else
+        {
+            /* Internal nodes at different depths, the root itself, and a duplicate leaf. */
+            static const uint64_t extra[] = {2, 13, 1, 0};
+            gindices[i] = extra[i - COUNT] != 0 ? extra[i - COUNT] : gindices[0];
+        }
+        ssz_tree_get_node(&tree, gindices[i], leaves + i * SSZ_BYTES_PER_CHUNK);
+        ssz_tree_proof(&tree, gindices[i], branch_data[i], &depth_out);
+        branches[i] = branch_data[i];
+    }
+    ssz_tree_free(&tree);
+
+    printf("Testing honest proofs of mixed depths against a 2^32-leaf tree...\n");
+    {
+        size_t failures = 0;
+        memset(valid, 0, sizeof(valid));
+        if (ssz_verify_branches(leaves, branches, gindices, PROOFS, root, valid) != SSZ_SUCCESS)
+        {
+            failures = PROOFS;
+        }
+        for (size_t i = 0; i < PROOFS; i++)
+        {
+            if (!valid[i] || !reference_verify_branch(leaves + i * SSZ_BYTES_PER_CHUNK, branches[i], gindices[i], root))
+            {
+                failures++;
+            }
+        }
+        if (failures == 0)
+        {
+            printf("  OK: All proofs verify.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu proofs do not verify.\n", failures);
+        }
+    }
+
+    printf("Testing that tampered proofs fail without affecting their neighbours...\n");
+    {
+        size_t failures = 0;
+        leaves[5 * SSZ_BYTES_PER_CHUNK] ^= 1;
+        branch_data[100][(depth - 2) * SSZ_BYTES_PER_CHUNK] ^= 1;
+        branch_data[COUNT + 3][(depth - 1) * SSZ_BYTES_PER_CHUNK] ^= 1;
+        if (ssz_verify_branches(leaves, branches, gindices, PROOFS, root, valid) != SSZ_SUCCESS)
+        {
+            failures = PROOFS;
+        }
+        for (size_t i = 0; i < PROOFS; i++)
+        {
+            bool expected = reference_verify_branch(leaves + i * SSZ_BYTES_PER_CHUNK, branches[i], gindices[i], root);
+            if (valid[i] != expected)
+            {
+                failures++;
+            }
+        }
+        if (failures == 0 && !valid[5] && !valid[100] && !valid[COUNT + 3] && valid[0])
+        {
+            printf("  OK: Exactly the tampered proofs fail.\n");
+        }
+        else
+        {
+            printf("  FAIL: Tampered proof results are wrong.\n");
+        }
+    }
+
+    printf("Testing generalized index 0...\n");
+    {
+        uint64_t bad = 0;
+        if (ssz_verify_branches(leaves, branches, &bad, 1, root, valid) == SSZ_ERROR_OUT_OF_RANGE)
+        {
+            printf("  OK: Index 0 rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Index 0 was not rejected.\n");
+        }
+    }
+}
+
+static void test_hash_tree_root_basic(void)
+{
+    printf("\n--- Testing ssz_hash_tree_root_basic_vector and ssz_hash_tree_root_basic_list ---\n");
+    static uint8_t elements[1000 * 8];
+    static uint8_t chunks[(1000 * 8 / SSZ_BYTES_PER_CHUNK + 1) * SSZ_BYTES_PER_CHUNK];
+    static const size_t sizes[] = {1, 2, 4, 8, 16, 32};
+    fill_pattern(elements, sizeof(elements), 29);
+
+    printf("Testing every element size and many counts against ssz_pack and ssz_merkleize...\n");
+    {
+        size_t mismatches = 0;
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+        {
+            size_t size = sizes[s];
+            size_t max_length = sizeof(elements) / size;
+            size_t list_limit = (max_length * size + SSZ_BYTES_PER_CHUNK - 1) / SSZ_BYTES_PER_CHUNK;
+            for (size_t count = 0; count <= max_length; count += 1 + count / 3)
+            {
+                size_t chunk_count = 0;
+                uint8_t expected[32];
+                uint8_t root[32];
+                if (count > 0)
+                {
+                    ssz_pack(elements, size, count, chunks, &chunk_count);
+                    ssz_merkleize(chunks, chunk_count, chunk_count, expected);
+                    if (ssz_hash_tree_root_basic_vector(elements, size, count, root) != SSZ_SUCCESS ||
+                        memcmp(root, expected, 32) != 0)
+                    {
+                        mismatches++;
+                    }
+                }
+                if (count == 0)
+                {
+                    ssz_merkleize(NULL, 0, list_limit, expected);
+                }
+                else
+                {
+                    ssz_merkleize(chunks, chunk_count, list_limit, expected);
+                }
+                ssz_mix_in_length(expected, count, expected);
+                if (ssz_hash_tree_root_basic_list(elements, size, count, max_length, root) != SSZ_SUCCESS ||
+                    memcmp(root, expected, 32) != 0)
+                {
+                    mismatches++;
+                }
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All roots match.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu roots differ.\n", mismatches);
+        }
+    }
+
+    printf("Testing an overlong list and an invalid element size...\n");
+    {
+        uint8_t root[32];
+        if (ssz_hash_tree_root_basic_list(elements, 8, 11, 10, root) == SSZ_ERROR_SERIALIZATION &&
+            ssz_hash_tree_root_basic_list(elements, 3, 4, 10, root) == SSZ_ERROR_MERKLEIZATION &&
+            ssz_hash_tree_root_basic_vector(elements, 0, 4, root) == SSZ_ERROR_MERKLEIZATION)
+        {
+            printf("  OK: Invalid inputs rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Invalid inputs were not rejected.\n");
+        }
+    }
+}
+
+static void test_merkleize_ex(void)
+{
+    printf("\n--- Testing ssz_merkleize_ex ---\n");
+    static uint8_t chunks[300 * SSZ_BYTES_PER_CHUNK];
+    static uint8_t work[300 * SSZ_BYTES_PER_CHUNK];
+    static uint8_t scratch[300 * SSZ_BYTES_PER_CHUNK];
+    static const size_t limits[] = {0, 300, 512, (size_t)1 << 40};
+    fill_pattern(chunks, sizeof(chunks), 31);
+
+    printf("Testing caller scratch and in-place mode against ssz_merkleize...\n");
+    {
+        size_t mismatches = 0;
+        for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+        {
+            for (size_t count = 0; count <= 300; count += 1 + count / 4)
+            {
+                uint8_t expected[32];
+                uint8_t root[32];
+                uint8_t in_place[32];
+                size_t scratch_size = ssz_merkleize_scratch_size(count, limits[l]);
+                ssz_merkleize(chunks, count, limits[l], expected);
+                memcpy(work, chunks, count * SSZ_BYTES_PER_CHUNK);
+                if (scratch_size > sizeof(scratch) ||
+                    ssz_merkleize_ex(chunks, count, limits[l], scratch, scratch_size, root) != SSZ_SUCCESS ||
+                    ssz_merkleize_ex(work, count, limits[l], work, scratch_size, in_place) != SSZ_SUCCESS ||
+                    memcmp(root, expected, 32) != 0 || memcmp(in_place, expected, 32) != 0)
+                {
+                    mismatches++;
+                }
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All roots match.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu roots differ.\n", mismatches);
+        }
+    }
+
+    printf("Testing scratch that is too small...\n");
+    {
+        uint8_t root[32];
+        size_t needed = ssz_merkleize_scratch_size(5, 8);
+        if (needed == 5 * SSZ_BYTES_PER_CHUNK &&
+            ssz_merkleize_ex(chunks, 5, 8, scratch, needed - 1, root) == SSZ_ERROR_OUT_OF_RANGE &&
+            ssz_merkleize_ex(chunks, 1, 1, NULL, 0, root) == SSZ_SUCCESS && memcmp(root, chunks, 32) == 0)
+        {
+            printf("  OK: Scratch size is enforced.\n");
+        }
+        else
+        {
+            printf("  FAIL: Scratch size is not enforced.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_zero_hashes();
+    test_merkleize_against_reference();
+    test_merkleize_large_limits();
+    test_merkleizer_streaming();
+    test_merkleize_parallel();
+    test_merkleize_packed_and_bits();
+    test_verify_branches();
+    test_hash_tree_root_basic();
+    test_merkleize_ex();
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include "ssz_pool.h"
+#include "ssz_merkle.h"
+#include "ssz_constants.h"
+
+#define NESTED_MERKLE_CHUNKS (SSZ_PARALLEL_MERKLEIZE_MIN_CHUNKS + 3616)
+
+typedef struct
+{
+    uint32_t hits[1000];
+    atomic_size_t nested_total;
+} pool_test_ctx_t;
+
+static void count_task(void *arg, size_t index)
+{
+    pool_test_ctx_t *ctx = (pool_test_ctx_t *)arg;
+    ctx->hits[index]++;
+}
+
+static void nested_inner_task(void *arg, size_t index)
+{
+    atomic_fetch_add((atomic_size_t *)arg, index + 1);
+}
+
+static void nested_outer_task(void *arg, size_t index)
+{
+    pool_test_ctx_t *ctx = (pool_test_ctx_t *)arg;
+    (void)index;
+    ssz_pool_run(nested_inner_task, &ctx->nested_total, 10);
+}
+
+typedef struct
+{
+    const uint8_t *chunks;
+    uint8_t roots[4][SSZ_BYTES_PER_CHUNK];
+    size_t threads[4];
+    ssz_error_t errors[4];
+} nested_merkle_ctx_t;
+
+static void nested_merkle_task(void *arg, size_t index)
+{
+    nested_merkle_ctx_t *ctx = (nested_merkle_ctx_t *)arg;
+    ctx->threads[index] = ssz_pool_threads();
+    ctx->errors[index] = ssz_merkleize_parallel(ctx->chunks, NESTED_MERKLE_CHUNKS, 0, ctx->roots[index]);
+}
+
+static void test_pool_run(void)
+{
+    printf("\n--- Testing ssz_pool_run ---\n");
+    static const size_t threads[] = {1, 2, 4, 0};
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++)
+    {
+        printf("Testing every task runs exactly once with %zu requested threads...\n", threads[t]);
+        {
+            static pool_test_ctx_t ctx;
+            bool ok = ssz_pool_set_threads(threads[t]) == SSZ_SUCCESS && ssz_pool_threads() >= 1;
+            for (size_t round = 0; round < 20; round++)
+            {
+                memset(ctx.hits, 0, sizeof(ctx.hits));
+                ssz_pool_run(count_task, &ctx, 1000);
+                for (size_t i = 0; i < 1000; i++)
+                {
+                    ok = ok && ctx.hits[i] == 1;
+                }
+            }
+            if (ok)
+            {
+                printf("  OK: All tasks ran exactly once.\n");
+            }
+            else
+            {
+                printf("  FAIL: Some tasks were skipped or repeated.\n");
+            }
+        }
+    }
+
+    printf("Testing a job submitted from inside a task...\n");
+    {
+        static pool_test_ctx_t ctx;
+        ssz_pool_set_threads(3);
+        atomic_init(&ctx.nested_total, 0);
+        ssz_pool_run(nested_outer_task, &ctx, 8);
+        if (atomic_load(&ctx.nested_total) == 8 * 55)
+        {
+            printf("  OK: Nested job ran to completion.\n");
+        }
+        else
+        {
+            printf("  FAIL: Nested job did not run to completion.\n");
+        }
+    }
+
+    printf("Testing ssz_merkleize_parallel from inside a task...\n");
+    {
+        static uint8_t chunks[NESTED_MERKLE_CHUNKS * SSZ_BYTES_PER_CHUNK];
+        static nested_merkle_ctx_t ctx;
+        uint8_t expected[SSZ_BYTES_PER_CHUNK];
+        bool ok;
+        for (size_t i = 0; i < sizeof(chunks); i++)
+        {
+            chunks[i] = (uint8_t)(i * 13 + 5);
+        }
+        ctx.chunks = chunks;
+        ssz_pool_set_threads(2);
+        ok = ssz_merkleize(chunks, NESTED_MERKLE_CHUNKS, 0, expected) == SSZ_SUCCESS;
+        ssz_pool_run(nested_merkle_task, &ctx, 4);
+        for (size_t i = 0; i < 4; i++)
+        {
+            ok = ok && ctx.threads[i] == 1 && ctx.errors[i] == SSZ_SUCCESS &&
+                 memcmp(ctx.roots[i], expected, SSZ_BYTES_PER_CHUNK) == 0;
+        }
+        if (ok)
+        {
+            printf("  OK: Nested merkleization ran serially and returned the same root.\n");
+        }
+        else
+        {
+            printf("  FAIL: Nested merkleization returned a wrong root or thread count.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_pool_run();
+
+    return 0;
+}
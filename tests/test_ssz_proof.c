@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "mincrypt/sha256.h"
+#include "ssz_proof.h"
+#include "ssz_tree.h"
+#include "ssz_merkle.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+#define MAX_KNOWN 4096
+
+static void fill_pattern(uint8_t *buf, size_t len, uint32_t seed)
+{
+    uint32_t x = seed * 2654435761u + 1;
+    for (size_t i = 0; i < len; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buf[i] = (uint8_t)x;
+    }
+}
+
+static uint64_t leaf_gindex(uint32_t depth, size_t index)
+{
+    return ((uint64_t)1 << depth) + index;
+}
+
+/* Reference multiproof verifier: repeatedly combines known siblings until the root is known. */
+static bool reference_multi_root(const uint64_t *indices, const uint8_t *nodes, size_t count, uint8_t *out_root)
+{
+    static uint64_t known[MAX_KNOWN];
+    static uint8_t values[MAX_KNOWN][32];
+    size_t n = 0;
+    for (size_t i = 0; i < count && n < MAX_KNOWN; i++, n++)
+    {
+        known[n] = indices[i];
+        memcpy(values[n], nodes + 32 * i, 32);
+    }
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (known[i] == 1)
+            {
+                memcpy(out_root, values[i], 32);
+                return true;
+            }
+            uint64_t sibling = known[i] ^ 1;
+            uint64_t parent = known[i] >> 1;
+            size_t s = n, p = n;
+            for (size_t j = 0; j < n; j++)
+            {
+                if (known[j] == sibling)
+                    s = j;
+                if (known[j] == parent)
+                    p = j;
+            }
+            if (s == n || p != n || n == MAX_KNOWN)
+            {
+                continue;
+            }
+            uint8_t buf[64];
+            size_t left = (known[i] & 1) ? s : i;
+            size_t right = (known[i] & 1) ? i : s;
+            memcpy(buf, values[left], 32);
+            memcpy(buf + 32, values[right], 32);
+            SHA256_hash(buf, 64, values[n]);
+            known[n++] = parent;
+            progress = true;
+        }
+    }
+    return false;
+}
+
+static void test_multiproof_indices(void)
+{
+    printf("\n--- Testing ssz_multiproof_indices ---\n");
+    printf("Testing helper indices for leaves 8, 9 and 14 of a depth-3 tree...\n");
+    {
+        static const uint64_t gindices[] = {8, 9, 14};
+        static const uint64_t expected[] = {15, 6, 5};
+        uint64_t out[64];
+        size_t count = 0;
+        ssz_error_t err = ssz_multiproof_indices(gindices, 3, out, 64, &count);
+        if (err == SSZ_SUCCESS && count == 3 && memcmp(out, expected, sizeof(expected)) == 0)
+        {
+            printf("  OK: Helper indices match.\n");
+        }
+        else
+        {
+            printf("  FAIL: Helper indices do not match.\n");
+        }
+    }
+
+    printf("Testing a single index yields its branch from the bottom up...\n");
+    {
+        uint64_t gindex = 45;
+        uint64_t out[64];
+        size_t count = 0;
+        static const uint64_t expected[] = {44, 23, 10, 4, 3};
+        ssz_error_t err = ssz_multiproof_indices(&gindex, 1, out, 64, &count);
+        if (err == SSZ_SUCCESS && count == 5 && memcmp(out, expected, sizeof(expected)) == 0)
+        {
+            printf("  OK: Branch indices match.\n");
+        }
+        else
+        {
+            printf("  FAIL: Branch indices do not match.\n");
+        }
+    }
+
+    printf("Testing index 0 and insufficient capacity...\n");
+    {
+        uint64_t bad = 0;
+        uint64_t gindex = 45;
+        uint64_t out[4];
+        size_t count = 0;
+        if (ssz_multiproof_indices(&bad, 1, out, 4, &count) == SSZ_ERROR_OUT_OF_RANGE &&
+            ssz_multiproof_indices(&gindex, 1, out, 4, &count) == SSZ_ERROR_OUT_OF_RANGE)
+        {
+            printf("  OK: Invalid requests rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Invalid requests were not rejected.\n");
+        }
+    }
+}
+
+static void test_single_proofs(void)
+{
+    printf("\n--- Testing ssz_tree_proof ---\n");
+    printf("Testing branches of every node fold back to the root...\n");
+    {
+        static uint8_t chunks[13 * SSZ_BYTES_PER_CHUNK];
+        static const size_t limits[] = {0, 16, (size_t)1 << 20};
+        size_t mismatches = 0;
+        size_t cases = 0;
+        fill_pattern(chunks, sizeof(chunks), 4);
+        for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+        {
+            ssz_tree_t tree;
+            uint8_t root[32];
+            ssz_tree_init(&tree, chunks, 13, limits[l]);
+            ssz_tree_root(&tree, root);
+            uint32_t depth = ssz_tree_depth(&tree);
+            uint64_t last = depth > 6 ? leaf_gindex(depth, 40) : leaf_gindex(depth + 1, 0);
+            for (uint64_t g = 1; g < last; g++)
+            {
+                if (depth > 6 && g >= 64 && g < leaf_gindex(depth, 0))
+                {
+                    g = leaf_gindex(depth, 0);
+                }
+                uint8_t branch[64 * 32];
+                uint8_t node[64];
+                size_t branch_depth = 0;
+                bool ok = ssz_tree_proof(&tree, g, branch, &branch_depth) == SSZ_SUCCESS &&
+                          ssz_tree_get_node(&tree, g, node) == SSZ_SUCCESS;
+                uint64_t cur = g;
+                for (size_t i = 0; ok && i < branch_depth; i++, cur >>= 1)
+                {
+                    if (cur & 1)
+                    {
+                        memmove(node + 32, node, 32);
+                        memcpy(node, branch + 32 * i, 32);
+                    }
+                    else
+                    {
+                        memcpy(node + 32, branch + 32 * i, 32);
+                    }
+                    SHA256_hash(node, 64, node);
+                }
+                if (!ok || cur != 1 || memcmp(node, root, 32) != 0)
+                {
+                    mismatches++;
+                }
+                cases++;
+            }
+            ssz_tree_free(&tree);
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All %zu branches verify.\n", cases);
+        }
+        else
+        {
+            printf("  FAIL: %zu of %zu branches do not verify.\n", mismatches, cases);
+        }
+    }
+
+    printf("Testing a node below the leaves...\n");
+    {
+        uint8_t chunks[4 * SSZ_BYTES_PER_CHUNK] = {0};
+        uint8_t branch[64 * 32];
+        size_t depth = 0;
+        ssz_tree_t tree;
+        ssz_tree_init(&tree, chunks, 4, 4);
+        ssz_error_t err = ssz_tree_proof(&tree, 8, branch, &depth);
+        ssz_tree_free(&tree);
+        if (err == SSZ_ERROR_OUT_OF_RANGE)
+        {
+            printf("  OK: Out-of-range index rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Out-of-range index was not rejected.\n");
+        }
+    }
+}
+
+static void test_multiproofs(void)
+{
+    printf("\n--- Testing ssz_tree_multiproof ---\n");
+    printf("Testing random leaf sets against a reference verifier...\n");
+    {
+        enum { COUNT = 1000 };
+        static uint8_t chunks[COUNT * SSZ_BYTES_PER_CHUNK];
+        static uint64_t indices[64 * 16];
+        static uint8_t nodes[64 * 16 * 32];
+        static uint64_t all_indices[64 * 16 + 16];
+        static uint8_t all_nodes[(64 * 16 + 16) * 32];
+        uint32_t x = 99;
+        size_t mismatches = 0;
+        ssz_tree_t tree;
+        uint8_t root[32];
+        fill_pattern(chunks, sizeof(chunks), 8);
+        ssz_tree_init(&tree, chunks, COUNT, (size_t)1 << 40);
+        ssz_tree_root(&tree, root);
+        uint32_t depth = ssz_tree_depth(&tree);
+        for (size_t round = 0; round < 30; round++)
+        {
+            uint64_t gindices[16];
+            size_t n = 1 + round % 16;
+            for (size_t i = 0; i < n; i++)
+            {
+                x = x * 1103515245u + 12345u;
+                gindices[i] = leaf_gindex(depth, (x >> 4) % COUNT);
+            }
+            size_t count = 0;
+            if (ssz_tree_multiproof(&tree, gindices, n, indices, nodes, 64 * 16, &count) != SSZ_SUCCESS)
+            {
+                mismatches++;
+                continue;
+            }
+            memcpy(all_indices, indices, count * sizeof(uint64_t));
+            memcpy(all_nodes, nodes, count * 32);
+            for (size_t i = 0; i < n; i++)
+            {
+                all_indices[count + i] = gindices[i];
+                memcpy(all_nodes + (count + i) * 32, chunks + (gindices[i] - leaf_gindex(depth, 0)) * 32, 32);
+            }
+            uint8_t computed[32];
+            if (!reference_multi_root(all_indices, all_nodes, count + n, computed) || memcmp(computed, root, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        ssz_tree_free(&tree);
+        if (mismatches == 0)
+        {
+            printf("  OK: All multiproofs verify.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu multiproofs do not verify.\n", mismatches);
+        }
+    }
+
+    printf("Testing ssz_merkle_multiproof against the tree version...\n");
+    {
+        static uint8_t chunks[100 * SSZ_BYTES_PER_CHUNK];
+        uint64_t gindices[] = {128 + 3, 128 + 4, 128 + 99, 3};
+        uint64_t indices_a[64 * 4], indices_b[64 * 4];
+        uint8_t nodes_a[64 * 4 * 32], nodes_b[64 * 4 * 32];
+        size_t count_a = 0, count_b = 0;
+        ssz_tree_t tree;
+        fill_pattern(chunks, sizeof(chunks), 9);
+        ssz_tree_init(&tree, chunks, 100, 128);
+        ssz_error_t err_a = ssz_tree_multiproof(&tree, gindices, 4, indices_a, nodes_a, 256, &count_a);
+        ssz_error_t err_b = ssz_merkle_multiproof(chunks, 100, 128, gindices, 4, indices_b, nodes_b, 256, &count_b);
+        ssz_tree_free(&tree);
+        if (err_a == SSZ_SUCCESS && err_b == SSZ_SUCCESS && count_a == count_b &&
+            memcmp(indices_a, indices_b, count_a * sizeof(uint64_t)) == 0 && memcmp(nodes_a, nodes_b, count_a * 32) == 0)
+        {
+            printf("  OK: Both multiproofs are identical.\n");
+        }
+        else
+        {
+            printf("  FAIL: Multiproofs differ.\n");
+        }
+    }
+
+    printf("Testing a NULL gindices array...\n");
+    {
+        static uint8_t chunks[4 * SSZ_BYTES_PER_CHUNK];
+        uint64_t indices[4];
+        uint8_t nodes[4 * 32];
+        size_t count = 0;
+        ssz_tree_t tree;
+        ssz_tree_init(&tree, chunks, 4, 4);
+        ssz_error_t err = ssz_tree_multiproof(&tree, NULL, 1, indices, nodes, 4, &count);
+        ssz_tree_free(&tree);
+        if (err == SSZ_ERROR_MERKLEIZATION)
+        {
+            printf("  OK: NULL gindices rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: NULL gindices not rejected.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_multiproof_indices();
+    test_single_proofs();
+    test_multiproofs();
+
+    return 0;
+}
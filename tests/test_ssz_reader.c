@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "ssz_generator.h"
+
+#define SAMPLE_FIXED_SIZE (8 + 32 + 4 + 4)
+#define SAMPLE_NUMBERS 37
+#define SAMPLE_MAX_NUMBERS 100
+#define SAMPLE_MAX_BITS 64
+#define SAMPLE_SIZE (SAMPLE_FIXED_SIZE + SAMPLE_NUMBERS * 2 + 2)
+
+typedef struct
+{
+    uint64_t length;
+    uint16_t *data;
+} Numbers;
+
+typedef struct
+{
+    uint64_t slot;
+    uint8_t root[32];
+    Numbers numbers;
+    ssz_bitlist_t bits;
+} Sample;
+
+#define READ_SAMPLE_FIELDS                                                                                       \
+    READ_FIELD(SSZ_BYTE_SIZE_OF_UINT64, DESERIALIZE_BASIC_FIELD(obj, offset, slot, ssz_deserialize_uint64));     \
+    READ_BYTES_FIELD(obj, root);                                                                                 \
+    READ_OFFSET_FIELD();                                                                                         \
+    READ_OFFSET_FIELD();                                                                                         \
+    READ_LIST_ELEMENTS_FIELD(obj, numbers, SSZ_BYTE_SIZE_OF_UINT16, SAMPLE_MAX_NUMBERS, ssz_deserialize_uint16); \
+    READ_VARIABLE_FIELD(DESERIALIZE_PACKED_BITLIST_FIELD_ARENA(obj, start, data_size, bits, SAMPLE_MAX_BITS, arena));
+DEFINE_READ_CONTAINER(Sample, READ_SAMPLE_FIELDS)
+
+static void put_uint32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+}
+
+static void build_sample(uint8_t *out)
+{
+    memset(out, 0, SAMPLE_SIZE);
+    for (int i = 0; i < 8; i++)
+    {
+        out[i] = (uint8_t)(0x10 + i);
+    }
+    for (int i = 0; i < 32; i++)
+    {
+        out[8 + i] = (uint8_t)(0xA0 + i);
+    }
+    put_uint32(out + 40, SAMPLE_FIXED_SIZE);
+    put_uint32(out + 44, SAMPLE_FIXED_SIZE + SAMPLE_NUMBERS * 2);
+    for (int i = 0; i < SAMPLE_NUMBERS; i++)
+    {
+        out[SAMPLE_FIXED_SIZE + 2 * i] = (uint8_t)(i * 3);
+        out[SAMPLE_FIXED_SIZE + 2 * i + 1] = (uint8_t)i;
+    }
+    out[SAMPLE_SIZE - 2] = 0x5A;
+    out[SAMPLE_SIZE - 1] = 0x03;
+}
+
+static bool sample_matches(const Sample *sample)
+{
+    if (sample->slot != 0x1716151413121110ULL || sample->numbers.length != SAMPLE_NUMBERS ||
+        sample->bits.length != 9 || sample->bits.words[0] != 0x15A)
+    {
+        return false;
+    }
+    for (int i = 0; i < 32; i++)
+    {
+        if (sample->root[i] != (uint8_t)(0xA0 + i))
+        {
+            return false;
+        }
+    }
+    for (int i = 0; i < SAMPLE_NUMBERS; i++)
+    {
+        if (sample->numbers.data[i] != (uint16_t)(i * 256 + i * 3))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void free_sample(Sample *sample)
+{
+    free(sample->numbers.data);
+    free(sample->bits.words);
+    memset(sample, 0, sizeof(*sample));
+}
+
+static void test_reader_chunks(void)
+{
+    printf("\n--- Testing ssz_reader_push ---\n");
+    static const size_t chunk_sizes[] = {1, 3, 7, 50, SAMPLE_SIZE};
+    static const size_t staging_sizes[] = {8, 9, 64};
+    uint8_t serialized[SAMPLE_SIZE];
+    build_sample(serialized);
+    for (size_t s = 0; s < sizeof(staging_sizes) / sizeof(staging_sizes[0]); s++)
+    {
+        printf("Testing chunked input through a %zu-byte staging buffer...\n", staging_sizes[s]);
+        {
+            bool ok = true;
+            for (size_t c = 0; ok && c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++)
+            {
+                uint8_t staging[64];
+                ssz_reader_t reader;
+                Sample sample;
+                memset(&sample, 0, sizeof(sample));
+                ok = ssz_reader_init_Sample(&reader, staging, staging_sizes[s], SAMPLE_SIZE, &sample, NULL) ==
+                     SSZ_SUCCESS;
+                for (size_t pos = 0; ok && pos < SAMPLE_SIZE; pos += chunk_sizes[c])
+                {
+                    size_t len = SAMPLE_SIZE - pos < chunk_sizes[c] ? SAMPLE_SIZE - pos : chunk_sizes[c];
+                    ok = !ssz_reader_complete(&reader) && ssz_reader_needed(&reader) > 0 &&
+                         ssz_reader_push(&reader, serialized + pos, len) == SSZ_SUCCESS;
+                }
+                ok = ok && ssz_reader_complete(&reader) && ssz_reader_needed(&reader) == 0 && sample_matches(&sample);
+                free_sample(&sample);
+            }
+            if (ok)
+            {
+                printf("  OK: Object decoded identically for every chunk size.\n");
+            }
+            else
+            {
+                printf("  FAIL: Chunked decode produced a wrong object.\n");
+            }
+        }
+    }
+
+    printf("Testing that the reader reports how many bytes it still needs...\n");
+    {
+        uint8_t staging[8];
+        ssz_reader_t reader;
+        Sample sample;
+        memset(&sample, 0, sizeof(sample));
+        bool ok = ssz_reader_init_Sample(&reader, staging, sizeof(staging), SAMPLE_SIZE, &sample, NULL) ==
+                      SSZ_SUCCESS &&
+                  ssz_reader_needed(&reader) == 8 &&
+                  ssz_reader_push(&reader, serialized, 3) == SSZ_SUCCESS && ssz_reader_needed(&reader) == 5 &&
+                  ssz_reader_push(&reader, serialized + 3, 5) == SSZ_SUCCESS && sample.slot == 0x1716151413121110ULL &&
+                  ssz_reader_needed(&reader) == 8 &&
+                  ssz_reader_push(&reader, serialized + 8, SAMPLE_SIZE - 9) == SSZ_SUCCESS &&
+                  !ssz_reader_complete(&reader) && ssz_reader_needed(&reader) == 1 &&
+                  ssz_reader_push(&reader, serialized + SAMPLE_SIZE - 1, 1) == SSZ_SUCCESS &&
+                  ssz_reader_complete(&reader) && sample_matches(&sample);
+        free_sample(&sample);
+        if (ok)
+        {
+            printf("  OK: Needed byte counts follow the field boundaries.\n");
+        }
+        else
+        {
+            printf("  FAIL: Wrong needed byte counts.\n");
+        }
+    }
+}
+
+static void test_reader_errors(void)
+{
+    printf("\n--- Testing ssz_reader errors ---\n");
+    uint8_t serialized[SAMPLE_SIZE + 1];
+    build_sample(serialized);
+    printf("Testing a wrong first offset...\n");
+    {
+        uint8_t staging[64];
+        ssz_reader_t reader;
+        Sample sample;
+        memset(&sample, 0, sizeof(sample));
+        put_uint32(serialized + 40, SAMPLE_FIXED_SIZE + 2);
+        bool ok = ssz_reader_init_Sample(&reader, staging, sizeof(staging), SAMPLE_SIZE, &sample, NULL) ==
+                      SSZ_SUCCESS &&
+                  ssz_reader_push(&reader, serialized, SAMPLE_FIXED_SIZE) == SSZ_ERROR_DESERIALIZATION &&
+                  ssz_reader_push(&reader, serialized + SAMPLE_FIXED_SIZE, 1) == SSZ_ERROR_DESERIALIZATION &&
+                  ssz_reader_needed(&reader) == 0 && !ssz_reader_complete(&reader);
+        put_uint32(serialized + 40, SAMPLE_FIXED_SIZE);
+        free_sample(&sample);
+        if (ok)
+        {
+            printf("  OK: Offset rejected and the error is sticky.\n");
+        }
+        else
+        {
+            printf("  FAIL: Wrong offset accepted.\n");
+        }
+    }
+
+    printf("Testing bytes past the end of the object...\n");
+    {
+        uint8_t staging[64];
+        ssz_reader_t reader;
+        Sample sample;
+        memset(&sample, 0, sizeof(sample));
+        serialized[SAMPLE_SIZE] = 0;
+        bool ok = ssz_reader_init_Sample(&reader, staging, sizeof(staging), SAMPLE_SIZE, &sample, NULL) ==
+                      SSZ_SUCCESS &&
+                  ssz_reader_push(&reader, serialized, SAMPLE_SIZE + 1) == SSZ_ERROR_DESERIALIZATION;
+        free_sample(&sample);
+        if (ok)
+        {
+            printf("  OK: Trailing bytes rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Trailing bytes accepted.\n");
+        }
+    }
+
+    printf("Testing fields that do not fit the staging buffer or the object...\n");
+    {
+        uint8_t staging[64];
+        ssz_reader_t reader;
+        Sample sample;
+        memset(&sample, 0, sizeof(sample));
+        bool ok = ssz_reader_init_Sample(&reader, staging, 4, SAMPLE_SIZE, &sample, NULL) == SSZ_ERROR_OUT_OF_RANGE &&
+                  ssz_reader_init_Sample(&reader, staging, sizeof(staging), 6, &sample, NULL) ==
+                      SSZ_ERROR_DESERIALIZATION &&
+                  ssz_reader_init_Sample(&reader, staging, sizeof(staging), SAMPLE_SIZE - 3, &sample, NULL) ==
+                      SSZ_SUCCESS &&
+                  ssz_reader_push(&reader, serialized, SAMPLE_SIZE - 3) != SSZ_SUCCESS;
+        free_sample(&sample);
+        if (ok)
+        {
+            printf("  OK: Oversized and truncated fields rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized or truncated field accepted.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_reader_chunks();
+    test_reader_errors();
+
+    return 0;
+}
@@ -77,7 +77,7 @@
 #define JUSTIFICATION_BITS_LENGTH 4
 #define SLOTS_PER_EPOCH 32
 #define EPOCHS_PER_ETH1_VOTING_PERIOD 64
-#define MAX_VALIDATORS_PER_COMMITTEE 128
+#define MAX_VALIDATORS_PER_COMMITTEE 2048
 #if SIZE_MAX < 1099511627776ULL
   #define VALIDATOR_REGISTRY_LIMIT SIZE_MAX
 #else
@@ -151,11 +151,7 @@ typedef struct
     uint8_t root[SIZE_ROOT];
 } Checkpoint;
 
-typedef struct
-{
-    uint64_t length;
-    bool *data;
-} AggregationBits;
+typedef ssz_bitlist_t AggregationBits;
 
 typedef struct
 {
@@ -199,7 +195,7 @@ typedef struct
     uint64_t slashings[EPOCHS_PER_SLASHINGS_VECTOR];
     EpochAttestations previous_epoch_attestations;
     EpochAttestations current_epoch_attestations;
-    bool justification_bits[JUSTIFICATION_BITS_LENGTH];
+    uint64_t justification_bits[SSZ_BITFIELD_WORDS(JUSTIFICATION_BITS_LENGTH)];
     Checkpoint previous_justified_checkpoint;
     Checkpoint current_justified_checkpoint;
     Checkpoint finalized_checkpoint;
@@ -217,6 +213,12 @@ DEFINE_SERIALIZE_CONTAINER(Fork, SERIALIZE_FORK_FIELDS);
     DESERIALIZE_BASIC_FIELD(obj, offset, epoch, ssz_deserialize_uint64);
 DEFINE_DESERIALIZE_CONTAINER(Fork, DESERIALIZE_FORK_FIELDS);
 
+#define HTR_FORK_FIELDS                                 \
+    HTR_VECTOR_FIELD(obj, chunk_index, previous_version); \
+    HTR_VECTOR_FIELD(obj, chunk_index, current_version);  \
+    HTR_BASIC_FIELD(obj, chunk_index, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_HASH_TREE_ROOT_CONTAINER(Fork, 3, HTR_FORK_FIELDS);
+
 #define SERIALIZE_BEACON_BLOCK_HEADER_FIELDS                                                           \
     SERIALIZE_BASIC_FIELD(obj, offset, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);           \
     SERIALIZE_BASIC_FIELD(obj, offset, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
@@ -233,6 +235,14 @@ DEFINE_SERIALIZE_CONTAINER(BeaconBlockHeader, SERIALIZE_BEACON_BLOCK_HEADER_FIEL
     DESERIALIZE_VECTOR_FIELD(obj, offset, body_root, ssz_deserialize_vector_uint8);
 DEFINE_DESERIALIZE_CONTAINER(BeaconBlockHeader, DESERIALIZE_BEACON_BLOCK_HEADER_FIELDS);
 
+#define HTR_BEACON_BLOCK_HEADER_FIELDS                                                                 \
+    HTR_BASIC_FIELD(obj, chunk_index, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);           \
+    HTR_BASIC_FIELD(obj, chunk_index, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_VECTOR_FIELD(obj, chunk_index, parent_root);                                                   \
+    HTR_VECTOR_FIELD(obj, chunk_index, state_root);                                                    \
+    HTR_VECTOR_FIELD(obj, chunk_index, body_root);
+DEFINE_HASH_TREE_ROOT_CONTAINER(BeaconBlockHeader, 5, HTR_BEACON_BLOCK_HEADER_FIELDS);
+
 #define SERIALIZE_ETH1DATA_FIELD                                                                      \
     SERIALIZE_VECTOR_FIELD(obj, offset, deposit_root, SIZE_ROOT, ssz_serialize_vector_uint8);         \
     SERIALIZE_BASIC_FIELD(obj, offset, deposit_count, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
@@ -247,6 +257,12 @@ DEFINE_SERIALIZE_LIST(Eth1DataVotes, Eth1Data, SIZE_ETH1_DATA, serialize_Eth1Dat
 DEFINE_DESERIALIZE_CONTAINER(Eth1Data, DESERIALIZE_ETH1DATA_FIELD);
 DEFINE_DESERIALIZE_LIST(Eth1DataVotes, Eth1Data, SIZE_ETH1_DATA, deserialize_Eth1Data);
 
+#define HTR_ETH1DATA_FIELD                                                                            \
+    HTR_VECTOR_FIELD(obj, chunk_index, deposit_root);                                                 \
+    HTR_BASIC_FIELD(obj, chunk_index, deposit_count, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_VECTOR_FIELD(obj, chunk_index, block_hash);
+DEFINE_HASH_TREE_ROOT_CONTAINER(Eth1Data, 3, HTR_ETH1DATA_FIELD);
+
 #define SERIALIZE_VALIDATOR_FIELD                                                                                    \
     SERIALIZE_VECTOR_FIELD(obj, offset, pubkey, SIZE_BLS_PUBKEY, ssz_serialize_vector_uint8);                        \
     SERIALIZE_VECTOR_FIELD(obj, offset, withdrawal_credentials, SIZE_ROOT, ssz_serialize_vector_uint8);              \
@@ -270,6 +286,56 @@ DEFINE_SERIALIZE_LIST(Validators, Validator, SIZE_VALIDATOR, serialize_Validator
     DESERIALIZE_BASIC_FIELD(obj, offset, withdrawable_epoch, ssz_deserialize_uint64);
 DEFINE_DESERIALIZE_CONTAINER(Validator, DESERIALIZE_VALIDATOR_FIELD);
 DEFINE_DESERIALIZE_LIST(Validators, Validator, SIZE_VALIDATOR, deserialize_Validator);
+DEFINE_DESERIALIZE_LIST_PARALLEL(Validators, Validator, SIZE_VALIDATOR, deserialize_Validator);
+
+#define VALIDATOR_FIELD_NAMES(X, T)   \
+    X(T, pubkey)                      \
+    X(T, withdrawal_credentials)      \
+    X(T, effective_balance)           \
+    X(T, slashed)                     \
+    X(T, activation_eligibility_epoch) \
+    X(T, activation_epoch)            \
+    X(T, exit_epoch)                  \
+    X(T, withdrawable_epoch)
+DEFINE_FIELD_ENUM(Validator, VALIDATOR_FIELD_NAMES);
+
+#define DESERIALIZE_PARTIAL_VALIDATOR_FIELD                                                                 \
+    DESERIALIZE_SELECTED_FIELD(Validator, pubkey,                                                           \
+                               DESERIALIZE_VECTOR_FIELD(obj, offset, pubkey, ssz_deserialize_vector_uint8), \
+                               SKIP_FIXED_FIELD(offset, SIZE_BLS_PUBKEY));                                  \
+    DESERIALIZE_SELECTED_FIELD(Validator, withdrawal_credentials,                                           \
+                               DESERIALIZE_VECTOR_FIELD(obj, offset, withdrawal_credentials, ssz_deserialize_vector_uint8), \
+                               SKIP_FIXED_FIELD(offset, SIZE_ROOT));                                        \
+    DESERIALIZE_SELECTED_FIELD(Validator, effective_balance,                                                \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, effective_balance, ssz_deserialize_uint64), \
+                               SKIP_FIXED_FIELD(offset, SIZE_GWEI));                                        \
+    DESERIALIZE_SELECTED_FIELD(Validator, slashed,                                                          \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, slashed, ssz_deserialize_boolean),      \
+                               SKIP_FIXED_FIELD(offset, SIZE_SLASHED));                                     \
+    DESERIALIZE_SELECTED_FIELD(Validator, activation_eligibility_epoch,                                     \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, activation_eligibility_epoch, ssz_deserialize_uint64), \
+                               SKIP_FIXED_FIELD(offset, SIZE_EPOCH));                                       \
+    DESERIALIZE_SELECTED_FIELD(Validator, activation_epoch,                                                 \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, activation_epoch, ssz_deserialize_uint64), \
+                               SKIP_FIXED_FIELD(offset, SIZE_EPOCH));                                       \
+    DESERIALIZE_SELECTED_FIELD(Validator, exit_epoch,                                                       \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, exit_epoch, ssz_deserialize_uint64),    \
+                               SKIP_FIXED_FIELD(offset, SIZE_EPOCH));                                       \
+    DESERIALIZE_SELECTED_FIELD(Validator, withdrawable_epoch,                                               \
+                               DESERIALIZE_BASIC_FIELD(obj, offset, withdrawable_epoch, ssz_deserialize_uint64), \
+                               SKIP_FIXED_FIELD(offset, SIZE_EPOCH));
+DEFINE_DESERIALIZE_PARTIAL_CONTAINER(Validator, DESERIALIZE_PARTIAL_VALIDATOR_FIELD);
+
+#define HTR_VALIDATOR_FIELD                                                                                          \
+    HTR_VECTOR_FIELD(obj, chunk_index, pubkey);                                                                      \
+    HTR_VECTOR_FIELD(obj, chunk_index, withdrawal_credentials);                                                      \
+    HTR_BASIC_FIELD(obj, chunk_index, effective_balance, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);            \
+    HTR_BASIC_FIELD(obj, chunk_index, slashed, SIZE_SLASHED, ssz_serialize_boolean);                                \
+    HTR_BASIC_FIELD(obj, chunk_index, activation_eligibility_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_BASIC_FIELD(obj, chunk_index, activation_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);             \
+    HTR_BASIC_FIELD(obj, chunk_index, exit_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                   \
+    HTR_BASIC_FIELD(obj, chunk_index, withdrawable_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_HASH_TREE_ROOT_CONTAINER(Validator, 8, HTR_VALIDATOR_FIELD);
 
 #define SERIALIZE_CHECKPOINT_FIELD                                                            \
     SERIALIZE_BASIC_FIELD(obj, offset, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
@@ -281,6 +347,16 @@ DEFINE_SERIALIZE_CONTAINER(Checkpoint, SERIALIZE_CHECKPOINT_FIELD);
     DESERIALIZE_VECTOR_FIELD(obj, offset, root, ssz_deserialize_vector_uint8);
 DEFINE_DESERIALIZE_CONTAINER(Checkpoint, DESERIALIZE_CHECKPOINT_FIELD);
 
+#define HTR_CHECKPOINT_FIELD                                                                  \
+    HTR_BASIC_FIELD(obj, chunk_index, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_VECTOR_FIELD(obj, chunk_index, root);
+DEFINE_HASH_TREE_ROOT_CONTAINER(Checkpoint, 2, HTR_CHECKPOINT_FIELD);
+
+#define SIZE_CHECKPOINT_FIELD                      \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64); \
+    SIZE_FIXED_FIELD(size, SIZE_ROOT);
+DEFINE_SIZE_CONTAINER(Checkpoint, SIZE_CHECKPOINT_FIELD);
+
 #define SERIALIZE_ATTESTATION_DATA_FIELD                                                           \
     SERIALIZE_BASIC_FIELD(obj, offset, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);       \
     SERIALIZE_BASIC_FIELD(obj, offset, index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);      \
@@ -297,6 +373,14 @@ DEFINE_SERIALIZE_CONTAINER(AttestationData, SERIALIZE_ATTESTATION_DATA_FIELD);
     DESERIALIZE_CONTAINER_FIELD(obj, offset, target, deserialize_Checkpoint, SIZE_CHECKPOINT);
 DEFINE_DESERIALIZE_CONTAINER(AttestationData, DESERIALIZE_ATTESTATION_DATA_FIELD);
 
+#define HTR_ATTESTATION_DATA_FIELD                                                             \
+    HTR_BASIC_FIELD(obj, chunk_index, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);   \
+    HTR_BASIC_FIELD(obj, chunk_index, index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);  \
+    HTR_VECTOR_FIELD(obj, chunk_index, beacon_block_root);                                     \
+    HTR_CONTAINER_FIELD(obj, chunk_index, source, hash_tree_root_Checkpoint);                  \
+    HTR_CONTAINER_FIELD(obj, chunk_index, target, hash_tree_root_Checkpoint);
+DEFINE_HASH_TREE_ROOT_CONTAINER(AttestationData, 5, HTR_ATTESTATION_DATA_FIELD);
+
 #define SERIALIZE_PENDING_ATTESTATION_FIELD                                                                  \
     do                                                                                                       \
     {                                                                                                        \
@@ -307,7 +391,7 @@ DEFINE_DESERIALIZE_CONTAINER(AttestationData, DESERIALIZE_ATTESTATION_DATA_FIELD
         SERIALIZE_CONTAINER_FIELD(obj, offset, data, serialize_AttestationData, SIZE_ATTESTATION_DATA);      \
         SERIALIZE_BASIC_FIELD(obj, offset, inclusion_delay, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);  \
         SERIALIZE_BASIC_FIELD(obj, offset, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);   \
-        SERIALIZE_BITLIST_FIELD(obj, offset, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);                \
+        SERIALIZE_PACKED_BITLIST_FIELD(obj, offset, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);                \
     } while (0);
 DEFINE_SERIALIZE_CONTAINER(PendingAttestation, SERIALIZE_PENDING_ATTESTATION_FIELD);
 
@@ -318,9 +402,277 @@ DEFINE_SERIALIZE_CONTAINER(PendingAttestation, SERIALIZE_PENDING_ATTESTATION_FIE
     DESERIALIZE_BASIC_FIELD(obj, offset, inclusion_delay, ssz_deserialize_uint64);                      \
     DESERIALIZE_BASIC_FIELD(obj, offset, proposer_index, ssz_deserialize_uint64);                       \
     size_t agg_bits_size = data_size - agg_bits_offset;                                                 \
-    DESERIALIZE_BITLIST_FIELD(obj, agg_bits_offset, agg_bits_size, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);
+    DESERIALIZE_PACKED_BITLIST_FIELD_ARENA(obj, agg_bits_offset, agg_bits_size, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE, arena);
 DEFINE_DESERIALIZE_CONTAINER(PendingAttestation, DESERIALIZE_PENDING_ATTESTATION_FIELD);
 
+#define HTR_PENDING_ATTESTATION_FIELD                                                                    \
+    HTR_PACKED_BITLIST_FIELD(obj, chunk_index, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);                \
+    HTR_CONTAINER_FIELD(obj, chunk_index, data, hash_tree_root_AttestationData);                        \
+    HTR_BASIC_FIELD(obj, chunk_index, inclusion_delay, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    HTR_BASIC_FIELD(obj, chunk_index, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_HASH_TREE_ROOT_CONTAINER(PendingAttestation, 4, HTR_PENDING_ATTESTATION_FIELD);
+
+#define SIZE_PENDING_ATTESTATION_FIELD                   \
+    SIZE_BITLIST_FIELD(obj, size, aggregation_bits);        \
+    SIZE_FIXED_FIELD(size, SIZE_ATTESTATION_DATA);          \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64);        \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64);
+DEFINE_SIZE_CONTAINER(PendingAttestation, SIZE_PENDING_ATTESTATION_FIELD);
+
+#define HTR_BEACON_STATE_FIELDS                                                                                  \
+    HTR_BASIC_FIELD(obj, chunk_index, genesis_time, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);             \
+    HTR_VECTOR_FIELD(obj, chunk_index, genesis_validators_root);                                                 \
+    HTR_BASIC_FIELD(obj, chunk_index, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                     \
+    HTR_CONTAINER_FIELD(obj, chunk_index, fork, hash_tree_root_Fork);                                            \
+    HTR_CONTAINER_FIELD(obj, chunk_index, latest_block_header, hash_tree_root_BeaconBlockHeader);                \
+    HTR_VECTOR_ARRAY_FIELD(obj, chunk_index, block_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT);                 \
+    HTR_VECTOR_ARRAY_FIELD(obj, chunk_index, state_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT);                 \
+    HTR_LIST_FIELD(obj, chunk_index, historical_roots, SIZE_ROOT, HISTORICAL_ROOTS_LENGTH);                      \
+    HTR_CONTAINER_FIELD(obj, chunk_index, eth1_data, hash_tree_root_Eth1Data);                                   \
+    HTR_LIST_CONTAINER_FIELD(obj, chunk_index, eth1_data_votes,                                                  \
+                             EPOCHS_PER_ETH1_VOTING_PERIOD * SLOTS_PER_EPOCH, hash_tree_root_Eth1Data);          \
+    HTR_BASIC_FIELD(obj, chunk_index, eth1_deposit_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);       \
+    HTR_LIST_CONTAINER_FIELD(obj, chunk_index, validators, VALIDATOR_REGISTRY_LIMIT, hash_tree_root_Validator); \
+    HTR_LIST_FIELD(obj, chunk_index, balances, SSZ_BYTE_SIZE_OF_UINT64, VALIDATOR_REGISTRY_LIMIT);              \
+    HTR_VECTOR_ARRAY_FIELD(obj, chunk_index, randao_mixes, SIZE_ROOT, EPOCHS_PER_HISTORICAL_VECTOR);             \
+    HTR_VECTOR_FIELD(obj, chunk_index, slashings);                                                               \
+    HTR_LIST_CONTAINER_FIELD(obj, chunk_index, previous_epoch_attestations,                                      \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, hash_tree_root_PendingAttestation);            \
+    HTR_LIST_CONTAINER_FIELD(obj, chunk_index, current_epoch_attestations,                                       \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, hash_tree_root_PendingAttestation);            \
+    HTR_PACKED_BITVECTOR_FIELD(obj, chunk_index, justification_bits, JUSTIFICATION_BITS_LENGTH);                        \
+    HTR_CONTAINER_FIELD(obj, chunk_index, previous_justified_checkpoint, hash_tree_root_Checkpoint);             \
+    HTR_CONTAINER_FIELD(obj, chunk_index, current_justified_checkpoint, hash_tree_root_Checkpoint);              \
+    HTR_CONTAINER_FIELD(obj, chunk_index, finalized_checkpoint, hash_tree_root_Checkpoint);
+DEFINE_HASH_TREE_ROOT_CONTAINER(BeaconState, 21, HTR_BEACON_STATE_FIELDS);
+
+#define SIZE_BEACON_STATE_FIELDS                                                                           \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64);                                                       \
+    SIZE_FIXED_FIELD(size, SIZE_ROOT);                                                                     \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64);                                                       \
+    SIZE_FIXED_FIELD(size, SIZE_FORK);                                                                     \
+    SIZE_FIXED_FIELD(size, SIZE_BEACON_BLOCK_HEADER);                                                      \
+    SIZE_FIXED_FIELD(size, SIZE_BLOCK_ROOTS);                                                              \
+    SIZE_FIXED_FIELD(size, SIZE_STATE_ROOTS);                                                              \
+    SIZE_LIST_FIELD(obj, size, historical_roots, SIZE_ROOT);                                               \
+    SIZE_FIXED_FIELD(size, SIZE_ETH1_DATA);                                                                \
+    SIZE_LIST_FIELD(obj, size, eth1_data_votes, SIZE_ETH1_DATA);                                           \
+    SIZE_FIXED_FIELD(size, SSZ_BYTE_SIZE_OF_UINT64);                                                       \
+    SIZE_LIST_FIELD(obj, size, validators, SIZE_VALIDATOR);                                                \
+    SIZE_LIST_FIELD(obj, size, balances, SSZ_BYTE_SIZE_OF_UINT64);                                         \
+    SIZE_FIXED_FIELD(size, EPOCHS_PER_HISTORICAL_VECTOR * SIZE_ROOT);                                      \
+    SIZE_FIXED_FIELD(size, EPOCHS_PER_SLASHINGS_VECTOR * SSZ_BYTE_SIZE_OF_UINT64);                         \
+    SIZE_VARIABLE_LIST_CONTAINER_FIELD(obj, size, previous_epoch_attestations, ssz_size_PendingAttestation); \
+    SIZE_VARIABLE_LIST_CONTAINER_FIELD(obj, size, current_epoch_attestations, ssz_size_PendingAttestation);  \
+    SIZE_FIXED_FIELD(size, (JUSTIFICATION_BITS_LENGTH + 7) / SSZ_BITS_PER_BYTE);                           \
+    SIZE_FIXED_FIELD(size, SIZE_CHECKPOINT);                                                               \
+    SIZE_FIXED_FIELD(size, SIZE_CHECKPOINT);                                                               \
+    SIZE_FIXED_FIELD(size, SIZE_CHECKPOINT);
+DEFINE_SIZE_CONTAINER(BeaconState, SIZE_BEACON_STATE_FIELDS);
+
+#define STREAM_FORK_FIELDS                                                         \
+    STREAM_BYTES_FIELD(obj, previous_version, SIZE_VERSION);                       \
+    STREAM_BYTES_FIELD(obj, current_version, SIZE_VERSION);                        \
+    STREAM_BASIC_FIELD(obj, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_STREAM_CONTAINER(Fork, STREAM_FORK_FIELDS);
+
+#define STREAM_BEACON_BLOCK_HEADER_FIELDS                                                   \
+    STREAM_BASIC_FIELD(obj, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);           \
+    STREAM_BASIC_FIELD(obj, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    STREAM_BYTES_FIELD(obj, parent_root, SIZE_ROOT);                                        \
+    STREAM_BYTES_FIELD(obj, state_root, SIZE_ROOT);                                         \
+    STREAM_BYTES_FIELD(obj, body_root, SIZE_ROOT);
+DEFINE_STREAM_CONTAINER(BeaconBlockHeader, STREAM_BEACON_BLOCK_HEADER_FIELDS);
+
+#define STREAM_ETH1DATA_FIELDS                                                             \
+    STREAM_BYTES_FIELD(obj, deposit_root, SIZE_ROOT);                                      \
+    STREAM_BASIC_FIELD(obj, deposit_count, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    STREAM_BYTES_FIELD(obj, block_hash, SIZE_ROOT);
+DEFINE_STREAM_CONTAINER(Eth1Data, STREAM_ETH1DATA_FIELDS);
+
+#define STREAM_VALIDATOR_FIELDS                                                                           \
+    STREAM_BYTES_FIELD(obj, pubkey, SIZE_BLS_PUBKEY);                                                     \
+    STREAM_BYTES_FIELD(obj, withdrawal_credentials, SIZE_ROOT);                                           \
+    STREAM_BASIC_FIELD(obj, effective_balance, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);            \
+    STREAM_BASIC_FIELD(obj, slashed, SIZE_SLASHED, ssz_serialize_boolean);                                \
+    STREAM_BASIC_FIELD(obj, activation_eligibility_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    STREAM_BASIC_FIELD(obj, activation_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);             \
+    STREAM_BASIC_FIELD(obj, exit_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                   \
+    STREAM_BASIC_FIELD(obj, withdrawable_epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_STREAM_CONTAINER(Validator, STREAM_VALIDATOR_FIELDS);
+
+#define STREAM_CHECKPOINT_FIELDS                                                   \
+    STREAM_BASIC_FIELD(obj, epoch, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    STREAM_BYTES_FIELD(obj, root, SIZE_ROOT);
+DEFINE_STREAM_CONTAINER(Checkpoint, STREAM_CHECKPOINT_FIELDS);
+
+#define STREAM_ATTESTATION_DATA_FIELDS                                             \
+    STREAM_BASIC_FIELD(obj, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);  \
+    STREAM_BASIC_FIELD(obj, index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64); \
+    STREAM_BYTES_FIELD(obj, beacon_block_root, SIZE_ROOT);                         \
+    STREAM_CONTAINER_FIELD(obj, source, stream_Checkpoint, SIZE_CHECKPOINT);       \
+    STREAM_CONTAINER_FIELD(obj, target, stream_Checkpoint, SIZE_CHECKPOINT);
+DEFINE_STREAM_CONTAINER(AttestationData, STREAM_ATTESTATION_DATA_FIELDS);
+
+#define STREAM_PENDING_ATTESTATION_FIELDS                                                      \
+    STREAM_PACKED_BITLIST_FIELD(obj, aggregation_bits, MAX_VALIDATORS_PER_COMMITTEE);          \
+    STREAM_CONTAINER_FIELD(obj, data, stream_AttestationData, SIZE_ATTESTATION_DATA);          \
+    STREAM_BASIC_FIELD(obj, inclusion_delay, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);   \
+    STREAM_BASIC_FIELD(obj, proposer_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);
+DEFINE_STREAM_CONTAINER(PendingAttestation, STREAM_PENDING_ATTESTATION_FIELDS);
+
+#define STREAM_BEACON_STATE_FIELDS                                                                              \
+    STREAM_BASIC_FIELD(obj, genesis_time, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                       \
+    STREAM_BYTES_FIELD(obj, genesis_validators_root, SIZE_ROOT);                                                \
+    STREAM_BASIC_FIELD(obj, slot, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                               \
+    STREAM_CONTAINER_FIELD(obj, fork, stream_Fork, SIZE_FORK);                                                  \
+    STREAM_CONTAINER_FIELD(obj, latest_block_header, stream_BeaconBlockHeader, SIZE_BEACON_BLOCK_HEADER);       \
+    STREAM_BYTES_FIELD(obj, block_roots, SIZE_BLOCK_ROOTS);                                                     \
+    STREAM_BYTES_FIELD(obj, state_roots, SIZE_STATE_ROOTS);                                                     \
+    STREAM_LIST_FIELD(obj, historical_roots, SIZE_ROOT);                                                        \
+    STREAM_CONTAINER_FIELD(obj, eth1_data, stream_Eth1Data, SIZE_ETH1_DATA);                                    \
+    STREAM_LIST_CONTAINER_FIELD(obj, eth1_data_votes, stream_Eth1Data, SIZE_ETH1_DATA);                         \
+    STREAM_BASIC_FIELD(obj, eth1_deposit_index, SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_uint64);                 \
+    STREAM_LIST_CONTAINER_FIELD(obj, validators, stream_Validator, SIZE_VALIDATOR);                             \
+    STREAM_LIST_FIELD(obj, balances, SSZ_BYTE_SIZE_OF_UINT64);                                                  \
+    STREAM_BYTES_FIELD(obj, randao_mixes, EPOCHS_PER_HISTORICAL_VECTOR * SIZE_ROOT);                            \
+    STREAM_BYTES_FIELD(obj, slashings, EPOCHS_PER_SLASHINGS_VECTOR * SSZ_BYTE_SIZE_OF_UINT64);                  \
+    STREAM_VARIABLE_LIST_CONTAINER_FIELD(obj, previous_epoch_attestations, stream_PendingAttestation,           \
+                                         ssz_size_PendingAttestation);                                          \
+    STREAM_VARIABLE_LIST_CONTAINER_FIELD(obj, current_epoch_attestations, stream_PendingAttestation,            \
+                                         ssz_size_PendingAttestation);                                          \
+    STREAM_PACKED_BITVECTOR_FIELD(obj, justification_bits, JUSTIFICATION_BITS_LENGTH);                          \
+    STREAM_CONTAINER_FIELD(obj, previous_justified_checkpoint, stream_Checkpoint, SIZE_CHECKPOINT);             \
+    STREAM_CONTAINER_FIELD(obj, current_justified_checkpoint, stream_Checkpoint, SIZE_CHECKPOINT);              \
+    STREAM_CONTAINER_FIELD(obj, finalized_checkpoint, stream_Checkpoint, SIZE_CHECKPOINT);
+DEFINE_STREAM_CONTAINER(BeaconState, STREAM_BEACON_STATE_FIELDS);
+
+/* Byte positions of the BeaconState fields inside its fixed part */
+#define POS_GENESIS_TIME 0
+#define POS_SLOT (SSZ_BYTE_SIZE_OF_UINT64 + SIZE_ROOT)
+#define POS_FORK (POS_SLOT + SSZ_BYTE_SIZE_OF_UINT64)
+#define POS_LATEST_BLOCK_HEADER (POS_FORK + SIZE_FORK)
+#define POS_BLOCK_ROOTS (POS_LATEST_BLOCK_HEADER + SIZE_BEACON_BLOCK_HEADER)
+#define POS_STATE_ROOTS (POS_BLOCK_ROOTS + SIZE_BLOCK_ROOTS)
+#define POS_HISTORICAL_ROOTS (POS_STATE_ROOTS + SIZE_STATE_ROOTS)
+#define POS_ETH1_DATA (POS_HISTORICAL_ROOTS + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_ETH1_DATA_VOTES (POS_ETH1_DATA + SIZE_ETH1_DATA)
+#define POS_ETH1_DEPOSIT_INDEX (POS_ETH1_DATA_VOTES + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_VALIDATORS (POS_ETH1_DEPOSIT_INDEX + SSZ_BYTE_SIZE_OF_UINT64)
+#define POS_BALANCES (POS_VALIDATORS + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_RANDAO_MIXES (POS_BALANCES + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_SLASHINGS (POS_RANDAO_MIXES + EPOCHS_PER_HISTORICAL_VECTOR * SIZE_ROOT)
+#define POS_PREVIOUS_EPOCH_ATTESTATIONS (POS_SLASHINGS + EPOCHS_PER_SLASHINGS_VECTOR * SIZE_GWEI)
+#define POS_CURRENT_EPOCH_ATTESTATIONS (POS_PREVIOUS_EPOCH_ATTESTATIONS + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_JUSTIFICATION_BITS (POS_CURRENT_EPOCH_ATTESTATIONS + SSZ_BYTE_SIZE_OF_UINT32)
+#define POS_FINALIZED_CHECKPOINT (POS_JUSTIFICATION_BITS + 1 + SIZE_CHECKPOINT + SIZE_CHECKPOINT)
+
+DEFINE_VIEW_CONTAINER(Checkpoint, SIZE_CHECKPOINT, );
+DEFINE_VIEW_UINT_FIELD(Checkpoint, epoch, 0, 64);
+DEFINE_VIEW_BYTES_FIELD(Checkpoint, root, SSZ_BYTE_SIZE_OF_UINT64);
+
+#define VIEW_VALIDATOR_FIELDS \
+    VIEW_BOOLEAN_FIELD(SIZE_BLS_PUBKEY + SIZE_ROOT + SIZE_GWEI);
+DEFINE_VIEW_CONTAINER(Validator, SIZE_VALIDATOR, VIEW_VALIDATOR_FIELDS);
+DEFINE_VIEW_BYTES_FIELD(Validator, pubkey, 0);
+DEFINE_VIEW_UINT_FIELD(Validator, effective_balance, SIZE_BLS_PUBKEY + SIZE_ROOT, 64);
+DEFINE_VIEW_BOOLEAN_FIELD(Validator, slashed, SIZE_BLS_PUBKEY + SIZE_ROOT + SIZE_GWEI);
+DEFINE_VIEW_UINT_FIELD(Validator, exit_epoch, SIZE_BLS_PUBKEY + SIZE_ROOT + SIZE_GWEI + SIZE_SLASHED + 2 * SIZE_EPOCH, 64);
+
+#define VIEW_PENDING_ATTESTATION_FIELDS \
+    VIEW_BITLIST_FIELD(0, SSZ_VIEW_END, MAX_VALIDATORS_PER_COMMITTEE);
+DEFINE_VIEW_CONTAINER(PendingAttestation, SIZE_PENDING_ATTESTATION_FIXED, VIEW_PENDING_ATTESTATION_FIELDS);
+DEFINE_VIEW_VARIABLE_FIELD(PendingAttestation, aggregation_bits, 0, SSZ_VIEW_END);
+DEFINE_VIEW_FIXED_FIELD(PendingAttestation, data, SSZ_BYTE_SIZE_OF_UINT32, SIZE_ATTESTATION_DATA);
+DEFINE_VIEW_UINT_FIELD(PendingAttestation, inclusion_delay, SSZ_BYTE_SIZE_OF_UINT32 + SIZE_ATTESTATION_DATA, 64);
+DEFINE_VIEW_UINT_FIELD(PendingAttestation, proposer_index, SSZ_BYTE_SIZE_OF_UINT32 + SIZE_ATTESTATION_DATA + SSZ_BYTE_SIZE_OF_UINT64, 64);
+
+#define VIEW_BEACON_STATE_FIELDS                                                                                       \
+    VIEW_LIST_FIELD(POS_HISTORICAL_ROOTS, POS_ETH1_DATA_VOTES, SIZE_ROOT, HISTORICAL_ROOTS_LENGTH);                      \
+    VIEW_LIST_FIELD(POS_ETH1_DATA_VOTES, POS_VALIDATORS, SIZE_ETH1_DATA, EPOCHS_PER_ETH1_VOTING_PERIOD * SLOTS_PER_EPOCH); \
+    VIEW_LIST_FIELD(POS_VALIDATORS, POS_BALANCES, SIZE_VALIDATOR, VALIDATOR_REGISTRY_LIMIT);                             \
+    VIEW_LIST_FIELD(POS_BALANCES, POS_PREVIOUS_EPOCH_ATTESTATIONS, SIZE_GWEI, VALIDATOR_REGISTRY_LIMIT);                 \
+    VIEW_VARIABLE_LIST_FIELD(POS_PREVIOUS_EPOCH_ATTESTATIONS, POS_CURRENT_EPOCH_ATTESTATIONS,                           \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, ssz_view_PendingAttestation);                         \
+    VIEW_VARIABLE_LIST_FIELD(POS_CURRENT_EPOCH_ATTESTATIONS, SSZ_VIEW_END,                                              \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, ssz_view_PendingAttestation);
+DEFINE_VIEW_CONTAINER(BeaconState, SIZE_BEACON_STATE, VIEW_BEACON_STATE_FIELDS);
+
+#define VALIDATE_BEACON_STATE_FIELDS                                                                                   \
+    VIEW_LIST_FIELD(POS_HISTORICAL_ROOTS, POS_ETH1_DATA_VOTES, SIZE_ROOT, HISTORICAL_ROOTS_LENGTH);                      \
+    VIEW_LIST_FIELD(POS_ETH1_DATA_VOTES, POS_VALIDATORS, SIZE_ETH1_DATA, EPOCHS_PER_ETH1_VOTING_PERIOD * SLOTS_PER_EPOCH); \
+    VIEW_LIST_CONTAINER_FIELD(POS_VALIDATORS, POS_BALANCES, SIZE_VALIDATOR, VALIDATOR_REGISTRY_LIMIT,                    \
+                              ssz_view_Validator);                                                                     \
+    VIEW_LIST_FIELD(POS_BALANCES, POS_PREVIOUS_EPOCH_ATTESTATIONS, SIZE_GWEI, VALIDATOR_REGISTRY_LIMIT);                 \
+    VIEW_VARIABLE_LIST_FIELD(POS_PREVIOUS_EPOCH_ATTESTATIONS, POS_CURRENT_EPOCH_ATTESTATIONS,                           \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, ssz_view_PendingAttestation);                         \
+    VIEW_VARIABLE_LIST_FIELD(POS_CURRENT_EPOCH_ATTESTATIONS, SSZ_VIEW_END,                                              \
+                             MAX_ATTESTATIONS * SLOTS_PER_EPOCH, ssz_view_PendingAttestation);
+DEFINE_VALIDATE_CONTAINER(BeaconState, SIZE_BEACON_STATE, VALIDATE_BEACON_STATE_FIELDS);
+DEFINE_VIEW_UINT_FIELD(BeaconState, genesis_time, POS_GENESIS_TIME, 64);
+DEFINE_VIEW_UINT_FIELD(BeaconState, slot, POS_SLOT, 64);
+DEFINE_VIEW_BYTES_FIELD(BeaconState, block_roots, POS_BLOCK_ROOTS);
+DEFINE_VIEW_VARIABLE_FIELD(BeaconState, historical_roots, POS_HISTORICAL_ROOTS, POS_ETH1_DATA_VOTES);
+DEFINE_VIEW_VARIABLE_FIELD(BeaconState, validators, POS_VALIDATORS, POS_BALANCES);
+DEFINE_VIEW_VARIABLE_FIELD(BeaconState, balances, POS_BALANCES, POS_PREVIOUS_EPOCH_ATTESTATIONS);
+DEFINE_VIEW_VARIABLE_FIELD(BeaconState, previous_epoch_attestations, POS_PREVIOUS_EPOCH_ATTESTATIONS, POS_CURRENT_EPOCH_ATTESTATIONS);
+DEFINE_VIEW_VARIABLE_FIELD(BeaconState, current_epoch_attestations, POS_CURRENT_EPOCH_ATTESTATIONS, SSZ_VIEW_END);
+DEFINE_VIEW_FIXED_FIELD(BeaconState, finalized_checkpoint, POS_FINALIZED_CHECKPOINT, SIZE_CHECKPOINT);
+
+#define READER_STAGING_SIZE (64 * 1024)
+#define READER_MAX_CHUNK 1460
+#define STREAM_STAGING_SIZE (64 * 1024)
+#define STREAM_SCRATCH_SIZE (4 * 1024)
+#define STREAM_IOV_CAPACITY 64
+#define STREAM_ZERO_COPY_MIN 256
+
+typedef struct
+{
+    const uint8_t *expected;
+    size_t expected_size;
+    size_t position;
+    bool mismatch;
+} compare_sink_t;
+
+static ssz_error_t compare_sink(void *ctx, const uint8_t *data, size_t len)
+{
+    compare_sink_t *sink = ctx;
+    if (sink->position + len > sink->expected_size || memcmp(sink->expected + sink->position, data, len) != 0)
+    {
+        sink->mismatch = true;
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    sink->position += len;
+    return SSZ_SUCCESS;
+}
+
+typedef struct
+{
+    compare_sink_t compare;
+    const uint8_t *scratch;
+    size_t scratch_size;
+    size_t referenced;
+} compare_iov_sink_t;
+
+static ssz_error_t compare_iov_sink(void *ctx, const ssz_iovec_t *iov, size_t iov_count)
+{
+    compare_iov_sink_t *sink = ctx;
+    for (size_t i = 0; i < iov_count; i++)
+    {
+        const uint8_t *base = iov[i].base;
+        if (base < sink->scratch || base >= sink->scratch + sink->scratch_size)
+        {
+            sink->referenced += iov[i].len;
+        }
+        ssz_error_t err = compare_sink(&sink->compare, base, iov[i].len);
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
 typedef struct
 {
     char folder_name[256];
@@ -471,15 +823,15 @@ ssz_error_t serialize_BeaconState_object(const BeaconState *state, unsigned char
     SERIALIZE_VECTOR_FIELD(state, offset, slashings, EPOCHS_PER_SLASHINGS_VECTOR * SSZ_BYTE_SIZE_OF_UINT64, ssz_serialize_vector_uint64);
 
     // Serialize previous_epoch_attestations
-    uint32_t previous_epoch_attestations_offset;
-    SERIALIZE_VARIABLE_FIELD_OFFSET(state, previous_epoch_attestations_offset, offset, variable_offset, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, previous_epoch_attestations, serialize_PendingAttestation);
+    size_t previous_epoch_attestations_slot;
+    SERIALIZE_OFFSET_PLACEHOLDER(previous_epoch_attestations_slot, offset);
 
     // Serialize current_epoch_attestations
-    uint32_t current_epoch_attestations_offset;
-    SERIALIZE_VARIABLE_FIELD_OFFSET(state, current_epoch_attestations_offset, offset, variable_offset, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, current_epoch_attestations, serialize_PendingAttestation);
+    size_t current_epoch_attestations_slot;
+    SERIALIZE_OFFSET_PLACEHOLDER(current_epoch_attestations_slot, offset);
 
     // Serialize justification_bits
-    SERIALIZE_BITVECTOR_FIELD(state, offset, justification_bits, JUSTIFICATION_BITS_LENGTH);
+    SERIALIZE_PACKED_BITVECTOR_FIELD(state, offset, justification_bits, JUSTIFICATION_BITS_LENGTH);
 
     // Serialize previous_justified_checkpoint
     SERIALIZE_CONTAINER_FIELD(state, offset, previous_justified_checkpoint, serialize_Checkpoint, SIZE_CHECKPOINT);
@@ -503,53 +855,96 @@ ssz_error_t serialize_BeaconState_object(const BeaconState *state, unsigned char
     SERIALIZE_LIST_FIELD(state, offset, balances, SSZ_BYTE_SIZE_OF_UINT64); 
 
     // Serialize previous_epoch_attestations
-    SERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(state, previous_epoch_attestations_offset, previous_epoch_attestations, serialize_PendingAttestation);
+    SERIALIZE_VARIABLE_LIST_CONTAINER_FIELD(state, previous_epoch_attestations_slot, offset, previous_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, serialize_PendingAttestation);
 
     // Serialize current_epoch_attestations
-    SERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(state, current_epoch_attestations_offset, current_epoch_attestations, serialize_PendingAttestation);
+    SERIALIZE_VARIABLE_LIST_CONTAINER_FIELD(state, current_epoch_attestations_slot, offset, current_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, serialize_PendingAttestation);
 
-    *out_size = variable_offset;
+    *out_size = offset;
     return SSZ_SUCCESS;
 }
 
-ssz_error_t deserialize_BeaconState_object(const unsigned char *data, size_t data_size, BeaconState *state)
+#define BEACON_STATE_FIELD_NAMES(X, T) \
+    X(T, genesis_time)                 \
+    X(T, genesis_validators_root)      \
+    X(T, slot)                         \
+    X(T, fork)                         \
+    X(T, latest_block_header)          \
+    X(T, block_roots)                  \
+    X(T, state_roots)                  \
+    X(T, historical_roots)             \
+    X(T, eth1_data)                    \
+    X(T, eth1_data_votes)              \
+    X(T, eth1_deposit_index)           \
+    X(T, validators)                   \
+    X(T, balances)                     \
+    X(T, randao_mixes)                 \
+    X(T, slashings)                    \
+    X(T, previous_epoch_attestations)  \
+    X(T, current_epoch_attestations)   \
+    X(T, justification_bits)           \
+    X(T, previous_justified_checkpoint) \
+    X(T, current_justified_checkpoint) \
+    X(T, finalized_checkpoint)
+DEFINE_FIELD_ENUM(BeaconState, BEACON_STATE_FIELD_NAMES);
+
+ssz_error_t deserialize_BeaconState_partial(const unsigned char *data, size_t data_size, BeaconState *state,
+                                            ssz_arena_t *arena, ssz_field_mask_t fields)
 {
     size_t offset = 0;
 
     // Deserialize genesis_time
-    DESERIALIZE_BASIC_FIELD(state, offset, genesis_time, ssz_deserialize_uint64);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, genesis_time,
+                               DESERIALIZE_BASIC_FIELD(state, offset, genesis_time, ssz_deserialize_uint64),
+                               SKIP_FIXED_FIELD(offset, SSZ_BYTE_SIZE_OF_UINT64));
 
     // Deserialize genesis_validators_root
-    DESERIALIZE_VECTOR_FIELD(state, offset, genesis_validators_root, ssz_deserialize_vector_uint8);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, genesis_validators_root,
+                               DESERIALIZE_VECTOR_FIELD(state, offset, genesis_validators_root, ssz_deserialize_vector_uint8),
+                               SKIP_FIXED_FIELD(offset, SIZE_ROOT));
 
     // Deserialize slot
-    DESERIALIZE_BASIC_FIELD(state, offset, slot, ssz_deserialize_uint64);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, slot,
+                               DESERIALIZE_BASIC_FIELD(state, offset, slot, ssz_deserialize_uint64),
+                               SKIP_FIXED_FIELD(offset, SIZE_SLOT));
 
     // Deserialize fork
-    DESERIALIZE_CONTAINER_FIELD(state, offset, fork, deserialize_Fork, SIZE_FORK);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, fork,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, fork, deserialize_Fork, SIZE_FORK),
+                               SKIP_FIXED_FIELD(offset, SIZE_FORK));
 
     // Deserialize latest_block_header
-    DESERIALIZE_CONTAINER_FIELD(state, offset, latest_block_header, deserialize_BeaconBlockHeader, SIZE_BEACON_BLOCK_HEADER);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, latest_block_header,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, latest_block_header, deserialize_BeaconBlockHeader, SIZE_BEACON_BLOCK_HEADER),
+                               SKIP_FIXED_FIELD(offset, SIZE_BEACON_BLOCK_HEADER));
 
     // Deserialize block_roots
-    DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, block_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT, ssz_deserialize_vector_uint8);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, block_roots,
+                               DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, block_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT, ssz_deserialize_vector_uint8),
+                               SKIP_FIXED_FIELD(offset, SIZE_BLOCK_ROOTS));
 
     // Deserialize state_roots
-    DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, state_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT, ssz_deserialize_vector_uint8);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, state_roots,
+                               DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, state_roots, SIZE_ROOT, SLOTS_PER_HISTORICAL_ROOT, ssz_deserialize_vector_uint8),
+                               SKIP_FIXED_FIELD(offset, SIZE_STATE_ROOTS));
 
     // Deserialize historical_roots offset
     uint32_t historical_roots_offset;
     DESERIALIZE_OFFSET_FIELD(historical_roots_offset, offset);
 
     // Deserialize eth1_data
-    DESERIALIZE_CONTAINER_FIELD(state, offset, eth1_data, deserialize_Eth1Data, SIZE_ETH1_DATA);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, eth1_data,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, eth1_data, deserialize_Eth1Data, SIZE_ETH1_DATA),
+                               SKIP_FIXED_FIELD(offset, SIZE_ETH1_DATA));
 
     // Deserialize eth1_data_votes
     uint32_t eth1_data_votes_offset;
     DESERIALIZE_OFFSET_FIELD(eth1_data_votes_offset, offset);
 
     // Deserialize eth1_deposit_index
-    DESERIALIZE_BASIC_FIELD(state, offset, eth1_deposit_index, ssz_deserialize_uint64);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, eth1_deposit_index,
+                               DESERIALIZE_BASIC_FIELD(state, offset, eth1_deposit_index, ssz_deserialize_uint64),
+                               SKIP_FIXED_FIELD(offset, SSZ_BYTE_SIZE_OF_UINT64));
 
     // Deserialize validators offset
     uint32_t validators_offset;
@@ -560,10 +955,14 @@ ssz_error_t deserialize_BeaconState_object(const unsigned char *data, size_t dat
     DESERIALIZE_OFFSET_FIELD(balances_offset, offset);
 
     // Deserialize randao_mixes
-    DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, randao_mixes, SIZE_ROOT, EPOCHS_PER_HISTORICAL_VECTOR, ssz_deserialize_vector_uint8);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, randao_mixes,
+                               DESERIALIZE_VECTOR_ARRAY_FIELD(state, offset, randao_mixes, SIZE_ROOT, EPOCHS_PER_HISTORICAL_VECTOR, ssz_deserialize_vector_uint8),
+                               SKIP_FIXED_FIELD(offset, SIZE_ROOT * EPOCHS_PER_HISTORICAL_VECTOR));
 
     // Deserialize slashings
-    DESERIALIZE_VECTOR_FIELD(state, offset, slashings, ssz_deserialize_vector_uint64);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, slashings,
+                               DESERIALIZE_VECTOR_FIELD(state, offset, slashings, ssz_deserialize_vector_uint64),
+                               SKIP_FIXED_FIELD(offset, SIZE_GWEI * EPOCHS_PER_SLASHINGS_VECTOR));
 
     // Deserialize previous_epoch_attestations offset
     uint32_t previous_epoch_attestations_offset;
@@ -574,61 +973,696 @@ ssz_error_t deserialize_BeaconState_object(const unsigned char *data, size_t dat
     DESERIALIZE_OFFSET_FIELD(current_epoch_attestations_offset, offset);
 
     // Deserialize justification_bits
-    DESERIALIZE_BITVECTOR_FIELD(state, offset, justification_bits, JUSTIFICATION_BITS_LENGTH);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, justification_bits,
+                               DESERIALIZE_PACKED_BITVECTOR_FIELD(state, offset, justification_bits, JUSTIFICATION_BITS_LENGTH),
+                               SKIP_FIXED_FIELD(offset, (JUSTIFICATION_BITS_LENGTH + 7) / SSZ_BITS_PER_BYTE));
 
     // Deserialize previous_justified_checkpoint
-    DESERIALIZE_CONTAINER_FIELD(state, offset, previous_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, previous_justified_checkpoint,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, previous_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT),
+                               SKIP_FIXED_FIELD(offset, SIZE_CHECKPOINT));
 
     // Deserialize current_justified_checkpoint
-    DESERIALIZE_CONTAINER_FIELD(state, offset, current_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, current_justified_checkpoint,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, current_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT),
+                               SKIP_FIXED_FIELD(offset, SIZE_CHECKPOINT));
 
     // Deserialize finalized_checkpoint
-    DESERIALIZE_CONTAINER_FIELD(state, offset, finalized_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, finalized_checkpoint,
+                               DESERIALIZE_CONTAINER_FIELD(state, offset, finalized_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT),
+                               SKIP_FIXED_FIELD(offset, SIZE_CHECKPOINT));
+
+    if (historical_roots_offset != offset || eth1_data_votes_offset < historical_roots_offset ||
+        validators_offset < eth1_data_votes_offset || balances_offset < validators_offset ||
+        previous_epoch_attestations_offset < balances_offset ||
+        current_epoch_attestations_offset < previous_epoch_attestations_offset ||
+        current_epoch_attestations_offset > data_size)
+    {
+        return SSZ_ERROR_DESERIALIZATION;
+    }
 
     // Deserialize historical_roots
     size_t historical_roots_size = eth1_data_votes_offset - historical_roots_offset;
-    DESERIALIZE_LIST_FIELD(state, historical_roots_offset, historical_roots_size, historical_roots, HISTORICAL_ROOTS_LENGTH, ssz_deserialize_list_uint256);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, historical_roots,
+                               DESERIALIZE_LIST_FIELD_ARENA(state, historical_roots_offset, historical_roots_size, historical_roots, HISTORICAL_ROOTS_LENGTH, ssz_deserialize_list_uint256, arena),
+                               SKIP_LIST_FIELD(state, historical_roots_offset, historical_roots_size, historical_roots, SIZE_ROOT, HISTORICAL_ROOTS_LENGTH));
 
     // Deserialize eth1_data_votes
     size_t eth1_data_votes_size = validators_offset - eth1_data_votes_offset;
-    DESERIALIZE_LIST_CONTAINER_FIELD(state, eth1_data_votes_offset, eth1_data_votes_size, eth1_data_votes, deserialize_Eth1DataVotes);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, eth1_data_votes,
+                               DESERIALIZE_LIST_CONTAINER_FIELD_ARENA(state, eth1_data_votes_offset, eth1_data_votes_size, eth1_data_votes, deserialize_Eth1DataVotes_arena, arena),
+                               SKIP_LIST_FIELD(state, eth1_data_votes_offset, eth1_data_votes_size, eth1_data_votes, SIZE_ETH1_DATA, EPOCHS_PER_ETH1_VOTING_PERIOD * SLOTS_PER_EPOCH));
 
     // Deserialize validators
     size_t validators_size = balances_offset - validators_offset;
-    DESERIALIZE_LIST_CONTAINER_FIELD(state, validators_offset, validators_size, validators, deserialize_Validators);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, validators,
+                               DESERIALIZE_LIST_CONTAINER_FIELD_ARENA(state, validators_offset, validators_size, validators, deserialize_Validators_arena, arena),
+                               SKIP_LIST_FIELD(state, validators_offset, validators_size, validators, SIZE_VALIDATOR, VALIDATOR_REGISTRY_LIMIT));
 
     // Deserialize balances
     size_t balances_size = previous_epoch_attestations_offset - balances_offset;
-    DESERIALIZE_LIST_FIELD(state, balances_offset, balances_size, balances, VALIDATOR_REGISTRY_LIMIT, ssz_deserialize_list_uint64);
+    DESERIALIZE_SELECTED_FIELD(BeaconState, balances,
+                               DESERIALIZE_LIST_FIELD_ARENA(state, balances_offset, balances_size, balances, VALIDATOR_REGISTRY_LIMIT, ssz_deserialize_list_uint64, arena),
+                               SKIP_LIST_FIELD(state, balances_offset, balances_size, balances, SIZE_GWEI, VALIDATOR_REGISTRY_LIMIT));
 
     // Deserialize previous_epoch_attestations
     size_t previous_epoch_attestations_size = current_epoch_attestations_offset - previous_epoch_attestations_offset;
 
-    if (previous_epoch_attestations_size == 0)
+    DESERIALIZE_SELECTED_FIELD(BeaconState, previous_epoch_attestations,
+                               DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD_ARENA(state, previous_epoch_attestations_offset, previous_epoch_attestations_size, previous_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation_arena, arena),
+                               SKIP_VARIABLE_LIST_FIELD(state, previous_epoch_attestations_offset, previous_epoch_attestations_size, previous_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH));
+
+    // Deserialize current_epoch_attestations
+    size_t current_epoch_attestations_size = data_size - current_epoch_attestations_offset;
+    DESERIALIZE_SELECTED_FIELD(BeaconState, current_epoch_attestations,
+                               DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD_ARENA(state, current_epoch_attestations_offset, current_epoch_attestations_size, current_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation_arena, arena),
+                               SKIP_VARIABLE_LIST_FIELD(state, current_epoch_attestations_offset, current_epoch_attestations_size, current_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH));
+
+    return SSZ_SUCCESS;
+}
+
+ssz_error_t deserialize_BeaconState_object_arena(const unsigned char *data, size_t data_size, BeaconState *state,
+                                                 ssz_arena_t *arena)
+{
+    return deserialize_BeaconState_partial(data, data_size, state, arena, SSZ_FIELDS_ALL);
+}
+
+ssz_error_t deserialize_BeaconState_object(const unsigned char *data, size_t data_size, BeaconState *state)
+{
+    return deserialize_BeaconState_object_arena(data, data_size, state, NULL);
+}
+
+#define READ_BEACON_STATE_FIELDS                                                                                                                              \
+    READ_FIELD(SSZ_BYTE_SIZE_OF_UINT64, DESERIALIZE_BASIC_FIELD(obj, offset, genesis_time, ssz_deserialize_uint64));                                          \
+    READ_BYTES_FIELD(obj, genesis_validators_root);                                                                                                           \
+    READ_FIELD(SIZE_SLOT, DESERIALIZE_BASIC_FIELD(obj, offset, slot, ssz_deserialize_uint64));                                                                \
+    READ_FIELD(SIZE_FORK, DESERIALIZE_CONTAINER_FIELD(obj, offset, fork, deserialize_Fork, SIZE_FORK));                                                       \
+    READ_FIELD(SIZE_BEACON_BLOCK_HEADER,                                                                                                                      \
+               DESERIALIZE_CONTAINER_FIELD(obj, offset, latest_block_header, deserialize_BeaconBlockHeader, SIZE_BEACON_BLOCK_HEADER));                       \
+    READ_BYTES_FIELD(obj, block_roots);                                                                                                                       \
+    READ_BYTES_FIELD(obj, state_roots);                                                                                                                       \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_FIELD(SIZE_ETH1_DATA, DESERIALIZE_CONTAINER_FIELD(obj, offset, eth1_data, deserialize_Eth1Data, SIZE_ETH1_DATA));                                    \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_FIELD(SSZ_BYTE_SIZE_OF_UINT64, DESERIALIZE_BASIC_FIELD(obj, offset, eth1_deposit_index, ssz_deserialize_uint64));                                    \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_BYTES_FIELD(obj, randao_mixes);                                                                                                                      \
+    READ_FIELD(SIZE_GWEI * EPOCHS_PER_SLASHINGS_VECTOR, DESERIALIZE_VECTOR_FIELD(obj, offset, slashings, ssz_deserialize_vector_uint64));                     \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_OFFSET_FIELD();                                                                                                                                      \
+    READ_FIELD((JUSTIFICATION_BITS_LENGTH + 7) / SSZ_BITS_PER_BYTE,                                                                                           \
+               DESERIALIZE_PACKED_BITVECTOR_FIELD(obj, offset, justification_bits, JUSTIFICATION_BITS_LENGTH));                                               \
+    READ_FIELD(SIZE_CHECKPOINT, DESERIALIZE_CONTAINER_FIELD(obj, offset, previous_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT));            \
+    READ_FIELD(SIZE_CHECKPOINT, DESERIALIZE_CONTAINER_FIELD(obj, offset, current_justified_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT));             \
+    READ_FIELD(SIZE_CHECKPOINT, DESERIALIZE_CONTAINER_FIELD(obj, offset, finalized_checkpoint, deserialize_Checkpoint, SIZE_CHECKPOINT));                     \
+    READ_VARIABLE_FIELD(DESERIALIZE_LIST_FIELD_ARENA(obj, start, data_size, historical_roots, HISTORICAL_ROOTS_LENGTH, ssz_deserialize_list_uint256, arena)); \
+    READ_LIST_ELEMENTS_FIELD(obj, eth1_data_votes, SIZE_ETH1_DATA, EPOCHS_PER_ETH1_VOTING_PERIOD * SLOTS_PER_EPOCH, deserialize_Eth1Data);                    \
+    READ_LIST_ELEMENTS_FIELD(obj, validators, SIZE_VALIDATOR, VALIDATOR_REGISTRY_LIMIT, deserialize_Validator);                                               \
+    READ_LIST_ELEMENTS_FIELD(obj, balances, SIZE_GWEI, VALIDATOR_REGISTRY_LIMIT, ssz_deserialize_uint64);                                                     \
+    READ_VARIABLE_FIELD(DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD_ARENA(obj, start, data_size, previous_epoch_attestations,                                   \
+                                                                        MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation_arena, arena));    \
+    READ_VARIABLE_FIELD(DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD_ARENA(obj, start, data_size, current_epoch_attestations,                                    \
+                                                                        MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation_arena, arena));
+DEFINE_READ_CONTAINER(BeaconState, READ_BEACON_STATE_FIELDS);
+
+static bool view_matches_attestations(const ssz_view_t *list, const EpochAttestations *expected)
+{
+    if (ssz_view_variable_list_length(list) != expected->length)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < expected->length; i++)
+    {
+        const PendingAttestation *att = &expected->data[i];
+        ssz_view_t element;
+        if (ssz_view_variable_list_element(list, i, &element) != SSZ_SUCCESS)
+        {
+            return false;
+        }
+        ssz_view_t bits = ssz_view_PendingAttestation_aggregation_bits(&element);
+        ssz_view_t data = ssz_view_PendingAttestation_data(&element);
+        if (ssz_view_PendingAttestation_inclusion_delay(&element) != att->inclusion_delay ||
+            ssz_view_PendingAttestation_proposer_index(&element) != att->proposer_index ||
+            bits.size != att->aggregation_bits.length / SSZ_BITS_PER_BYTE + 1 ||
+            ssz_view_uint64(&data, 0) != att->data.slot)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_view_BeaconState(const BeaconState *state, unsigned char *data, size_t data_size)
+{
+    ssz_view_t view;
+    bool ok = ssz_view_BeaconState(data, data_size, &view) == SSZ_SUCCESS;
+    ok = ok && ssz_view_BeaconState_genesis_time(&view) == state->genesis_time &&
+         ssz_view_BeaconState_slot(&view) == state->slot &&
+         memcmp(ssz_view_BeaconState_block_roots(&view), state->block_roots, SIZE_BLOCK_ROOTS) == 0;
+    if (ok)
+    {
+        ssz_view_t checkpoint = ssz_view_BeaconState_finalized_checkpoint(&view);
+        ssz_view_t historical_roots = ssz_view_BeaconState_historical_roots(&view);
+        ok = ssz_view_Checkpoint_epoch(&checkpoint) == state->finalized_checkpoint.epoch &&
+             memcmp(ssz_view_Checkpoint_root(&checkpoint), state->finalized_checkpoint.root, SIZE_ROOT) == 0 &&
+             ssz_view_list_length(&historical_roots, SIZE_ROOT) == state->historical_roots.length;
+    }
+    if (ok)
+    {
+        ssz_view_t validators = ssz_view_BeaconState_validators(&view);
+        ssz_view_t balances = ssz_view_BeaconState_balances(&view);
+        ok = ssz_view_list_length(&validators, SIZE_VALIDATOR) == state->validators.length &&
+             ssz_view_list_length(&balances, SIZE_GWEI) == state->balances.length;
+        for (size_t i = 0; ok && i < state->validators.length; i++)
+        {
+            const Validator *expected = &state->validators.data[i];
+            ssz_view_t validator;
+            ok = ssz_view_list_element(&validators, SIZE_VALIDATOR, i, &validator) == SSZ_SUCCESS &&
+                 ssz_view_Validator_effective_balance(&validator) == expected->effective_balance &&
+                 ssz_view_Validator_slashed(&validator) == expected->slashed &&
+                 ssz_view_Validator_exit_epoch(&validator) == expected->exit_epoch &&
+                 memcmp(ssz_view_Validator_pubkey(&validator), expected->pubkey, SIZE_BLS_PUBKEY) == 0;
+        }
+        for (size_t i = 0; ok && i < state->balances.length; i++)
+        {
+            ok = ssz_view_uint64(&balances, i * SIZE_GWEI) == state->balances.data[i];
+        }
+    }
+    if (ok)
+    {
+        ssz_view_t previous = ssz_view_BeaconState_previous_epoch_attestations(&view);
+        ssz_view_t current = ssz_view_BeaconState_current_epoch_attestations(&view);
+        ok = view_matches_attestations(&previous, &state->previous_epoch_attestations) &&
+             view_matches_attestations(&current, &state->current_epoch_attestations);
+    }
+    if (ok)
+    {
+        printf("  OK: ssz_view_BeaconState reads every checked field straight from the buffer.\n");
+    }
+    else
+    {
+        printf("  FAIL: ssz_view_BeaconState returned a field that differs from the decoded state.\n");
+    }
+
+    uint8_t saved = data[POS_VALIDATORS];
+    data[POS_VALIDATORS] = (uint8_t)(saved + 1);
+    bool rejected = ssz_view_BeaconState(data, data_size, &view) != SSZ_SUCCESS;
+    data[POS_VALIDATORS] = saved;
+    rejected = rejected && ssz_view_BeaconState(data, SIZE_BEACON_STATE - 1, &view) != SSZ_SUCCESS;
+    if (rejected)
     {
-        state->previous_epoch_attestations.length = 0;
-        state->previous_epoch_attestations.data = NULL;
+        printf("  OK: ssz_view_BeaconState rejects a shifted offset and a truncated buffer.\n");
     }
     else
     {
-        DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(state, previous_epoch_attestations_offset, previous_epoch_attestations_size, previous_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation);
+        printf("  FAIL: ssz_view_BeaconState accepted a malformed buffer.\n");
     }
+}
 
-    // Deserialize current_epoch_attestations
-    size_t current_epoch_attestations_size = data_size - current_epoch_attestations_offset;
-    if (current_epoch_attestations_size == 0)
+static void test_arena_BeaconState(const unsigned char *data, size_t data_size)
+{
+    ssz_arena_t arena;
+    BeaconState *copy = malloc(sizeof(BeaconState));
+    unsigned char *reserialized = malloc(data_size);
+    bool ok = copy != NULL && reserialized != NULL;
+    size_t first_capacity = 0;
+    ssz_arena_init(&arena, 0);
+    for (int round = 0; ok && round < 2; round++)
+    {
+        size_t reserialized_size = 0;
+        ssz_arena_reset(&arena);
+        ok = deserialize_BeaconState_object_arena(data, data_size, copy, &arena) == SSZ_SUCCESS &&
+             ssz_size_BeaconState(copy) == data_size &&
+             serialize_BeaconState_object(copy, reserialized, &reserialized_size) == SSZ_SUCCESS &&
+             reserialized_size == data_size && memcmp(reserialized, data, data_size) == 0;
+        if (round == 0)
+        {
+            first_capacity = ssz_arena_capacity(&arena);
+        }
+    }
+    ok = ok && ssz_arena_capacity(&arena) == first_capacity;
+    if (ok)
     {
-        state->current_epoch_attestations.length = 0;
-        state->current_epoch_attestations.data = NULL;
+        printf("  OK: Arena-backed decode round-trips and reuses its %zu-byte arena after reset.\n", first_capacity);
     }
     else
     {
-        DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(state, current_epoch_attestations_offset, current_epoch_attestations_size, current_epoch_attestations, MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation);
+        printf("  FAIL: Arena-backed decode did not round-trip or grew after reset.\n");
     }
+    ssz_arena_free(&arena);
+    free(reserialized);
+    free(copy);
+}
 
+static void test_bad_offsets_BeaconState(const unsigned char *data, size_t data_size)
+{
+    ssz_view_t view;
+    ssz_arena_t arena;
+    BeaconState *copy = malloc(sizeof(BeaconState));
+    unsigned char *corrupt = malloc(data_size);
+    bool ok = copy != NULL && corrupt != NULL && ssz_view_BeaconState(data, data_size, &view) == SSZ_SUCCESS;
+    size_t list_start = 0, list_size = 0;
+    printf("Testing deserialize_BeaconState_object_arena with corrupt attestation offsets...\n");
+    if (ok)
+    {
+        ssz_view_t lists[2] = {ssz_view_BeaconState_previous_epoch_attestations(&view),
+                               ssz_view_BeaconState_current_epoch_attestations(&view)};
+        for (int i = 0; i < 2; i++)
+        {
+            if (list_size == 0 && ssz_view_variable_list_length(&lists[i]) >= 2)
+            {
+                list_start = (size_t)(lists[i].data - data);
+                list_size = lists[i].size;
+            }
+        }
+    }
+    if (ok && list_size == 0)
+    {
+        printf("  OK: No attestation list with two elements to corrupt.\n");
+    }
+    else if (ok)
+    {
+        uint32_t first = 0;
+        ssz_deserialize_uint32(data + list_start, sizeof(uint32_t), &first);
+        const struct
+        {
+            size_t position;
+            uint32_t value;
+        } cases[] = {
+            {0, first + 1},                             /* not a multiple of the offset size */
+            {0, (uint32_t)list_size + 4},               /* past the end of the list */
+            {SSZ_BYTES_PER_LENGTH_OFFSET, first - 1},   /* before the first element */
+            {SSZ_BYTES_PER_LENGTH_OFFSET, UINT32_MAX},  /* past the end of the list */
+        };
+        ssz_arena_init(&arena, 0);
+        for (size_t i = 0; ok && i < sizeof(cases) / sizeof(cases[0]); i++)
+        {
+            size_t value_size = sizeof(uint32_t);
+            memcpy(corrupt, data, data_size);
+            ssz_serialize_uint32(&cases[i].value, corrupt + list_start + cases[i].position, &value_size);
+            ssz_arena_reset(&arena);
+            ok = deserialize_BeaconState_object_arena(corrupt, data_size, copy, &arena) == SSZ_ERROR_DESERIALIZATION;
+        }
+        ssz_arena_free(&arena);
+        if (ok)
+        {
+            printf("  OK: Corrupt offsets rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: A corrupt offset was accepted.\n");
+        }
+    }
+    else
+    {
+        printf("  FAIL: Could not view the fixture.\n");
+    }
+    free(corrupt);
+    free(copy);
+}
+
+static ssz_error_t deserialize_previous_epoch_attestations(const unsigned char *data, size_t data_size,
+                                                           BeaconState *state)
+{
+    DESERIALIZE_LIST_VARIABLE_CONTAINER_FIELD(state, 0, data_size, previous_epoch_attestations,
+                                              MAX_ATTESTATIONS * SLOTS_PER_EPOCH, deserialize_PendingAttestation);
     return SSZ_SUCCESS;
 }
 
+static void test_empty_attestations_BeaconState(const BeaconState *state, size_t data_size)
+{
+    BeaconState *empty = malloc(sizeof(BeaconState));
+    BeaconState *copy = malloc(sizeof(BeaconState));
+    unsigned char *serialized = malloc(data_size);
+    unsigned char *reserialized = malloc(data_size);
+    size_t serialized_size = 0, reserialized_size = 0;
+    bool ok = empty != NULL && copy != NULL && serialized != NULL && reserialized != NULL;
+    printf("Testing deserialize_BeaconState_object with empty previous_epoch_attestations...\n");
+    if (ok)
+    {
+        *empty = *state;
+        empty->previous_epoch_attestations.length = 0;
+        empty->previous_epoch_attestations.data = NULL;
+        ok = serialize_BeaconState_object(empty, serialized, &serialized_size) == SSZ_SUCCESS &&
+             deserialize_BeaconState_object(serialized, serialized_size, copy) == SSZ_SUCCESS &&
+             copy->previous_epoch_attestations.length == 0 && copy->previous_epoch_attestations.data == NULL &&
+             copy->current_epoch_attestations.length == state->current_epoch_attestations.length &&
+             serialize_BeaconState_object(copy, reserialized, &reserialized_size) == SSZ_SUCCESS &&
+             reserialized_size == serialized_size && memcmp(reserialized, serialized, serialized_size) == 0;
+        copy->previous_epoch_attestations.length = 1;
+        ok = ok && deserialize_previous_epoch_attestations(serialized, 0, copy) == SSZ_SUCCESS &&
+             copy->previous_epoch_attestations.length == 0 && copy->previous_epoch_attestations.data == NULL;
+    }
+    if (ok)
+    {
+        printf("  OK: Empty list decoded and round-tripped.\n");
+    }
+    else
+    {
+        printf("  FAIL: Empty list rejected or decoded wrong.\n");
+    }
+    free(reserialized);
+    free(serialized);
+    free(copy);
+    free(empty);
+}
+
+static void test_dirty_bits_BeaconState(const BeaconState *state, const unsigned char *data, size_t data_size)
+{
+    printf("Testing stream_PendingAttestation with bits set past the bitlist length...\n");
+    {
+        static uint64_t words[SSZ_BITFIELD_WORDS(MAX_VALIDATORS_PER_COMMITTEE)];
+        static uint8_t serialized[SIZE_PENDING_ATTESTATION_FIXED + MAX_VALIDATORS_PER_COMMITTEE / SSZ_BITS_PER_BYTE + 1];
+        static uint8_t staging[STREAM_STAGING_SIZE];
+        PendingAttestation att = {0};
+        size_t serialized_size = 0;
+        memset(words, 0xFF, sizeof(words));
+        att.aggregation_bits.words = words;
+        att.aggregation_bits.length = 3;
+        ssz_error_t err = serialize_PendingAttestation(&att, serialized, &serialized_size);
+        compare_sink_t sink = {serialized, serialized_size, 0, false};
+        ssz_writer_t writer;
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_init(&writer, staging, sizeof(staging), compare_sink, &sink);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = stream_PendingAttestation(&att, &writer);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_flush(&writer);
+        }
+        if (err == SSZ_SUCCESS && !sink.mismatch && sink.position == serialized_size &&
+            serialized[serialized_size - 1] == 0x0F)
+        {
+            printf("  OK: Stray bits masked and the stream matches serialize_PendingAttestation.\n");
+        }
+        else
+        {
+            printf("  FAIL: Streamed bitlist differs from serialize_PendingAttestation.\n");
+        }
+    }
+
+    printf("Testing stream_BeaconState with bits set past the bitvector length...\n");
+    {
+        static uint8_t staging[STREAM_STAGING_SIZE];
+        BeaconState *dirty = malloc(sizeof(BeaconState));
+        unsigned char *serialized = malloc(data_size);
+        size_t serialized_size = 0;
+        ssz_error_t err = dirty != NULL && serialized != NULL ? SSZ_SUCCESS : SSZ_ERROR_SERIALIZATION;
+        compare_sink_t sink = {data, data_size, 0, false};
+        ssz_writer_t writer;
+        if (err == SSZ_SUCCESS)
+        {
+            *dirty = *state;
+            dirty->justification_bits[0] |= ~(uint64_t)0 << JUSTIFICATION_BITS_LENGTH;
+            err = serialize_BeaconState_object(dirty, serialized, &serialized_size);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_init(&writer, staging, sizeof(staging), compare_sink, &sink);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = stream_BeaconState(dirty, &writer);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_flush(&writer);
+        }
+        if (err == SSZ_SUCCESS && !sink.mismatch && sink.position == data_size && serialized_size == data_size &&
+            memcmp(serialized, data, data_size) == 0)
+        {
+            printf("  OK: Stray bits masked and the stream matches serialize_BeaconState_object.\n");
+        }
+        else
+        {
+            printf("  FAIL: Streamed bitvector differs from serialize_BeaconState_object.\n");
+        }
+        free(serialized);
+        free(dirty);
+    }
+}
+
+static void test_partial_BeaconState(const BeaconState *state, const unsigned char *data, size_t data_size)
+{
+    const ssz_field_mask_t fields = SSZ_FIELD_BIT(BeaconState, slot) |
+                                    SSZ_FIELD_BIT(BeaconState, latest_block_header) |
+                                    SSZ_FIELD_BIT(BeaconState, validators);
+    ssz_arena_t arena;
+    BeaconState *partial = malloc(sizeof(BeaconState));
+    bool ok = partial != NULL;
+    printf("Testing deserialize_BeaconState_partial with a field mask...\n");
+    ssz_arena_init(&arena, 0);
+    if (ok)
+    {
+        memset(partial, 0xAB, sizeof(BeaconState));
+        ok = deserialize_BeaconState_partial(data, data_size, partial, &arena, fields) == SSZ_SUCCESS &&
+             partial->slot == state->slot &&
+             partial->latest_block_header.proposer_index == state->latest_block_header.proposer_index &&
+             memcmp(partial->latest_block_header.body_root, state->latest_block_header.body_root, SIZE_ROOT) == 0 &&
+             partial->validators.length == state->validators.length &&
+             partial->balances.length == state->balances.length && partial->balances.data == NULL &&
+             partial->previous_epoch_attestations.length == state->previous_epoch_attestations.length &&
+             partial->previous_epoch_attestations.data == NULL &&
+             partial->genesis_time == 0xABABABABABABABABULL && partial->randao_mixes[0][0] == 0xAB;
+    }
+    if (ok && state->validators.length > 0)
+    {
+        const Validator *last = &partial->validators.data[partial->validators.length - 1];
+        const Validator *expected = &state->validators.data[state->validators.length - 1];
+        ok = memcmp(last->pubkey, expected->pubkey, SIZE_BLS_PUBKEY) == 0 &&
+             last->effective_balance == expected->effective_balance &&
+             last->withdrawable_epoch == expected->withdrawable_epoch;
+    }
+    if (ok)
+    {
+        printf("  OK: Field-mask decode reads slot, header and validators and skips the rest.\n");
+    }
+    else
+    {
+        printf("  FAIL: Field-mask decode returned wrong or extra fields.\n");
+    }
+
+    printf("Testing that skipped fields allocate nothing and are still bounds-checked...\n");
+    ssz_arena_free(&arena);
+    ok = partial != NULL &&
+         deserialize_BeaconState_partial(data, data_size, partial, &arena, SSZ_FIELD_BIT(BeaconState, slot)) == SSZ_SUCCESS &&
+         ssz_arena_capacity(&arena) == 0 && partial->validators.length == state->validators.length &&
+         partial->validators.data == NULL &&
+         deserialize_BeaconState_partial(data, SIZE_BEACON_STATE - 1, partial, &arena, 0) != SSZ_SUCCESS;
+    if (ok)
+    {
+        printf("  OK: Skipped lists keep their length without any allocation; truncation rejected.\n");
+    }
+    else
+    {
+        printf("  FAIL: Skipped fields allocated memory or truncation was accepted.\n");
+    }
+
+    printf("Testing a generated partial deserializer...\n");
+    if (state->validators.length > 0)
+    {
+        ssz_view_t view = {data, data_size};
+        const unsigned char *element = data + ssz_view_uint32(&view, POS_VALIDATORS);
+        Validator validator;
+        memset(&validator, 0, sizeof(validator));
+        ok = deserialize_Validator_partial(element, SIZE_VALIDATOR, &validator, NULL,
+                                           SSZ_FIELD_BIT(Validator, effective_balance) |
+                                               SSZ_FIELD_BIT(Validator, exit_epoch)) == SSZ_SUCCESS &&
+             validator.effective_balance == state->validators.data[0].effective_balance &&
+             validator.exit_epoch == state->validators.data[0].exit_epoch &&
+             validator.activation_epoch == 0 && validator.pubkey[0] == 0 &&
+             deserialize_Validator_partial(element, SIZE_VALIDATOR - 1, &validator, NULL, 0) != SSZ_SUCCESS;
+        if (ok)
+        {
+            printf("  OK: deserialize_Validator_partial decoded only the selected fields.\n");
+        }
+        else
+        {
+            printf("  FAIL: deserialize_Validator_partial decoded the wrong fields.\n");
+        }
+    }
+    ssz_arena_free(&arena);
+    free(partial);
+}
+
+static void test_parallel_Validators(const unsigned char *data, size_t data_size)
+{
+    const size_t count = 20000;
+    ssz_view_t view = {data, data_size};
+    ssz_view_t validators;
+    unsigned char *list = malloc(count * SIZE_VALIDATOR);
+    Validators serial = {0, NULL};
+    Validators parallel = {0, NULL};
+    bool ok = list != NULL && ssz_view_variable(&view, POS_VALIDATORS, POS_BALANCES, &validators) == SSZ_SUCCESS &&
+              validators.size >= SIZE_VALIDATOR;
+    if (!ok)
+    {
+        free(list);
+        return;
+    }
+    printf("Testing deserialize_Validators_parallel on %zu validators...\n", count);
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(list + i * SIZE_VALIDATOR, validators.data + (i * SIZE_VALIDATOR) % validators.size, SIZE_VALIDATOR);
+    }
+    size_t error_index = 0;
+    ok = deserialize_Validators(list, count * SIZE_VALIDATOR, &serial) == SSZ_SUCCESS &&
+         deserialize_Validators_parallel(list, count * SIZE_VALIDATOR, &parallel, NULL, &error_index) == SSZ_SUCCESS &&
+         parallel.length == count;
+    for (size_t i = 0; ok && i < count; i++)
+    {
+        const Validator *a = &serial.data[i];
+        const Validator *b = &parallel.data[i];
+        ok = memcmp(a->pubkey, b->pubkey, SIZE_BLS_PUBKEY) == 0 && a->effective_balance == b->effective_balance &&
+             a->slashed == b->slashed && a->withdrawable_epoch == b->withdrawable_epoch;
+    }
+    free(serial.data);
+    free(parallel.data);
+    if (ok)
+    {
+        printf("  OK: Parallel decode matches the serial decode.\n");
+    }
+    else
+    {
+        printf("  FAIL: Parallel decode differs from the serial decode.\n");
+    }
+
+    printf("Testing that the first invalid validator is reported...\n");
+    const size_t slashed = SIZE_BLS_PUBKEY + SIZE_ROOT + SIZE_GWEI;
+    list[15000 * SIZE_VALIDATOR + slashed] = 2;
+    list[1234 * SIZE_VALIDATOR + slashed] = 3;
+    ok = deserialize_Validators_parallel(list, count * SIZE_VALIDATOR, &parallel, NULL, &error_index) ==
+             SSZ_ERROR_DESERIALIZATION &&
+         error_index == 1234 && parallel.data == NULL && parallel.length == 0;
+    if (ok)
+    {
+        printf("  OK: Index 1234 reported and the list left empty.\n");
+    }
+    else
+    {
+        printf("  FAIL: Wrong failing index %zu.\n", error_index);
+    }
+    free(list);
+}
+
+static void test_reader_BeaconState(const unsigned char *data, size_t data_size)
+{
+    ssz_view_t view = {data, data_size};
+    size_t staging_size = READER_STAGING_SIZE;
+    size_t attestations_end = data_size;
+    for (int i = 1; i >= 0; i--)
+    {
+        size_t start = ssz_view_uint32(&view, POS_PREVIOUS_EPOCH_ATTESTATIONS + (size_t)i * SSZ_BYTES_PER_LENGTH_OFFSET);
+        if (attestations_end - start > staging_size)
+        {
+            staging_size = attestations_end - start;
+        }
+        attestations_end = start;
+    }
+    uint8_t *staging = malloc(staging_size);
+    BeaconState *copy = malloc(sizeof(BeaconState));
+    unsigned char *reserialized = malloc(data_size);
+    ssz_arena_t arena;
+    bool ok = staging != NULL && copy != NULL && reserialized != NULL;
+    uint32_t seed = 12345;
+    ssz_arena_init(&arena, 0);
+    printf("Testing ssz_reader_push with random chunks and a %zu-byte staging buffer...\n", staging_size);
+    if (ok)
+    {
+        ssz_reader_t reader;
+        size_t reserialized_size = 0;
+        ok = ssz_reader_init_BeaconState(&reader, staging, staging_size, data_size, copy, &arena) == SSZ_SUCCESS;
+        for (size_t pos = 0; ok && pos < data_size;)
+        {
+            seed = seed * 1103515245 + 12345;
+            size_t len = 1 + (seed >> 16) % READER_MAX_CHUNK;
+            if (len > data_size - pos)
+            {
+                len = data_size - pos;
+            }
+            ok = ssz_reader_needed(&reader) > 0 && ssz_reader_push(&reader, data + pos, len) == SSZ_SUCCESS;
+            pos += len;
+        }
+        ok = ok && ssz_reader_complete(&reader) &&
+             serialize_BeaconState_object(copy, reserialized, &reserialized_size) == SSZ_SUCCESS &&
+             reserialized_size == data_size && memcmp(reserialized, data, data_size) == 0;
+    }
+    if (ok)
+    {
+        printf("  OK: Chunked decode round-trips.\n");
+    }
+    else
+    {
+        printf("  FAIL: Chunked decode failed or did not round-trip.\n");
+    }
+
+    printf("Testing ssz_reader_push with a truncated stream...\n");
+    if (staging != NULL && copy != NULL)
+    {
+        ssz_reader_t reader;
+        ssz_arena_reset(&arena);
+        ok = ssz_reader_init_BeaconState(&reader, staging, staging_size, data_size, copy, &arena) == SSZ_SUCCESS &&
+             ssz_reader_push(&reader, data, data_size - 1) == SSZ_SUCCESS && !ssz_reader_complete(&reader) &&
+             ssz_reader_needed(&reader) >= 1;
+        if (ok)
+        {
+            printf("  OK: Reader waits for %zu more byte(s).\n", ssz_reader_needed(&reader));
+        }
+        else
+        {
+            printf("  FAIL: Truncated stream completed or failed.\n");
+        }
+    }
+    ssz_arena_free(&arena);
+    free(reserialized);
+    free(copy);
+    free(staging);
+}
+
+static void test_validate_BeaconState(unsigned char *data, size_t data_size)
+{
+    ssz_view_t view;
+    bool ok = ssz_validate_BeaconState(data, data_size) == SSZ_SUCCESS;
+    if (ok && ssz_view_BeaconState(data, data_size, &view) == SSZ_SUCCESS)
+    {
+        ssz_view_t validators = ssz_view_BeaconState_validators(&view);
+        ssz_view_t previous = ssz_view_BeaconState_previous_epoch_attestations(&view);
+        size_t count = ssz_view_list_length(&validators, SIZE_VALIDATOR);
+        if (count > 0)
+        {
+            uint8_t *slashed = (uint8_t *)validators.data + (count - 1) * SIZE_VALIDATOR + SIZE_BLS_PUBKEY + SIZE_ROOT + SIZE_GWEI;
+            uint8_t saved = *slashed;
+            *slashed = 2;
+            ok = ssz_validate_BeaconState(data, data_size) == SSZ_ERROR_DESERIALIZATION;
+            *slashed = saved;
+        }
+        ssz_view_t attestation;
+        if (ok && ssz_view_variable_list_element(&previous, 0, &attestation) == SSZ_SUCCESS)
+        {
+            uint8_t *last = (uint8_t *)attestation.data + attestation.size - 1;
+            uint8_t saved = *last;
+            *last = 0;
+            ok = ssz_validate_BeaconState(data, data_size) == SSZ_ERROR_DESERIALIZATION;
+            *last = saved;
+        }
+        ok = ok && ssz_validate_BeaconState(data, data_size) == SSZ_SUCCESS &&
+             ssz_validate_BeaconState(data, SIZE_BEACON_STATE - 1) == SSZ_ERROR_DESERIALIZATION;
+    }
+    if (ok)
+    {
+        printf("  OK: ssz_validate_BeaconState accepts the fixture and rejects a bad boolean, delimiter and length.\n");
+    }
+    else
+    {
+        printf("  FAIL: ssz_validate_BeaconState gave the wrong verdict.\n");
+    }
+}
+
 void process_serialized_file(const char *folder_name, const char *folder_path, const char *serialized_file_path, bool valid)
 {
     (void)valid;
@@ -666,7 +1700,85 @@ void process_serialized_file(const char *folder_name, const char *folder_path, c
         printf("Successfully deserialized BeaconState for folder %s\n", folder_path);
     }
 
-    unsigned char *serialized_data = malloc(data_size);
+    size_t expected_size = ssz_size_BeaconState(state);
+    if (err1 == SSZ_SUCCESS)
+    {
+        if (expected_size == data_size && ssz_size_Checkpoint(&state->finalized_checkpoint) == SIZE_CHECKPOINT)
+        {
+            printf("  OK: ssz_size_BeaconState matches the serialized size (%zu bytes).\n", expected_size);
+        }
+        else
+        {
+            printf("  FAIL: ssz_size_BeaconState returned %zu, expected %zu.\n", expected_size, data_size);
+        }
+    }
+
+    if (err1 == SSZ_SUCCESS)
+    {
+        static uint8_t staging[STREAM_STAGING_SIZE];
+        compare_sink_t sink = {data, data_size, 0, false};
+        ssz_writer_t writer;
+        ssz_error_t err = ssz_writer_init(&writer, staging, sizeof(staging), compare_sink, &sink);
+        if (err == SSZ_SUCCESS)
+        {
+            err = stream_BeaconState(state, &writer);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_flush(&writer);
+        }
+        if (err == SSZ_SUCCESS && !sink.mismatch && sink.position == data_size)
+        {
+            printf("  OK: stream_BeaconState matches the fixture through a %d-byte staging buffer.\n", STREAM_STAGING_SIZE);
+        }
+        else
+        {
+            printf("  FAIL: stream_BeaconState diverged from the fixture at byte %zu.\n", sink.position);
+        }
+    }
+
+    if (err1 == SSZ_SUCCESS)
+    {
+        static uint8_t scratch[STREAM_SCRATCH_SIZE];
+        static ssz_iovec_t iov[STREAM_IOV_CAPACITY];
+        compare_iov_sink_t sink = {{data, data_size, 0, false}, scratch, sizeof(scratch), 0};
+        ssz_writer_t writer;
+        ssz_error_t err = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, STREAM_IOV_CAPACITY,
+                                              STREAM_ZERO_COPY_MIN, compare_iov_sink, &sink);
+        if (err == SSZ_SUCCESS)
+        {
+            err = stream_BeaconState(state, &writer);
+        }
+        if (err == SSZ_SUCCESS)
+        {
+            err = ssz_writer_flush(&writer);
+        }
+        if (err == SSZ_SUCCESS && !sink.compare.mismatch && sink.compare.position == data_size)
+        {
+            printf("  OK: stream_BeaconState in iovec mode matches the fixture (%zu of %zu bytes referenced in place).\n",
+                   sink.referenced, data_size);
+        }
+        else
+        {
+            printf("  FAIL: stream_BeaconState in iovec mode diverged from the fixture at byte %zu.\n",
+                   sink.compare.position);
+        }
+    }
+
+    if (err1 == SSZ_SUCCESS)
+    {
+        test_view_BeaconState(state, data, data_size);
+        test_arena_BeaconState(data, data_size);
+        test_bad_offsets_BeaconState(data, data_size);
+        test_empty_attestations_BeaconState(state, data_size);
+        test_dirty_bits_BeaconState(state, data, data_size);
+        test_partial_BeaconState(state, data, data_size);
+        test_parallel_Validators(data, data_size);
+        test_reader_BeaconState(data, data_size);
+        test_validate_BeaconState(data, data_size);
+    }
+
+    unsigned char *serialized_data = malloc(expected_size);
     if (!serialized_data)
     {
         fprintf(stderr, "Failed to allocate memory for serialized data\n");
@@ -720,6 +1832,31 @@ void process_serialized_file(const char *folder_name, const char *folder_path, c
         printf("The original serialized data and computed serialized data are the same for folder %s\n", folder_path);
     }
 
+    char roots_yaml_path[1024];
+    snprintf(roots_yaml_path, sizeof(roots_yaml_path), "%s/roots.yaml", folder_path);
+    size_t expected_root_size = 0;
+    uint8_t *expected_root = read_yaml_field(roots_yaml_path, "root", &expected_root_size);
+    uint8_t computed_root[SSZ_BYTES_PER_CHUNK];
+    if (err1 != SSZ_SUCCESS || !expected_root || expected_root_size != SSZ_BYTES_PER_CHUNK)
+    {
+        printf("Could not check the hash tree root for folder %s\n", folder_path);
+    }
+    else if (hash_tree_root_BeaconState(state, computed_root) != SSZ_SUCCESS)
+    {
+        printf("Failed to compute the hash tree root for folder %s\n", folder_path);
+    }
+    else if (memcmp(computed_root, expected_root, SSZ_BYTES_PER_CHUNK) != 0)
+    {
+        printf("The computed hash tree root does not match roots.yaml for folder %s\n", folder_path);
+        printf("Computed root: ");
+        print_hex(computed_root, SSZ_BYTES_PER_CHUNK);
+    }
+    else
+    {
+        printf("The computed hash tree root matches roots.yaml for folder %s\n", folder_path);
+    }
+    free(expected_root);
+
     free(data);
     free(serialized_data);
 }
@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "ssz_tree.h"
+#include "ssz_merkle.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+static void fill_pattern(uint8_t *buf, size_t len, uint32_t seed)
+{
+    uint32_t x = seed * 2654435761u + 1;
+    for (size_t i = 0; i < len; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        buf[i] = (uint8_t)x;
+    }
+}
+
+static void test_tree_init(void)
+{
+    printf("\n--- Testing ssz_tree_init ---\n");
+    printf("Testing initial roots against ssz_merkleize...\n");
+    {
+        static uint8_t chunks[300 * SSZ_BYTES_PER_CHUNK];
+        static const size_t counts[] = {0, 1, 2, 3, 5, 8, 13, 64, 255, 300};
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        fill_pattern(chunks, sizeof(chunks), 1);
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+        {
+            size_t limits[] = {0, counts[c], 512, (size_t)1 << 40};
+            for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+            {
+                ssz_tree_t tree;
+                ssz_merkleize(chunks, counts[c], limits[l], expected);
+                bool ok = ssz_tree_init(&tree, chunks, counts[c], limits[l]) == SSZ_SUCCESS &&
+                          ssz_tree_root(&tree, root) == SSZ_SUCCESS;
+                if (!ok || memcmp(root, expected, 32) != 0)
+                {
+                    mismatches++;
+                }
+                ssz_tree_free(&tree);
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: All initial roots match ssz_merkleize.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu initial roots differ from ssz_merkleize.\n", mismatches);
+        }
+    }
+
+    printf("Testing chunk count exceeding the limit...\n");
+    {
+        uint8_t chunks[3 * SSZ_BYTES_PER_CHUNK] = {0};
+        ssz_tree_t tree;
+        if (ssz_tree_init(&tree, chunks, 3, 2) == SSZ_ERROR_SERIALIZATION)
+        {
+            printf("  OK: Oversized input rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized input was not rejected.\n");
+        }
+        ssz_tree_free(&tree);
+    }
+}
+
+static void test_tree_updates(void)
+{
+    printf("\n--- Testing ssz_tree_set_chunk ---\n");
+    printf("Testing random updates against ssz_merkleize...\n");
+    {
+        enum { COUNT = 1000 };
+        static uint8_t chunks[COUNT * SSZ_BYTES_PER_CHUNK];
+        uint8_t expected[32];
+        uint8_t root[32];
+        uint32_t x = 12345;
+        size_t mismatches = 0;
+        ssz_tree_t tree;
+        fill_pattern(chunks, sizeof(chunks), 2);
+        ssz_tree_init(&tree, chunks, COUNT, 1024);
+        for (size_t round = 0; round < 50; round++)
+        {
+            size_t updates = round % 7 == 0 ? 300 : round % 5;
+            for (size_t u = 0; u < updates; u++)
+            {
+                x = x * 1103515245u + 12345u;
+                size_t index = (x >> 8) % COUNT;
+                fill_pattern(chunks + index * SSZ_BYTES_PER_CHUNK, SSZ_BYTES_PER_CHUNK, x);
+                ssz_tree_set_chunk(&tree, index, chunks + index * SSZ_BYTES_PER_CHUNK);
+            }
+            ssz_merkleize(chunks, COUNT, 1024, expected);
+            if (ssz_tree_root(&tree, root) != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+            {
+                mismatches++;
+            }
+        }
+        ssz_tree_free(&tree);
+        if (mismatches == 0)
+        {
+            printf("  OK: All updated roots match ssz_merkleize.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu updated roots differ from ssz_merkleize.\n", mismatches);
+        }
+    }
+
+    printf("Testing appends to an empty unbounded tree...\n");
+    {
+        enum { COUNT = 130 };
+        static uint8_t chunks[COUNT * SSZ_BYTES_PER_CHUNK];
+        uint8_t expected[32];
+        uint8_t root[32];
+        size_t mismatches = 0;
+        ssz_tree_t tree;
+        fill_pattern(chunks, sizeof(chunks), 3);
+        ssz_tree_init(&tree, NULL, 0, 0);
+        for (size_t i = 0; i < COUNT; i++)
+        {
+            ssz_tree_set_chunk(&tree, i, chunks + i * SSZ_BYTES_PER_CHUNK);
+            if (i % 3 == 0 || i + 1 == COUNT)
+            {
+                ssz_merkleize(chunks, i + 1, 0, expected);
+                if (ssz_tree_root(&tree, root) != SSZ_SUCCESS || memcmp(root, expected, 32) != 0)
+                {
+                    mismatches++;
+                }
+            }
+        }
+        ssz_tree_free(&tree);
+        if (mismatches == 0)
+        {
+            printf("  OK: All roots after appends match ssz_merkleize.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu roots after appends differ from ssz_merkleize.\n", mismatches);
+        }
+    }
+
+    printf("Testing out-of-range indices and a full tree...\n");
+    {
+        uint8_t chunks[2 * SSZ_BYTES_PER_CHUNK] = {0};
+        ssz_tree_t tree;
+        ssz_tree_init(&tree, chunks, 2, 2);
+        bool ok = ssz_tree_set_chunk(&tree, 2, chunks) == SSZ_ERROR_OUT_OF_RANGE &&
+                  ssz_tree_set_chunk(&tree, 5, chunks) == SSZ_ERROR_OUT_OF_RANGE &&
+                  ssz_tree_set_chunk(&tree, 1, chunks) == SSZ_SUCCESS;
+        ssz_tree_free(&tree);
+        if (ok)
+        {
+            printf("  OK: Invalid indices rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Invalid indices were not handled correctly.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_tree_init();
+    test_tree_updates();
+
+    return 0;
+}
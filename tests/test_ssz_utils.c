@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "ssz_utils.h"
+#include "ssz_constants.h"
+
+#define MAX_LEN 600
+
+static bool reference_is_zero(const uint8_t *ptr, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (ptr[i] != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool reference_is_boolean(const uint8_t *ptr, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (ptr[i] > 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool reference_last_set_bit(const uint8_t *ptr, size_t len, size_t *out_bit)
+{
+    for (size_t i = len; i > 0; i--)
+    {
+        if (ptr[i - 1] != 0)
+        {
+            *out_bit = (i - 1) * 8 + (size_t)highest_bit_table[ptr[i - 1]];
+            return true;
+        }
+    }
+    return false;
+}
+
+static void test_is_zero(void)
+{
+    printf("\n--- Testing is_zero (backend: %s) ---\n", ssz_scan_backend());
+    printf("Testing a single non-zero byte at every position of every length...\n");
+    {
+        static uint8_t buf[MAX_LEN + 1];
+        size_t mismatches = 0;
+        memset(buf, 0, sizeof(buf));
+        for (size_t len = 0; len <= MAX_LEN; len++)
+        {
+            if (!is_zero(buf + 1, len))
+            {
+                mismatches++;
+            }
+            for (size_t pos = 0; pos < len; pos++)
+            {
+                buf[1 + pos] = 0x80;
+                if (is_zero(buf + 1, len) != reference_is_zero(buf + 1, len))
+                {
+                    mismatches++;
+                }
+                buf[1 + pos] = 0;
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: is_zero matches the byte-wise reference.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu is_zero mismatches.\n", mismatches);
+        }
+    }
+}
+
+static void test_is_boolean_bytes(void)
+{
+    printf("\n--- Testing is_boolean_bytes ---\n");
+    printf("Testing every byte value at every position of every length...\n");
+    {
+        static uint8_t buf[MAX_LEN];
+        size_t mismatches = 0;
+        for (size_t len = 1; len <= MAX_LEN; len += 37)
+        {
+            for (size_t i = 0; i < len; i++)
+            {
+                buf[i] = (uint8_t)((i * 5) % 3 == 0);
+            }
+            if (!is_boolean_bytes(buf, len))
+            {
+                mismatches++;
+            }
+            for (size_t pos = 0; pos < len; pos++)
+            {
+                for (unsigned value = 0; value < 256; value += 17)
+                {
+                    uint8_t saved = buf[pos];
+                    buf[pos] = (uint8_t)value;
+                    if (is_boolean_bytes(buf, len) != reference_is_boolean(buf, len))
+                    {
+                        mismatches++;
+                    }
+                    buf[pos] = saved;
+                }
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: is_boolean_bytes matches the byte-wise reference.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu is_boolean_bytes mismatches.\n", mismatches);
+        }
+    }
+}
+
+static void test_find_last_set_bit(void)
+{
+    printf("\n--- Testing find_last_set_bit ---\n");
+    printf("Testing every bit position of every length, with lower bits set...\n");
+    {
+        static uint8_t buf[MAX_LEN];
+        size_t mismatches = 0;
+        for (size_t len = 0; len <= 200; len++)
+        {
+            size_t found = 0, expected = 0;
+            memset(buf, 0, sizeof(buf));
+            if (find_last_set_bit(buf, len, &found))
+            {
+                mismatches++;
+            }
+            for (size_t bit = 0; bit < len * 8; bit++)
+            {
+                memset(buf, 0, len);
+                buf[0] = 0x01;
+                buf[bit / 8] |= (uint8_t)(1u << (bit % 8));
+                bool ok = find_last_set_bit(buf, len, &found);
+                reference_last_set_bit(buf, len, &expected);
+                if (!ok || found != expected || found != bit)
+                {
+                    mismatches++;
+                }
+            }
+        }
+        if (mismatches == 0)
+        {
+            printf("  OK: find_last_set_bit matches the table reference.\n");
+        }
+        else
+        {
+            printf("  FAIL: %zu find_last_set_bit mismatches.\n", mismatches);
+        }
+    }
+}
+
+int main(void)
+{
+    test_is_zero();
+    test_is_boolean_bytes();
+    test_find_last_set_bit();
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "ssz_view.h"
+#include "ssz_constants.h"
+
+static void put_uint32(uint8_t *out, uint32_t value)
+{
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    out[2] = (uint8_t)(value >> 16);
+    out[3] = (uint8_t)(value >> 24);
+}
+
+static void test_view_variable(void)
+{
+    printf("\n--- Testing ssz_view_variable ---\n");
+    printf("Testing a container with two variable fields...\n");
+    {
+        uint8_t buf[16] = {0};
+        ssz_view_t view = {buf, sizeof(buf)};
+        ssz_view_t first, second;
+        put_uint32(buf, 8);
+        put_uint32(buf + 4, 11);
+        bool ok = ssz_view_variable(&view, 0, 4, &first) == SSZ_SUCCESS &&
+                  ssz_view_variable(&view, 4, SSZ_VIEW_END, &second) == SSZ_SUCCESS &&
+                  first.data == buf + 8 && first.size == 3 && second.data == buf + 11 && second.size == 5;
+        if (ok)
+        {
+            printf("  OK: Sub-views cover the bytes between consecutive offsets.\n");
+        }
+        else
+        {
+            printf("  FAIL: Sub-views do not match the offsets.\n");
+        }
+    }
+
+    printf("Testing decreasing and out-of-bounds offsets...\n");
+    {
+        uint8_t buf[16] = {0};
+        ssz_view_t view = {buf, sizeof(buf)};
+        ssz_view_t out;
+        put_uint32(buf, 12);
+        put_uint32(buf + 4, 8);
+        bool decreasing = ssz_view_variable(&view, 0, 4, &out) == SSZ_ERROR_DESERIALIZATION;
+        put_uint32(buf + 4, 17);
+        bool past_end = ssz_view_variable(&view, 4, SSZ_VIEW_END, &out) == SSZ_ERROR_DESERIALIZATION;
+        bool bad_position = ssz_view_variable(&view, 14, SSZ_VIEW_END, &out) == SSZ_ERROR_DESERIALIZATION;
+        if (decreasing && past_end && bad_position)
+        {
+            printf("  OK: Malformed offsets rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Malformed offsets accepted.\n");
+        }
+    }
+}
+
+static void test_view_lists(void)
+{
+    printf("\n--- Testing ssz_view list checks and element access ---\n");
+    printf("Testing fixed-size element lists...\n");
+    {
+        uint8_t buf[24];
+        ssz_view_t list = {buf, sizeof(buf)};
+        ssz_view_t element;
+        for (size_t i = 0; i < sizeof(buf); i++)
+        {
+            buf[i] = (uint8_t)i;
+        }
+        bool ok = ssz_view_check_list(&list, 8, 3) == SSZ_SUCCESS &&
+                  ssz_view_check_list(&list, 8, 2) == SSZ_ERROR_DESERIALIZATION &&
+                  ssz_view_check_list(&list, 5, 10) == SSZ_ERROR_DESERIALIZATION &&
+                  ssz_view_list_length(&list, 8) == 3 &&
+                  ssz_view_list_element(&list, 8, 2, &element) == SSZ_SUCCESS &&
+                  ssz_view_uint64(&element, 0) == 0x1716151413121110ULL &&
+                  ssz_view_list_element(&list, 8, 3, &element) == SSZ_ERROR_OUT_OF_RANGE;
+        if (ok)
+        {
+            printf("  OK: Length, limits and element access are correct.\n");
+        }
+        else
+        {
+            printf("  FAIL: Fixed-size list view is wrong.\n");
+        }
+    }
+
+    printf("Testing bitlists...\n");
+    {
+        uint8_t bits[3] = {0xFF, 0x00, 0x04};
+        ssz_view_t list = {bits, sizeof(bits)};
+        bool ok = ssz_view_check_bitlist(&list, 18) == SSZ_SUCCESS &&
+                  ssz_view_check_bitlist(&list, 17) == SSZ_ERROR_DESERIALIZATION;
+        bits[2] = 0;
+        ok = ok && ssz_view_check_bitlist(&list, 64) == SSZ_ERROR_DESERIALIZATION;
+        list.size = 0;
+        ok = ok && ssz_view_check_bitlist(&list, 64) == SSZ_ERROR_DESERIALIZATION;
+        if (ok)
+        {
+            printf("  OK: Delimiter and length limit enforced.\n");
+        }
+        else
+        {
+            printf("  FAIL: Bitlist check is wrong.\n");
+        }
+    }
+
+    printf("Testing variable-size element lists...\n");
+    {
+        uint8_t buf[17] = {0};
+        ssz_view_t list = {buf, sizeof(buf)};
+        ssz_view_t element;
+        put_uint32(buf, 12);
+        put_uint32(buf + 4, 12);
+        put_uint32(buf + 8, 15);
+        bool ok = ssz_view_check_variable_list(&list, 3, NULL) == SSZ_SUCCESS &&
+                  ssz_view_check_variable_list(&list, 2, NULL) == SSZ_ERROR_DESERIALIZATION &&
+                  ssz_view_variable_list_length(&list) == 3 &&
+                  ssz_view_variable_list_element(&list, 0, &element) == SSZ_SUCCESS && element.size == 0 &&
+                  ssz_view_variable_list_element(&list, 1, &element) == SSZ_SUCCESS && element.size == 3 &&
+                  ssz_view_variable_list_element(&list, 2, &element) == SSZ_SUCCESS && element.size == 2 &&
+                  element.data == buf + 15 &&
+                  ssz_view_variable_list_element(&list, 3, &element) == SSZ_ERROR_OUT_OF_RANGE;
+        put_uint32(buf + 8, 11);
+        ok = ok && ssz_view_check_variable_list(&list, 3, NULL) == SSZ_ERROR_DESERIALIZATION;
+        put_uint32(buf, 6);
+        ok = ok && ssz_view_check_variable_list(&list, 3, NULL) == SSZ_ERROR_DESERIALIZATION;
+        list.size = 0;
+        ok = ok && ssz_view_check_variable_list(&list, 3, NULL) == SSZ_SUCCESS &&
+             ssz_view_variable_list_length(&list) == 0;
+        if (ok)
+        {
+            printf("  OK: Offset table checked and elements located.\n");
+        }
+        else
+        {
+            printf("  FAIL: Variable-size list view is wrong.\n");
+        }
+    }
+}
+
+int main(void)
+{
+    test_view_variable();
+    test_view_lists();
+
+    return 0;
+}
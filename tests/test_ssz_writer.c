@@ -0,0 +1,376 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "ssz_writer.h"
+#include "ssz_serialize.h"
+#include "ssz_constants.h"
+#include "ssz_types.h"
+
+#define OUTPUT_CAPACITY 8192
+
+typedef struct
+{
+    uint8_t data[OUTPUT_CAPACITY];
+    size_t size;
+    size_t calls;
+    size_t fail_after;
+} memory_sink_t;
+
+static ssz_error_t memory_sink(void *ctx, const uint8_t *data, size_t len)
+{
+    memory_sink_t *sink = ctx;
+    if (sink->fail_after != 0 && sink->calls == sink->fail_after)
+    {
+        return SSZ_ERROR_OUT_OF_RANGE;
+    }
+    if (sink->size + len > OUTPUT_CAPACITY)
+    {
+        return SSZ_ERROR_SERIALIZATION;
+    }
+    memcpy(sink->data + sink->size, data, len);
+    sink->size += len;
+    sink->calls++;
+    return SSZ_SUCCESS;
+}
+
+typedef struct
+{
+    memory_sink_t memory;
+    const uint8_t *scratch;
+    size_t scratch_size;
+    size_t batches;
+    size_t referenced;
+    bool foreign_pointer;
+} gather_sink_t;
+
+static ssz_error_t gather_sink(void *ctx, const ssz_iovec_t *iov, size_t iov_count)
+{
+    gather_sink_t *sink = ctx;
+    sink->batches++;
+    for (size_t i = 0; i < iov_count; i++)
+    {
+        const uint8_t *base = iov[i].base;
+        if (base < sink->scratch || base >= sink->scratch + sink->scratch_size)
+        {
+            sink->referenced += iov[i].len;
+        }
+        ssz_error_t err = memory_sink(&sink->memory, base, iov[i].len);
+        if (err != SSZ_SUCCESS)
+        {
+            return err;
+        }
+    }
+    return SSZ_SUCCESS;
+}
+
+static void fill_pattern(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        buf[i] = (uint8_t)(i * 31 + 7);
+    }
+}
+
+static void test_writer_write(void)
+{
+    printf("\n--- Testing ssz_writer_write ---\n");
+    printf("Testing mixed write sizes through a 64-byte staging buffer...\n");
+    {
+        static const size_t sizes[] = {0, 1, 3, 63, 64, 65, 1, 200, 7, 128, 1000, 2};
+        static uint8_t expected[OUTPUT_CAPACITY];
+        static memory_sink_t sink;
+        uint8_t staging[64];
+        ssz_writer_t writer;
+        size_t total = 0;
+        bool ok = true;
+        memset(&sink, 0, sizeof(sink));
+        fill_pattern(expected, sizeof(expected));
+        ok = ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink) == SSZ_SUCCESS;
+        for (size_t i = 0; ok && i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            ok = ssz_writer_write(&writer, expected + total, sizes[i]) == SSZ_SUCCESS;
+            total += sizes[i];
+            ok = ok && ssz_writer_position(&writer) == total;
+        }
+        ok = ok && ssz_writer_flush(&writer) == SSZ_SUCCESS;
+        if (ok && sink.size == total && memcmp(sink.data, expected, total) == 0)
+        {
+            printf("  OK: Output matches the concatenated writes.\n");
+        }
+        else
+        {
+            printf("  FAIL: Output does not match the concatenated writes.\n");
+        }
+    }
+
+    printf("Testing that a staging buffer below the minimum is rejected...\n");
+    {
+        uint8_t staging[16];
+        memory_sink_t sink;
+        ssz_writer_t writer;
+        if (ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink) == SSZ_ERROR_SERIALIZATION)
+        {
+            printf("  OK: Small staging buffer rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Small staging buffer was accepted.\n");
+        }
+    }
+}
+
+static void test_writer_reserve_and_offset(void)
+{
+    printf("\n--- Testing ssz_writer_reserve and ssz_writer_write_offset ---\n");
+    printf("Testing serialize functions writing into reserved staging space...\n");
+    {
+        static memory_sink_t sink;
+        uint8_t staging[64];
+        ssz_writer_t writer;
+        bool ok;
+        memset(&sink, 0, sizeof(sink));
+        ok = ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink) == SSZ_SUCCESS;
+        for (uint64_t v = 0; ok && v < 20; v++)
+        {
+            uint8_t *out = ssz_writer_reserve(&writer, SSZ_BYTE_SIZE_OF_UINT64);
+            size_t size = SSZ_BYTE_SIZE_OF_UINT64;
+            ok = out != NULL && ssz_serialize_uint64(&v, out, &size) == SSZ_SUCCESS;
+            ok = ok && ssz_writer_write_offset(&writer, v * 0x01010101u) == SSZ_SUCCESS;
+        }
+        ok = ok && ssz_writer_flush(&writer) == SSZ_SUCCESS && sink.size == 20 * 12;
+        for (uint64_t v = 0; ok && v < 20; v++)
+        {
+            const uint8_t *p = sink.data + v * 12;
+            uint32_t off = (uint32_t)p[8] | (uint32_t)p[9] << 8 | (uint32_t)p[10] << 16 | (uint32_t)p[11] << 24;
+            ok = p[0] == v && off == v * 0x01010101u;
+        }
+        if (ok)
+        {
+            printf("  OK: Reserved values and offsets are laid out in order.\n");
+        }
+        else
+        {
+            printf("  FAIL: Reserved values or offsets are wrong.\n");
+        }
+    }
+
+    printf("Testing oversized reservations and offsets...\n");
+    {
+        memory_sink_t sink;
+        uint8_t staging[64];
+        ssz_writer_t writer;
+        memset(&sink, 0, sizeof(sink));
+        ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink);
+        bool reserve_rejected = ssz_writer_reserve(&writer, 65) == NULL;
+        ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink);
+        bool offset_rejected = ssz_writer_write_offset(&writer, (uint64_t)UINT32_MAX + 1) == SSZ_ERROR_SERIALIZATION;
+        if (reserve_rejected && offset_rejected)
+        {
+            printf("  OK: Oversized reservation and offset rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Oversized reservation or offset accepted.\n");
+        }
+    }
+}
+
+static void test_writer_sink_error(void)
+{
+    printf("\n--- Testing ssz_writer sink errors ---\n");
+    printf("Testing that the first sink error is sticky...\n");
+    {
+        static memory_sink_t sink;
+        static uint8_t payload[1024];
+        uint8_t staging[64];
+        ssz_writer_t writer;
+        memset(&sink, 0, sizeof(sink));
+        sink.fail_after = 2;
+        ssz_writer_init(&writer, staging, sizeof(staging), memory_sink, &sink);
+        ssz_error_t first = SSZ_SUCCESS;
+        for (size_t i = 0; i < 10 && first == SSZ_SUCCESS; i++)
+        {
+            first = ssz_writer_write(&writer, payload, 40);
+        }
+        ssz_error_t later = ssz_writer_write(&writer, payload, 1);
+        ssz_error_t flushed = ssz_writer_flush(&writer);
+        if (first == SSZ_ERROR_OUT_OF_RANGE && later == first && flushed == first && sink.calls == 2)
+        {
+            printf("  OK: Sink error propagated and kept.\n");
+        }
+        else
+        {
+            printf("  FAIL: Sink error was not propagated or kept.\n");
+        }
+    }
+}
+
+static void test_writer_iov(void)
+{
+    printf("\n--- Testing ssz_writer iovec mode ---\n");
+    printf("Testing mixed write sizes through a 64-byte scratch buffer and 4 iovec entries...\n");
+    {
+        static const size_t sizes[] = {4, 1, 300, 8, 8, 64, 500, 2, 1000, 3, 63, 256, 4, 700};
+        static uint8_t expected[OUTPUT_CAPACITY];
+        static gather_sink_t sink;
+        uint8_t scratch[64];
+        ssz_iovec_t iov[4];
+        ssz_writer_t writer;
+        size_t total = 0, large = 0;
+        bool ok;
+        memset(&sink, 0, sizeof(sink));
+        sink.scratch = scratch;
+        sink.scratch_size = sizeof(scratch);
+        fill_pattern(expected, sizeof(expected));
+        ok = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 4, 256, gather_sink, &sink) == SSZ_SUCCESS;
+        for (size_t i = 0; ok && i < sizeof(sizes) / sizeof(sizes[0]); i++)
+        {
+            ok = ssz_writer_write(&writer, expected + total, sizes[i]) == SSZ_SUCCESS;
+            total += sizes[i];
+            large += sizes[i] >= 256 ? sizes[i] : 0;
+            ok = ok && ssz_writer_position(&writer) == total;
+        }
+        ok = ok && ssz_writer_write_offset(&writer, 0x04030201u) == SSZ_SUCCESS;
+        memcpy(expected + total, "\x01\x02\x03\x04", 4);
+        total += 4;
+        ok = ok && ssz_writer_flush(&writer) == SSZ_SUCCESS;
+        if (ok && sink.memory.size == total && memcmp(sink.memory.data, expected, total) == 0 &&
+            sink.referenced == large && sink.batches > 1)
+        {
+            printf("  OK: Output matches and all %zu large bytes were referenced in place.\n", large);
+        }
+        else
+        {
+            printf("  FAIL: iovec output or referenced byte count is wrong.\n");
+        }
+    }
+
+    printf("Testing a full iovec array followed by a staged write and a flush...\n");
+    {
+        static uint8_t expected[OUTPUT_CAPACITY];
+        static gather_sink_t sink;
+        uint8_t scratch[64];
+        ssz_iovec_t iov[3];
+        ssz_writer_t writer;
+        bool ok;
+        memset(&sink, 0, sizeof(sink));
+        sink.scratch = scratch;
+        sink.scratch_size = sizeof(scratch);
+        fill_pattern(expected, sizeof(expected));
+        ok = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 3, 16, gather_sink, &sink) == SSZ_SUCCESS &&
+             ssz_writer_write(&writer, expected, 3) == SSZ_SUCCESS &&
+             ssz_writer_write(&writer, expected + 3, 100) == SSZ_SUCCESS &&
+             ssz_writer_write(&writer, expected + 103, 1) == SSZ_SUCCESS &&
+             ssz_writer_write(&writer, expected + 104, 200) == SSZ_SUCCESS &&
+             ssz_writer_write(&writer, expected + 304, 64) == SSZ_SUCCESS &&
+             ssz_writer_flush(&writer) == SSZ_SUCCESS;
+        if (ok && sink.memory.size == 368 && memcmp(sink.memory.data, expected, 368) == 0)
+        {
+            printf("  OK: Staged segments stay within the iovec array.\n");
+        }
+        else
+        {
+            printf("  FAIL: Output after a full iovec array is wrong.\n");
+        }
+    }
+
+    printf("Testing that offsets are copied even when zero_copy_min is tiny...\n");
+    {
+        static gather_sink_t sink;
+        uint8_t scratch[64];
+        ssz_iovec_t iov[4];
+        ssz_writer_t writer;
+        bool ok;
+        memset(&sink, 0, sizeof(sink));
+        sink.scratch = scratch;
+        sink.scratch_size = sizeof(scratch);
+        ok = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 4, 1, gather_sink, &sink) == SSZ_SUCCESS;
+        for (uint32_t i = 0; ok && i < 40; i++)
+        {
+            ok = ssz_writer_write_offset(&writer, 0x01010101u * i) == SSZ_SUCCESS;
+        }
+        ok = ok && ssz_writer_flush(&writer) == SSZ_SUCCESS && sink.memory.size == 160 && sink.referenced == 0;
+        for (uint32_t i = 0; ok && i < 160; i++)
+        {
+            ok = sink.memory.data[i] == (uint8_t)(i / 4);
+        }
+        if (ok)
+        {
+            printf("  OK: Offsets were staged in the scratch buffer.\n");
+        }
+        else
+        {
+            printf("  FAIL: Offsets were referenced or written wrong.\n");
+        }
+    }
+
+    printf("Testing invalid iovec mode arguments...\n");
+    {
+        uint8_t scratch[64];
+        ssz_iovec_t iov[4];
+        gather_sink_t sink;
+        ssz_writer_t writer;
+        bool rejected = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 2, 256, gather_sink, &sink) != SSZ_SUCCESS &&
+                        ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 4, 0, gather_sink, &sink) != SSZ_SUCCESS &&
+                        ssz_writer_init_iov(&writer, scratch, 32, iov, 4, 256, gather_sink, &sink) != SSZ_SUCCESS;
+        if (rejected)
+        {
+            printf("  OK: Invalid arguments rejected.\n");
+        }
+        else
+        {
+            printf("  FAIL: Invalid arguments accepted.\n");
+        }
+    }
+
+#ifndef _WIN32
+    printf("Testing ssz_writev_fd_sink with a temporary file...\n");
+    {
+        static uint8_t expected[OUTPUT_CAPACITY];
+        static uint8_t readback[OUTPUT_CAPACITY];
+        uint8_t scratch[64];
+        ssz_iovec_t iov[8];
+        ssz_writer_t writer;
+        size_t total = 0;
+        bool ok = false;
+        FILE *file = tmpfile();
+        if (file != NULL)
+        {
+            int fd = fileno(file);
+            fill_pattern(expected, sizeof(expected));
+            ok = ssz_writer_init_iov(&writer, scratch, sizeof(scratch), iov, 8, 128, ssz_writev_fd_sink, &fd) == SSZ_SUCCESS;
+            for (size_t len = 1; ok && total + len <= OUTPUT_CAPACITY; len = len * 3 + 1)
+            {
+                ok = ssz_writer_write(&writer, expected + total, len) == SSZ_SUCCESS;
+                total += len;
+            }
+            ok = ok && ssz_writer_flush(&writer) == SSZ_SUCCESS;
+            ok = ok && pread(fd, readback, total, 0) == (ssize_t)total && memcmp(readback, expected, total) == 0;
+            fclose(file);
+        }
+        if (ok)
+        {
+            printf("  OK: %zu bytes written with writev and read back intact.\n", total);
+        }
+        else
+        {
+            printf("  FAIL: writev output does not match.\n");
+        }
+    }
+#endif
+}
+
+int main(void)
+{
+    test_writer_write();
+    test_writer_reserve_and_offset();
+    test_writer_sink_error();
+    test_writer_iov();
+
+    return 0;
+}